@@ -6,25 +6,60 @@ $RAYLIB_DIR = "$BASE_DIR/external/raylib/raylib-5.0_win64_mingw-w64"
 $INCLUDE_DIR = "$RAYLIB_DIR/include"
 $LIB_DIR = "$RAYLIB_DIR/lib"
 
-# 2. Compilacion
+# 2. Data pack (Phase 63): valida los JSON una vez y genera data/game.pack
+g++ src/tools/pack_builder.cpp `
+    src/core/DataPack.cpp `
+    src/core/JsonLoader.cpp `
+    src/core/MappedFile.cpp `
+    -I"$INCLUDE_DIR" `
+    -I"$BASE_DIR/src" `
+    -L"$LIB_DIR" `
+    -lraylib -lopengl32 -lgdi32 -lwinmm `
+    -static-libgcc -static-libstdc++ `
+    -O2 -Wall -std=c++17 `
+    -o pack_builder.exe
+if ($?) {
+    ./pack_builder.exe data data/game.pack
+}
+else {
+    Write-Host "No se pudo compilar pack_builder; el juego usara los JSON." -ForegroundColor Yellow
+}
+
+# 3. Compilacion
 g++ src/main.cpp `
     src/core/LocalizationManager.cpp `
     src/core/JsonLoader.cpp `
+    src/core/MappedFile.cpp `
+    src/core/DataPack.cpp `
+    src/core/HotReloader.cpp `
+    src/core/AsyncLogger.cpp `
+    src/core/MetricsRegistry.cpp `
     src/physics/PhysicsEngine.cpp `
     src/physics/StructuralPhysics.cpp `
     src/physics/SpatialGrid.cpp `
     src/physics/BondingSystem.cpp `
+    src/physics/MoleculeCensus.cpp `
+    src/world/ChunkStreamer.cpp `
+    src/ecs/WorldSnapshot.cpp `
+    src/ecs/SimulationRecorder.cpp `
+    src/ecs/ReplayPlayer.cpp `
+    src/ecs/StateHasher.cpp `
+    src/ecs/CheckpointStore.cpp `
     src/rendering/Renderer25D.cpp `
+    src/rendering/QuadBatch.cpp `
+    src/rendering/MoleculeImpostors.cpp `
     src/input/InputHandler.cpp `
     src/chemistry/ChemistryDatabase.cpp `
     src/chemistry/StructureRegistry.cpp `
     src/gameplay/Player.cpp `
     src/gameplay/TractorBeam.cpp `
     src/ui/LabelSystem.cpp `
+    src/ui/LabelCache.cpp `
     src/ui/Inspector.cpp `
     src/ui/HUD.cpp `
     src/ui/UIWidgets.cpp `
     src/ui/Quimidex.cpp `
+    src/ui/PerfOverlay.cpp `
     src/gameplay/MissionManager.cpp `
     -I"$INCLUDE_DIR" `
     -I"$BASE_DIR/src" `
@@ -34,7 +69,7 @@ g++ src/main.cpp `
     -O2 -Wall -std=c++17 -pthread `
     -o LifeSimulator.exe
 
-# 3. Ejecucion
+# 4. Ejecucion
 if ($?) {
     Write-Host "--- Build Completado con EXITO ---" -ForegroundColor Green
     ./LifeSimulator.exe
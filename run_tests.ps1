@@ -15,10 +15,22 @@ Write-Host "============================================" -ForegroundColor Cyan
 $common_sources = @(
     "src/core/LocalizationManager.cpp",
     "src/core/JsonLoader.cpp",
+    "src/core/MappedFile.cpp",
+    "src/core/DataPack.cpp",
+    "src/core/HotReloader.cpp",
+    "src/core/AsyncLogger.cpp",
+    "src/core/MetricsRegistry.cpp",
     "src/physics/BondingSystem.cpp",
     "src/physics/PhysicsEngine.cpp",
     "src/physics/SpatialGrid.cpp",
     "src/physics/StructuralPhysics.cpp",
+    "src/physics/MoleculeCensus.cpp",
+    "src/ecs/WorldSnapshot.cpp",
+    "src/ecs/SimulationRecorder.cpp",
+    "src/ecs/ReplayPlayer.cpp",
+    "src/ecs/StateHasher.cpp",
+    "src/ecs/CheckpointStore.cpp",
+    "src/rendering/MoleculeImpostors.cpp",
     "src/chemistry/ChemistryDatabase.cpp",
     "src/chemistry/StructureRegistry.cpp",
     "src/gameplay/MissionManager.cpp"
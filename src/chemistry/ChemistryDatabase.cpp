@@ -1,6 +1,8 @@
 #include "ChemistryDatabase.hpp"
 #include "../core/JsonLoader.hpp"
 #include "../core/LocalizationManager.hpp"
+#include "../core/DataPack.hpp"
+#include "../core/SimulationState.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <cmath>
@@ -33,12 +35,18 @@ void ChemistryDatabase::reload() {
     // To ensure a clean slate for elements, we could re-initialize them:
     // for (int i = 0; i < elements.size(); ++i) elements[i] = Element(); // Reset all elements
     
+    // Phase 63: Precompiled pack when it has this language (already validated at build time)
+    const DataPack& pack = DataPack::getInstance();
+    const bool fromPack = pack.hasLanguage(lang);
+    const char* source = fromPack ? "data pack" : "JSON";
+
     try {
-        std::vector<Element> loadedElements = JsonLoader::loadElements("data/elements.json", lang);
+        std::vector<Element> loadedElements = fromPack ? pack.loadElements(lang)
+                                                       : JsonLoader::loadElements("data/elements.json", lang);
         for (const Element& el : loadedElements) {
             addElement(el);
         }
-        TraceLog(LOG_INFO, "[CHEMISTRY] Reloaded %d elements from JSON (Language: %s)", (int)loadedElements.size(), lang.c_str());
+        TraceLog(LOG_INFO, "[CHEMISTRY] Reloaded %d elements from %s (Language: %s)", (int)loadedElements.size(), source, lang.c_str());
     } catch (const std::exception& e) {
         TraceLog(LOG_ERROR, "[CHEMISTRY] Failed to reload elements.json: %s", e.what());
         // For initial construction, this exception is re-thrown by the constructor.
@@ -49,27 +57,94 @@ void ChemistryDatabase::reload() {
 
     // 3. Load Localized Molecules from JSON
     try {
-        molecules = JsonLoader::loadMolecules("data/molecules.json", lang);
-        TraceLog(LOG_INFO, "[CHEMISTRY] Reloaded %d molecules from JSON (Language: %s)", (int)molecules.size(), lang.c_str());
+        molecules = fromPack ? pack.loadMolecules(lang) : JsonLoader::loadMolecules("data/molecules.json", lang);
+        TraceLog(LOG_INFO, "[CHEMISTRY] Reloaded %d molecules from %s (Language: %s)", (int)molecules.size(), source, lang.c_str());
     } catch (const std::exception& e) {
         TraceLog(LOG_ERROR, "[CHEMISTRY] Failed to reload molecules.json: %s", e.what());
         // Molecule loading failure is less critical than element loading, so we just log.
     }
 
+    rebuildCompositionIndex();
+    generation++;
+
     // MANDATORY VALIDATION
     validateElements(); // This method throws if validation fails.
 }
 
+void ChemistryDatabase::relocalize() {
+    std::string lang = LocalizationManager::getInstance().getLanguageCode();
+    const DataPack& pack = DataPack::getInstance();
+    if (!pack.relocalize(elements, lang) || !pack.relocalize(molecules, lang)) {
+        reload();
+        return;
+    }
+    TraceLog(LOG_INFO, "[CHEMISTRY] Relocalized elements and molecules from data pack (Language: %s)", lang.c_str());
+}
+
+void ChemistryDatabase::applyElements(const std::vector<Element>& loaded) {
+    std::vector<Element> previous = elements;
+    std::unordered_map<std::string, int> previousSymbols = symbolToId;
+    for (const Element& el : loaded) addElement(el);
+    try {
+        validateElements();
+    } catch (...) {
+        elements = std::move(previous);
+        symbolToId = std::move(previousSymbols);
+        throw;
+    }
+    generation++;
+    TraceLog(LOG_INFO, "[CHEMISTRY] Hot-reloaded %d elements", (int)loaded.size());
+}
+
+void ChemistryDatabase::applyMolecules(std::vector<Molecule> loaded) {
+    molecules = std::move(loaded);
+    rebuildCompositionIndex();
+    generation++;
+    TraceLog(LOG_INFO, "[CHEMISTRY] Hot-reloaded %d molecules", (int)molecules.size());
+}
 
 void ChemistryDatabase::addMolecule(Molecule m) {
     molecules.push_back(m);
 }
 
 const Molecule* ChemistryDatabase::findMoleculeByComposition(const std::map<int, int>& composition) const {
-    for (const auto& mol : molecules) {
-        if (mol.composition == composition) return &mol;
+    return findMoleculeByKey(CompositionKey::fromMap(composition));
+}
+
+const Molecule* ChemistryDatabase::findMoleculeByKey(const CompositionKey& key) const {
+    if (compositionTable.empty() || key.empty()) return nullptr;
+    size_t mask = compositionTable.size() - 1;
+    for (size_t slot = key.hash & mask; ; slot = (slot + 1) & mask) {
+        int idx = compositionTable[slot];
+        if (idx == -1) return nullptr;
+        if (moleculeKeys[idx] == key) return &molecules[idx];
+    }
+}
+
+void ChemistryDatabase::rebuildCompositionIndex() {
+    moleculeKeys.clear();
+    size_t capacity = 16;
+    while (capacity < molecules.size() * 2) capacity <<= 1;  // Load factor <= 0.5
+    compositionTable.assign(capacity, -1);
+
+    size_t mask = capacity - 1;
+    for (int i = 0; i < (int)molecules.size(); i++) {
+        moleculeKeys.push_back(CompositionKey::fromMap(molecules[i].composition));
+        const CompositionKey& key = moleculeKeys.back();
+        size_t slot = key.hash & mask;
+        bool duplicate = false;
+        while (compositionTable[slot] != -1) {
+            if (moleculeKeys[compositionTable[slot]] == key) { duplicate = true; break; }
+            slot = (slot + 1) & mask;
+        }
+        // First definition wins, matching the old linear search order
+        if (duplicate) {
+            TraceLog(LOG_WARNING, "[CHEMISTRY] Molecule %s duplicates the composition of %s",
+                     molecules[i].id.c_str(), molecules[compositionTable[slot]].id.c_str());
+            continue;
+        }
+        compositionTable[slot] = i;
     }
-    return nullptr;
 }
 
 void ChemistryDatabase::addElement(Element e) {
@@ -148,6 +223,6 @@ std::vector<int> ChemistryDatabase::getSpawnableAtomicNumbers() const {
 int ChemistryDatabase::getRandomSpawnableAtomicNumber() const {
     auto spawnable = getSpawnableAtomicNumbers();
     if (spawnable.empty()) return 1; // Hydrogen fallback
-    return spawnable[GetRandomValue(0, (int)spawnable.size() - 1)];
+    return spawnable[SimulationState::getInstance().randomInt(0, (int)spawnable.size() - 1)];
 }
 
@@ -3,6 +3,7 @@
 
 #include "Element.hpp"
 #include "Molecule.hpp"
+#include "CompositionKey.hpp"
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -22,6 +23,16 @@ public:
     void initialize() { reload(); }
     void reload();
 
+    // Phase 63: Language switch. Re-copies only the localised text from the data pack row;
+    // Molecule pointers, the composition index and getGeneration() stay valid. Falls back
+    // to reload() when the pack does not cover the active language
+    void relocalize();
+
+    // Phase 64: Hot-reload, applied between ticks. Elements keep their atomic-number slots;
+    // if the new set fails validation the old table is kept and the error rethrown
+    void applyElements(const std::vector<Element>& loaded);
+    void applyMolecules(std::vector<Molecule> loaded);
+
     // Get an element by its atomic number (O(1) Direct Access)
     const Element& getElement(int atomicNumber) const;
     
@@ -32,7 +43,9 @@ public:
     
     // Molecule Management
     const Molecule* findMoleculeByComposition(const std::map<int, int>& composition) const;
+    const Molecule* findMoleculeByKey(const CompositionKey& key) const;  // Phase 49: O(1) hashed lookup
     const std::vector<Molecule>& getAllMolecules() const { return molecules; }
+    int getGeneration() const { return generation; }  // Bumped by reload(): Molecule pointers are invalidated
 
     // Discovery & Spawning
     std::vector<int> getSpawnableAtomicNumbers() const;
@@ -56,6 +69,12 @@ private:
     
     // Fast lookup map by Symbol
     std::unordered_map<std::string, int> symbolToId;
+
+    // Phase 49: Flat open-addressing table (linear probing) of molecule indices, built in reload()
+    std::vector<CompositionKey> moleculeKeys;  // Parallel to molecules
+    std::vector<int> compositionTable;         // -1 = empty slot
+    void rebuildCompositionIndex();
+    int generation = 0;
     
     void addElement(Element e);
     void addMolecule(Molecule m);
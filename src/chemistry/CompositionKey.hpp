@@ -0,0 +1,71 @@
+#ifndef COMPOSITION_KEY_HPP
+#define COMPOSITION_KEY_HPP
+
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * CompositionKey (Phase 49)
+ * Canonical molecule composition: (Z << 32 | count) pairs sorted by Z, plus a
+ * 64-bit hash of that sequence. Two compositions are equal iff their packed
+ * vectors are equal, so the hash is only used to find the table slot. Counts
+ * get a full 32 bits, so large streamed molecules cannot alias a small one.
+ */
+struct CompositionKey {
+    std::vector<uint64_t> packed;
+    uint64_t hash = 0;
+    int atomCount = 0;
+
+    static uint64_t pack(int atomicNumber, int count) {
+        return ((uint64_t)(uint32_t)atomicNumber << 32) | (uint32_t)count;
+    }
+    static int unpackElement(uint64_t p) { return (int)(p >> 32); }
+    static int unpackCount(uint64_t p) { return (int)(uint32_t)p; }
+
+    static CompositionKey fromMap(const std::map<int, int>& composition) {
+        CompositionKey key;
+        for (const auto& [z, count] : composition) {
+            if (count <= 0) continue;
+            key.packed.push_back(pack(z, count));  // std::map is already sorted by Z
+            key.atomCount += count;
+        }
+        key.rehash();
+        return key;
+    }
+
+    // counts[Z] = number of atoms of element Z (dense histogram)
+    static CompositionKey fromCounts(const std::vector<int>& counts) {
+        CompositionKey key;
+        for (int z = 0; z < (int)counts.size(); z++) {
+            if (counts[z] <= 0) continue;
+            key.packed.push_back(pack(z, counts[z]));
+            key.atomCount += counts[z];
+        }
+        key.rehash();
+        return key;
+    }
+
+    void rehash() {
+        uint64_t h = 0x9E3779B97F4A7C15ull ^ packed.size();
+        for (uint64_t p : packed) {
+            h ^= p;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+        }
+        hash = h;
+    }
+
+    std::map<int, int> toMap() const {
+        std::map<int, int> composition;
+        for (uint64_t p : packed) composition[unpackElement(p)] = unpackCount(p);
+        return composition;
+    }
+
+    bool empty() const { return packed.empty(); }
+    bool operator==(const CompositionKey& other) const { return hash == other.hash && packed == other.packed; }
+    bool operator!=(const CompositionKey& other) const { return !(*this == other); }
+};
+
+#endif // COMPOSITION_KEY_HPP
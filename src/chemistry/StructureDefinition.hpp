@@ -5,6 +5,7 @@
 #include <vector>
 #include <cmath>
 #include "raylib.h"
+#include "StructureTemplate.hpp"
 
 struct StructureDefinition {
     std::string name;              // e.g., "carbon_square"
@@ -20,6 +21,8 @@ struct StructureDefinition {
     float rotationOffset;          // Global rotation in radians
     bool isPlanar;                 // Force Z=0?
     bool instantFormation;         // true = snap immediately
+    StructureTemplate graph;       // Phase 48: labelled bond graph (legacy defs become uniform rings)
+    std::vector<Vector2> idealOffsets;  // Phase 64: getIdealOffsets(BOND_IDEAL_DIST), kept by StructureRegistry
     
     // Calculates the ideal vertex positions for a regular polygon around (0,0)
     // with a given side length (bond distance)
@@ -1,6 +1,9 @@
 #include "StructureRegistry.hpp"
 #include "../core/JsonLoader.hpp"
+#include "../core/DataPack.hpp"
+#include "../core/Config.hpp"
 #include "raylib.h"
+#include <algorithm>
 
 StructureRegistry& StructureRegistry::getInstance() {
     static StructureRegistry instance;
@@ -9,15 +12,29 @@ StructureRegistry& StructureRegistry::getInstance() {
 
 void StructureRegistry::loadFromDisk(const std::string& path) {
     try {
-        structures = JsonLoader::loadStructures(path);
+        const DataPack& pack = DataPack::getInstance();
+        replaceStructures(pack.covers(path) ? pack.loadStructures() : JsonLoader::loadStructures(path));  // Phase 63
         TraceLog(LOG_INFO, "[STRUCTURES] Loaded %d structure definitions from %s", (int)structures.size(), path.c_str());
     } catch (const std::exception& e) {
         TraceLog(LOG_ERROR, "[STRUCTURES] Failed to load %s: %s", path.c_str(), e.what());
     }
 }
 
+void StructureRegistry::replaceStructures(std::vector<StructureDefinition> defs) {
+    structures = std::move(defs);
+    generation++;
+    rebuildIndex();
+}
+
 void StructureRegistry::registerStructure(const StructureDefinition& def) {
     structures.push_back(def);
+    StructureDefinition& added = structures.back();
+    if (!added.graph.valid) {
+        if (added.graph.labels.empty()) added.graph = StructureTemplate::makeRing(added.atomCount, added.atomicNumber);
+        added.graph.finalize();
+    }
+    generation++;
+    rebuildIndex();
 }
 
 const StructureDefinition* StructureRegistry::findMatch(int atomCount, int atomicNumber) const {
@@ -30,3 +47,31 @@ const StructureDefinition* StructureRegistry::findMatch(int atomCount, int atomi
     }
     return nullptr;
 }
+
+void StructureRegistry::rebuildIndex() {
+    ringIndex.clear();
+    for (int i = 0; i < (int)structures.size(); i++) {
+        structures[i].idealOffsets = structures[i].getIdealOffsets(Config::BOND_IDEAL_DIST);
+        const StructureTemplate& g = structures[i].graph;
+        if (g.valid && g.isRing) ringIndex.insert({g.canonicalHash, i});
+    }
+}
+
+const StructureDefinition* StructureRegistry::findRingMatch(const std::vector<int>& ringLabels) const {
+    if (ringLabels.empty()) return nullptr;
+
+    std::vector<int> canonical = StructureTemplate::canonicalRing(ringLabels);
+    auto range = ringIndex.equal_range(StructureTemplate::hashSequence(canonical));
+    for (auto it = range.first; it != range.second; ++it) {
+        const StructureDefinition& def = structures[it->second];
+        if (def.graph.ringSequence == canonical) return &def;  // Guard against hash collisions
+    }
+
+    // Wildcard rings (label 0) cannot be hashed exactly
+    for (const auto& s : structures) {
+        if (!s.graph.isRing || s.graph.size() != (int)ringLabels.size()) continue;
+        bool wildcard = std::all_of(s.graph.labels.begin(), s.graph.labels.end(), [](int z) { return z == 0; });
+        if (wildcard) return &s;
+    }
+    return nullptr;
+}
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include "StructureDefinition.hpp"
 
 class StructureRegistry {
@@ -12,6 +13,9 @@ public:
     // Loads definitions from JSON
     void loadFromDisk(const std::string& path);
 
+    // Phase 64: Swaps in a freshly loaded definition set (hot-reload, between ticks)
+    void replaceStructures(std::vector<StructureDefinition> defs);
+
     // Manual registration (backup/debug)
     void registerStructure(const StructureDefinition& def);
 
@@ -19,10 +23,17 @@ public:
     // returns nullptr if no match found
     const StructureDefinition* findMatch(int atomCount, int atomicNumber) const;
 
+    // Phase 48: Ring lookup by element sequence (any rotation/direction) via canonical hash.
+    // Wildcard rings (atomicNumber 0) match any sequence of their size.
+    const StructureDefinition* findRingMatch(const std::vector<int>& ringLabels) const;
+
     // Checks if an atom is part of a specific structure (by ID and type)
     // For now, we mainly use findMatch for formation.
     
     const std::vector<StructureDefinition>& getAllStructures() const { return structures; }
+
+    // Bumped whenever the definition set changes (invalidates detection caches)
+    int getGeneration() const { return generation; }
     
     // Override instantFormation for all structures (for testing/animation mode)
     void setInstantFormation(bool instant) {
@@ -34,6 +45,10 @@ public:
 private:
     StructureRegistry() = default;
     std::vector<StructureDefinition> structures;
+    int generation = 0;
+    std::unordered_multimap<uint64_t, int> ringIndex;  // canonical ring hash -> structures[] index
+
+    void rebuildIndex();
 
     // Disable copy
     StructureRegistry(const StructureRegistry&) = delete;
@@ -0,0 +1,214 @@
+#ifndef STRUCTURE_TEMPLATE_HPP
+#define STRUCTURE_TEMPLATE_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * StructureTemplate (Phase 48)
+ * Small labelled graph describing a structure: node labels are atomic numbers
+ * (0 = any element), edges are bonds. A match maps a spanning tree of the
+ * template onto bonds that already exist and forms the remaining (closure)
+ * edges as cycle bonds. finalize() enumerates the valid spanning trees, so a
+ * ring matches whichever of its bonds is still open, and precomputes the
+ * match orders used by StructureMatcher.
+ */
+struct StructureTemplate {
+    static constexpr int MAX_VARIANTS = 64;   // Cap on spanning trees kept per template
+
+    // One way of splitting the edges into existing bonds (tree) and bonds to form (closures)
+    struct SpanningVariant {
+        std::vector<std::vector<int>> treeAdjacency;
+        std::vector<std::pair<int, int>> closureEdges;
+        std::vector<bool> isClosureEndpoint;
+        std::vector<std::vector<int>> matchOrder;    // matchOrder[start]: BFS over tree edges from start
+        std::vector<std::vector<int>> matchParent;   // Earlier tree neighbour of each node for that start
+    };
+
+    std::vector<int> labels;                  // Atomic number per node (0 = wildcard)
+    std::vector<std::pair<int, int>> edges;   // Undirected bonds between nodes
+    bool reorganize = false;                  // Legacy angle-sort fallback (uniform rings from old JSON)
+    bool allowRingAtoms = false;              // Fused rings / ladders may reuse atoms already in a ring
+
+    // === Derived by finalize() ===
+    bool valid = false;
+    bool isRing = false;                      // Single simple cycle
+    int anchor = -1;                          // Rarest label, highest degree: unanchored search start
+    uint64_t canonicalHash = 0;               // Rings only: canonical sequence hash (registry ring index)
+    std::vector<int> ringSequence;            // Canonical cyclic labels (rings only)
+    std::vector<SpanningVariant> variants;
+
+    int size() const { return (int)labels.size(); }
+
+    static bool labelMatches(int templateLabel, int atomicNumber) {
+        return templateLabel == 0 || templateLabel == atomicNumber;
+    }
+
+    static uint64_t hashSequence(const std::vector<int>& seq) {
+        uint64_t h = 1469598103934665603ull;  // FNV-1a
+        for (int v : seq) {
+            h ^= (uint64_t)(uint32_t)v;
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    // Lexicographically smallest rotation/reflection: equal for every way of walking the same ring
+    static std::vector<int> canonicalRing(const std::vector<int>& cyclic) {
+        int n = (int)cyclic.size();
+        std::vector<int> best = cyclic, cand(n);
+        for (int dir = 0; dir < 2; dir++) {
+            for (int s = 0; s < n; s++) {
+                for (int k = 0; k < n; k++) {
+                    int idx = dir == 0 ? (s + k) % n : (s - k + n) % n;
+                    cand[k] = cyclic[idx];
+                }
+                if (cand < best) best = cand;
+            }
+        }
+        return best;
+    }
+
+    static uint64_t ringHash(const std::vector<int>& cyclic) {
+        return hashSequence(canonicalRing(cyclic));
+    }
+
+    static StructureTemplate makeRing(int n, int atomicNumber) {
+        StructureTemplate t;
+        t.labels.assign(n, atomicNumber);
+        for (int i = 0; i < n; i++) t.edges.push_back({i, (i + 1) % n});
+        t.reorganize = true;
+        return t;
+    }
+
+    // Returns false for empty/disconnected graphs or when no spanning tree leaves
+    // at most one closure per node (StateComponent holds a single cycleBondId)
+    bool finalize() {
+        int n = size();
+        int e = (int)edges.size();
+        valid = false;
+        variants.clear();
+        if (n == 0) return false;
+
+        std::vector<std::vector<int>> adj(n);
+        for (auto& ed : edges) {
+            if (ed.first < 0 || ed.second < 0 || ed.first >= n || ed.second >= n || ed.first == ed.second) return false;
+            adj[ed.first].push_back(ed.second);
+            adj[ed.second].push_back(ed.first);
+        }
+
+        // Anchor: rarest label, then highest degree (fewest candidates in a molecule)
+        anchor = 0;
+        auto rarity = [&](int node) {
+            return (int)std::count(labels.begin(), labels.end(), labels[node]) * 16 - (int)adj[node].size();
+        };
+        for (int i = 1; i < n; i++) {
+            if (rarity(i) < rarity(anchor)) anchor = i;
+        }
+
+        // Connectivity
+        std::vector<bool> seen(n, false);
+        std::vector<int> queue = { anchor };
+        seen[anchor] = true;
+        for (size_t h = 0; h < queue.size(); h++) {
+            for (int v : adj[queue[h]]) {
+                if (!seen[v]) { seen[v] = true; queue.push_back(v); }
+            }
+        }
+        if ((int)queue.size() != n) return false;
+
+        // Enumerate closure sets: choose (e - n + 1) edges whose removal leaves a spanning tree
+        int closures = e - n + 1;
+        std::vector<int> pick;
+        enumerateClosures(0, closures, pick);
+        if (variants.empty()) return false;
+
+        // Canonical hash (rings only; other graphs are found by anchored matching)
+        isRing = (n >= 3 && (int)edges.size() == n);
+        for (int i = 0; i < n && isRing; i++) isRing = (adj[i].size() == 2);
+        ringSequence.clear();
+        if (isRing) {
+            std::vector<int> cyclic;
+            int prev = -1, curr = 0;
+            for (int k = 0; k < n; k++) {
+                cyclic.push_back(labels[curr]);
+                int next = (adj[curr][0] != prev) ? adj[curr][0] : adj[curr][1];
+                prev = curr;
+                curr = next;
+            }
+            ringSequence = canonicalRing(cyclic);
+            canonicalHash = hashSequence(ringSequence);
+        } else {
+            canonicalHash = 0;
+        }
+
+        valid = true;
+        return true;
+    }
+
+private:
+    void enumerateClosures(int from, int remaining, std::vector<int>& pick) {
+        if ((int)variants.size() >= MAX_VARIANTS) return;
+        if (remaining == 0) {
+            addVariant(pick);
+            return;
+        }
+        for (int i = from; i <= (int)edges.size() - remaining; i++) {
+            pick.push_back(i);
+            enumerateClosures(i + 1, remaining - 1, pick);
+            pick.pop_back();
+        }
+    }
+
+    void addVariant(const std::vector<int>& closureIdx) {
+        int n = size();
+        SpanningVariant v;
+        v.treeAdjacency.assign(n, {});
+        v.isClosureEndpoint.assign(n, false);
+
+        std::vector<bool> isClosure(edges.size(), false);
+        for (int idx : closureIdx) {
+            const auto& ed = edges[idx];
+            if (v.isClosureEndpoint[ed.first] || v.isClosureEndpoint[ed.second]) return;
+            v.isClosureEndpoint[ed.first] = v.isClosureEndpoint[ed.second] = true;
+            v.closureEdges.push_back(ed);
+            isClosure[idx] = true;
+        }
+
+        // Remaining n-1 edges must connect every node (union-find: no cycle allowed)
+        std::vector<int> root(n);
+        for (int i = 0; i < n; i++) root[i] = i;
+        auto find = [&](int x) { while (root[x] != x) x = root[x] = root[root[x]]; return x; };
+        for (int i = 0; i < (int)edges.size(); i++) {
+            if (isClosure[i]) continue;
+            int a = find(edges[i].first), b = find(edges[i].second);
+            if (a == b) return;
+            root[a] = b;
+            v.treeAdjacency[edges[i].first].push_back(edges[i].second);
+            v.treeAdjacency[edges[i].second].push_back(edges[i].first);
+        }
+
+        // Match orders from every start node (templates are small: O(n^2))
+        v.matchOrder.assign(n, {});
+        v.matchParent.assign(n, std::vector<int>(n, -1));
+        for (int s = 0; s < n; s++) {
+            std::vector<bool> vis(n, false);
+            v.matchOrder[s] = { s };
+            vis[s] = true;
+            for (size_t h = 0; h < v.matchOrder[s].size(); h++) {
+                int u = v.matchOrder[s][h];
+                for (int w : v.treeAdjacency[u]) {
+                    if (vis[w]) continue;
+                    vis[w] = true;
+                    v.matchParent[s][w] = u;
+                    v.matchOrder[s].push_back(w);
+                }
+            }
+        }
+        variants.push_back(std::move(v));
+    }
+};
+
+#endif // STRUCTURE_TEMPLATE_HPP
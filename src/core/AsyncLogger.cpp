@@ -0,0 +1,421 @@
+#include "AsyncLogger.hpp"
+#include <chrono>
+#include <cstring>
+#include <cctype>
+#include <cstdint>
+#include <algorithm>
+
+namespace {
+    enum Length { LEN_NONE, LEN_HH, LEN_H, LEN_L, LEN_LL, LEN_J, LEN_Z, LEN_T, LEN_BIG_L };
+
+    struct Spec {
+        const char* start;     // The '%'
+        const char* lengthAt;  // First length modifier (or the conversion)
+        const char* end;       // Past the conversion character
+        int stars;             // '*' width / precision, each an int argument
+        Length length;
+        char conversion;
+    };
+
+    // `p` points at a '%' that is not "%%". False if the format ends inside the spec
+    bool parseSpec(const char* p, Spec& s) {
+        s.start = p++;
+        s.stars = 0;
+        while (*p && std::strchr("-+ #0", *p)) p++;
+        if (*p == '*') { s.stars++; p++; }
+        else while (std::isdigit((unsigned char)*p)) p++;
+        if (*p == '.') {
+            p++;
+            if (*p == '*') { s.stars++; p++; }
+            else while (std::isdigit((unsigned char)*p)) p++;
+        }
+        s.lengthAt = p;
+        s.length = LEN_NONE;
+        switch (*p) {
+            case 'h': p++; if (*p == 'h') { p++; s.length = LEN_HH; } else s.length = LEN_H; break;
+            case 'l': p++; if (*p == 'l') { p++; s.length = LEN_LL; } else s.length = LEN_L; break;
+            case 'j': p++; s.length = LEN_J; break;
+            case 'z': p++; s.length = LEN_Z; break;
+            case 't': p++; s.length = LEN_T; break;
+            case 'L': p++; s.length = LEN_BIG_L; break;
+            default: break;
+        }
+        if (!*p) return false;
+        s.conversion = *p;
+        s.end = p + 1;
+        return true;
+    }
+
+    bool isSigned(char c) { return c == 'd' || c == 'i'; }
+    bool isUnsigned(char c) { return c == 'u' || c == 'o' || c == 'x' || c == 'X'; }
+    bool isFloat(char c) { return std::strchr("fFeEgGaA", c) != nullptr; }
+
+    // "[TAG]" prefix of a format; an untagged format is its own category (its leading text)
+    void extractTag(const char* format, char* out, int maxLength) {
+        int n = 0;
+        if (format[0] == '[') {
+            while (format[n] && format[n] != ']' && n < maxLength - 1) { out[n] = format[n]; n++; }
+            if (format[n] == ']') out[n++] = ']';
+        } else {
+            while (format[n] && n < maxLength - 1) { out[n] = format[n]; n++; }
+        }
+        out[n] = '\0';
+    }
+
+    uint32_t hashTag(const char* tag) {
+        uint32_t h = 2166136261u;  // FNV-1a
+        for (; *tag; tag++) { h ^= (uint8_t)*tag; h *= 16777619u; }
+        return h;
+    }
+
+    const char* levelName(int level) {
+        static const char* names[] = { "ALL", "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "FATAL", "NONE" };
+        return (level >= 0 && level <= 7) ? names[level] : "LOG";
+    }
+}
+
+AsyncLogger& AsyncLogger::getInstance() {
+    static AsyncLogger instance;
+    return instance;
+}
+
+AsyncLogger::AsyncLogger() {
+    size_t capacity = 2;
+    while (capacity < (size_t)Config::LOG_RING_CAPACITY) capacity <<= 1;
+    slots.reset(new Slot[capacity]);
+    mask = capacity - 1;
+    for (size_t i = 0; i < capacity; i++) slots[i].sequence.store(i, std::memory_order_relaxed);
+    std::strcpy(overflowBudget.tag, "(other)");
+    overflowBudget.tagState.store(2, std::memory_order_relaxed);
+}
+
+AsyncLogger::~AsyncLogger() {
+    stop();
+}
+
+bool AsyncLogger::start(const std::string& path, bool echoToConsole) {
+    stop();
+    echo = echoToConsole;
+    file = std::fopen(path.c_str(), "w");
+    if (file) {
+        std::fprintf(file, "=== LIFE SIMULATOR SESSION LOG ===\n");
+        std::fflush(file);
+    }
+    running.store(true, std::memory_order_release);
+    writer = std::thread(&AsyncLogger::run, this);
+    return file != nullptr;
+}
+
+void AsyncLogger::stop() {
+    if (writer.joinable()) {
+        running.store(false, std::memory_order_release);
+        writer.join();  // The writer drains the ring before it exits
+    }
+    reportDrops();
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+void AsyncLogger::traceLogCallback(int level, const char* text, va_list args) {
+    getInstance().logv(level, text, args);
+}
+
+void AsyncLogger::log(int level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    logv(level, format, args);
+    va_end(args);
+}
+
+void AsyncLogger::logv(int level, const char* format, va_list args) {
+    if (!admit(level, format)) return;
+    dispatchv(level, format, args);
+    if (level >= LOG_FATAL) flush();
+}
+
+void AsyncLogger::dispatch(int level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    dispatchv(level, format, args);
+    va_end(args);
+}
+
+void AsyncLogger::dispatchv(int level, const char* format, va_list args) {
+    if (running.load(std::memory_order_acquire)) {
+        if (!enqueue(level, format, args)) overflowed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // No writer thread: format here
+    LogRecord record;
+    capture(record, level, format, args);
+    char line[1024];
+    formatRecord(record, line, sizeof(line));
+    emit(level, line);
+    if (file) std::fflush(file);
+}
+
+// The budget owned by `tag`: linear probing from its hash, claiming the first free bucket.
+// Buckets are never released, so a tag keeps its bucket for the process lifetime.
+AsyncLogger::TagBudget& AsyncLogger::findBudget(const char* tag) {
+    uint32_t home = hashTag(tag);
+    for (int probe = 0; probe < TAG_BUCKETS; probe++) {
+        TagBudget& budget = budgets[(home + probe) & (TAG_BUCKETS - 1)];
+        int state = budget.tagState.load(std::memory_order_acquire);
+        if (state == 0) {
+            int expected = 0;
+            if (budget.tagState.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+                std::memcpy(budget.tag, tag, MAX_TAG + 1);
+                budget.tagState.store(2, std::memory_order_release);
+                return budget;
+            }
+            state = expected;
+        }
+        while (state == 1) state = budget.tagState.load(std::memory_order_acquire);  // Claimed; tag being copied
+        if (std::strncmp(budget.tag, tag, MAX_TAG + 1) == 0) return budget;
+    }
+    return overflowBudget;  // Every bucket names another tag
+}
+
+// Lock-free one-second budget per "[TAG]"; errors always pass
+bool AsyncLogger::admit(int level, const char* format) {
+    if (level >= LOG_ERROR) return true;
+    char tag[MAX_TAG + 1];
+    extractTag(format, tag, MAX_TAG + 1);
+    TagBudget& budget = findBudget(tag);
+    if (&budget == &overflowBudget) std::strcpy(tag, overflowBudget.tag);
+
+    using namespace std::chrono;
+    long long second = duration_cast<seconds>(steady_clock::now().time_since_epoch()).count();
+    long long window = budget.window.load(std::memory_order_relaxed);
+    if (window != second && budget.window.compare_exchange_strong(window, second, std::memory_order_acq_rel)) {
+        budget.used.store(0, std::memory_order_relaxed);
+        int dropped = budget.dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) dispatch(LOG_WARNING, "[LOG] Rate limit: %d '%s' lines dropped in one second", dropped, tag);
+    }
+    if (budget.used.fetch_add(1, std::memory_order_relaxed) < Config::LOG_CATEGORY_RATE) return true;
+    budget.dropped.fetch_add(1, std::memory_order_relaxed);
+    rateLimited.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+// Copies every argument the format consumes; numbers widen to 64 bits, strings are copied
+void AsyncLogger::capture(LogRecord& record, int level, const char* format, va_list args) {
+    record.level = level;
+    record.format = format;
+    record.argCount = 0;
+    record.truncated = false;
+    size_t stringsUsed = 0;
+
+    va_list ap;
+    va_copy(ap, args);
+    for (const char* p = format; *p; ) {
+        if (*p != '%') { p++; continue; }
+        if (p[1] == '%') { p += 2; continue; }
+        Spec s;
+        if (!parseSpec(p, s)) break;
+        p = s.end;
+        char c = s.conversion;
+        bool known = isSigned(c) || isUnsigned(c) || isFloat(c) || c == 'c' || c == 's' || c == 'p' || c == 'n';
+        int needed = s.stars + (c == 'n' ? 0 : 1);
+        if (!known || record.argCount + needed > MAX_ARGS) {
+            record.truncated = true;
+            break;
+        }
+
+        for (int k = 0; k < s.stars; k++) record.args[record.argCount++].i = va_arg(ap, int);
+        LogArg& arg = record.args[record.argCount];
+        if (isSigned(c)) {
+            switch (s.length) {
+                case LEN_L: arg.i = va_arg(ap, long); break;
+                case LEN_LL: arg.i = va_arg(ap, long long); break;
+                case LEN_J: arg.i = (long long)va_arg(ap, intmax_t); break;
+                case LEN_Z: case LEN_T: arg.i = (long long)va_arg(ap, ptrdiff_t); break;
+                default: arg.i = va_arg(ap, int); break;
+            }
+        } else if (isUnsigned(c)) {
+            switch (s.length) {
+                case LEN_L: arg.u = va_arg(ap, unsigned long); break;
+                case LEN_LL: arg.u = va_arg(ap, unsigned long long); break;
+                case LEN_J: arg.u = (unsigned long long)va_arg(ap, uintmax_t); break;
+                case LEN_Z: arg.u = (unsigned long long)va_arg(ap, size_t); break;
+                case LEN_T: arg.u = (unsigned long long)va_arg(ap, ptrdiff_t); break;
+                default: arg.u = va_arg(ap, unsigned int); break;
+            }
+        } else if (isFloat(c)) {
+            arg.d = s.length == LEN_BIG_L ? (double)va_arg(ap, long double) : va_arg(ap, double);
+        } else if (c == 'c') {
+            arg.i = va_arg(ap, int);
+        } else if (c == 's') {
+            const char* str = va_arg(ap, const char*);
+            if (!str) str = "(null)";
+            size_t room = STRING_BYTES - stringsUsed;
+            size_t n = room > 0 ? std::min(std::strlen(str), room - 1) : 0;
+            arg.u = stringsUsed;
+            if (room > 0) {
+                std::memcpy(record.strings + stringsUsed, str, n);
+                record.strings[stringsUsed + n] = '\0';
+                stringsUsed += n + 1;
+            } else {
+                arg.u = STRING_BYTES - 1;  // Out of room: shares the last (empty) byte
+                record.strings[STRING_BYTES - 1] = '\0';
+            }
+        } else if (c == 'p') {
+            arg.p = va_arg(ap, const void*);
+        } else {  // %n writes nothing into a log line
+            (void)va_arg(ap, int*);
+            continue;
+        }
+        record.argCount++;
+    }
+    va_end(ap);
+}
+
+// Re-walks the format, printing each spec with its captured (widened) argument
+void AsyncLogger::formatRecord(const LogRecord& record, char* out, size_t capacity) {
+    size_t length = 0;
+    auto append = [&](const char* text, size_t n) {
+        n = std::min(n, capacity - 1 - length);
+        std::memcpy(out + length, text, n);
+        length += n;
+    };
+
+    int argIndex = 0;
+    for (const char* p = record.format; *p && length < capacity - 1; ) {
+        if (*p != '%') {
+            const char* q = p;
+            while (*q && *q != '%') q++;
+            append(p, (size_t)(q - p));
+            p = q;
+            continue;
+        }
+        if (p[1] == '%') { append("%", 1); p += 2; continue; }
+        Spec s;
+        if (!parseSpec(p, s)) { append(p, std::strlen(p)); break; }
+        char c = s.conversion;
+        int needed = s.stars + (c == 'n' ? 0 : 1);
+        if (argIndex + needed > record.argCount) {
+            if (record.truncated) append("...", 3);
+            break;
+        }
+
+        // Flags, width and precision as written ('*' replaced by its value), then a 64-bit length
+        char spec[64];
+        size_t sl = 0;
+        for (const char* q = s.start; q < s.lengthAt && sl < 40; q++) {
+            if (*q == '*') sl += (size_t)std::snprintf(spec + sl, sizeof(spec) - sl, "%d", (int)record.args[argIndex++].i);
+            else spec[sl++] = *q;
+        }
+        if (isSigned(c) || isUnsigned(c)) { spec[sl++] = 'l'; spec[sl++] = 'l'; }
+        spec[sl++] = c;
+        spec[sl] = '\0';
+
+        char piece[512];
+        int n = 0;
+        const LogArg& arg = record.args[argIndex];
+        if (isSigned(c)) n = std::snprintf(piece, sizeof(piece), spec, arg.i);
+        else if (isUnsigned(c)) n = std::snprintf(piece, sizeof(piece), spec, arg.u);
+        else if (isFloat(c)) n = std::snprintf(piece, sizeof(piece), spec, arg.d);
+        else if (c == 'c') n = std::snprintf(piece, sizeof(piece), spec, (int)arg.i);
+        else if (c == 's') n = std::snprintf(piece, sizeof(piece), spec, record.strings + arg.u);
+        else if (c == 'p') n = std::snprintf(piece, sizeof(piece), spec, arg.p);
+        if (c != 'n') argIndex++;
+        if (n > 0) append(piece, std::min((size_t)n, sizeof(piece) - 1));
+        p = s.end;
+    }
+    out[length] = '\0';
+}
+
+bool AsyncLogger::enqueue(int level, const char* format, va_list args) {
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+        slot = &slots[pos & mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;  // Full: the writer is a whole ring behind
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    capture(slot->record, level, format, args);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncLogger::drainOne() {
+    size_t pos = consumed.load(std::memory_order_relaxed);
+    Slot& slot = slots[pos & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1) return false;
+    char line[1024];
+    formatRecord(slot.record, line, sizeof(line));
+    emit(slot.record.level, line);
+    slot.sequence.store(pos + mask + 1, std::memory_order_release);
+    consumed.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncLogger::drainBatch() {
+    bool any = false;
+    while (drainOne()) any = true;
+    long long lost = overflowed.load(std::memory_order_relaxed);
+    if (lost != overflowReported) {
+        char line[128];
+        std::snprintf(line, sizeof(line), "[LOG] Ring full: %lld lines dropped", lost - overflowReported);
+        emit(LOG_WARNING, line);
+        overflowReported = lost;
+        any = true;
+    }
+    if (any) {
+        if (file) std::fflush(file);
+        if (echo) std::fflush(stdout);
+    }
+    return any;
+}
+
+void AsyncLogger::run() {
+    while (running.load(std::memory_order_acquire)) {
+        if (!drainBatch()) std::this_thread::sleep_for(std::chrono::milliseconds(Config::LOG_IDLE_SLEEP_MS));
+    }
+    drainBatch();
+}
+
+void AsyncLogger::flush() {
+    if (writer.joinable()) {
+        size_t target = enqueuePos.load(std::memory_order_acquire);
+        while (consumed.load(std::memory_order_acquire) < target && running.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    if (file) std::fflush(file);
+}
+
+void AsyncLogger::emit(int level, const char* text) {
+    if (file) std::fprintf(file, "[%s] %s\n", levelName(level), text);
+    if (echo) std::printf("[%s] %s\n", levelName(level), text);
+    written.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Drops still counted in an open window (at shutdown)
+void AsyncLogger::reportDrops() {
+    auto report = [&](TagBudget& budget) {
+        int dropped = budget.dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped <= 0) return;
+        const char* tag = budget.tagState.load(std::memory_order_acquire) == 2 ? budget.tag : "?";
+        dispatch(LOG_WARNING, "[LOG] Rate limit: %d '%s' lines dropped in one second", dropped, tag);
+    };
+    for (TagBudget& budget : budgets) report(budget);
+    report(overflowBudget);
+}
+
+AsyncLoggerStats AsyncLogger::getStats() const {
+    AsyncLoggerStats stats;
+    stats.written = written.load(std::memory_order_relaxed);
+    stats.rateLimited = rateLimited.load(std::memory_order_relaxed);
+    stats.overflowed = overflowed.load(std::memory_order_relaxed);
+    return stats;
+}
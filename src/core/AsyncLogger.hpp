@@ -0,0 +1,138 @@
+#ifndef ASYNC_LOGGER_HPP
+#define ASYNC_LOGGER_HPP
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include "Config.hpp"
+#include "raylib.h"
+
+// Phase 65: Logging that is compiled out below Config::LOG_COMPILED_MIN_LEVEL
+// (arguments are not evaluated either). Use it for per-atom / per-bond lines.
+#define SIM_LOG(level, ...) \
+    do { if constexpr ((level) >= Config::LOG_COMPILED_MIN_LEVEL) TraceLog((level), __VA_ARGS__); } while (0)
+
+struct AsyncLoggerStats {
+    long long written = 0;       // Lines formatted by the writer (or synchronously)
+    long long rateLimited = 0;   // Dropped by the per-tag budget
+    long long overflowed = 0;    // Dropped because the ring was full
+};
+
+/**
+ * AsyncLogger (Phase 65)
+ * TraceLog backend. Producers never format and never touch a file: the
+ * callback walks the format string once to copy its arguments (numbers as
+ * 64-bit values, %s strings into the record) into a slot of a bounded
+ * lock-free ring (Vyukov MPMC sequence numbers, used here as MPSC). A writer
+ * thread formats the records with the original format pointer and writes
+ * them to the log file and console, flushing once per drained batch.
+ *
+ * Format strings must outlive the process (string literals, as every
+ * TraceLog call uses). A full ring drops the record rather than wait.
+ *
+ * Each leading "[TAG]" of a format is a category with a budget of
+ * Config::LOG_CATEGORY_RATE records per second below LOG_ERROR; the rest of
+ * that second is counted and reported as one line. An untagged format is a
+ * category of its own. Tags own their bucket (stored and compared, probing
+ * on collision); only once all TAG_BUCKETS are claimed do new tags share one. LOG_FATAL is written
+ * synchronously before returning (the caller usually exits).
+ *
+ * Before start() and after stop() records are formatted in place.
+ */
+class AsyncLogger {
+public:
+    static AsyncLogger& getInstance();
+
+    // Opens `path` (truncated) and starts the writer thread
+    bool start(const std::string& path, bool echoToConsole = true);
+    // Drains the ring, reports pending rate-limit drops, joins and closes
+    void stop();
+
+    void log(int level, const char* format, ...);
+    void logv(int level, const char* format, va_list args);
+
+    // Blocks until everything enqueued so far is written
+    void flush();
+
+    AsyncLoggerStats getStats() const;
+
+    // For SetTraceLogCallback
+    static void traceLogCallback(int level, const char* text, va_list args);
+
+    ~AsyncLogger();
+
+private:
+    static constexpr int MAX_ARGS = 12;
+    static constexpr int STRING_BYTES = 192;
+    static constexpr int TAG_BUCKETS = 128;  // Power of two; open addressing by tag
+    static constexpr int MAX_TAG = 24;
+
+    union LogArg {
+        long long i;
+        unsigned long long u;
+        double d;
+        const void* p;
+    };
+
+    struct LogRecord {
+        int level = 0;
+        const char* format = nullptr;
+        uint8_t argCount = 0;
+        bool truncated = false;  // Arguments beyond MAX_ARGS were not captured
+        LogArg args[MAX_ARGS];
+        char strings[STRING_BYTES];  // %s arguments, NUL-separated; args[k].u is the offset
+    };
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        LogRecord record;
+    };
+
+    // Per-"[TAG]" one-second budget
+    struct TagBudget {
+        std::atomic<long long> window{-1};
+        std::atomic<int> used{0};
+        std::atomic<int> dropped{0};
+        std::atomic<int> tagState{0};  // 0 unnamed, 1 being written, 2 readable
+        char tag[MAX_TAG + 1] = {0};
+    };
+
+    AsyncLogger();
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask = 0;
+    std::atomic<size_t> enqueuePos{0};
+    std::atomic<size_t> consumed{0};     // Records taken by the writer (dequeue position)
+    TagBudget budgets[TAG_BUCKETS];
+    TagBudget overflowBudget;            // Shared once every bucket is claimed
+
+    std::atomic<bool> running{false};
+    std::thread writer;
+    FILE* file = nullptr;
+    bool echo = true;
+
+    std::atomic<long long> written{0};
+    std::atomic<long long> rateLimited{0};
+    std::atomic<long long> overflowed{0};
+    long long overflowReported = 0;      // Writer thread only
+
+    TagBudget& findBudget(const char* tag);
+    bool admit(int level, const char* format);
+    static void capture(LogRecord& record, int level, const char* format, va_list args);
+    static void formatRecord(const LogRecord& record, char* out, size_t capacity);
+    void dispatch(int level, const char* format, ...);
+    void dispatchv(int level, const char* format, va_list args);
+    bool enqueue(int level, const char* format, va_list args);
+    bool drainOne();
+    bool drainBatch();
+    void emit(int level, const char* text);
+    void reportDrops();
+    void run();
+};
+
+#endif // ASYNC_LOGGER_HPP
@@ -0,0 +1,186 @@
+#ifndef BINARY_IO_HPP
+#define BINARY_IO_HPP
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+
+/**
+ * BinaryIO (Phase 52)
+ * Little helpers for the engine's binary formats: a growable byte buffer
+ * writer and a bounds-checked reader. Only trivially copyable values are
+ * accepted, written in native byte order (the formats are machine-local
+ * caches, not interchange files).
+ */
+class BinaryWriter {
+public:
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter::write needs a POD value");
+        writeBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void writeArray(const T* values, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter::writeArray needs POD values");
+        writeBytes(values, count * sizeof(T));
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        if (size == 0) return;
+        size_t offset = buffer.size();
+        buffer.resize(offset + size);
+        std::memcpy(buffer.data() + offset, data, size);
+    }
+
+    void writeString(const std::string& s) {
+        write<uint32_t>((uint32_t)s.size());
+        writeBytes(s.data(), s.size());
+    }
+
+    // Phase 54: LEB128 varint (small values take one byte)
+    void writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            buffer.push_back((char)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back((char)value);
+    }
+
+    // Zigzag maps small magnitudes of either sign to small varints
+    void writeSigned(int64_t value) {
+        writeVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+    }
+
+    // Pads with zeros so the next write starts on an `alignment` boundary
+    void align(size_t alignment) {
+        while (buffer.size() % alignment != 0) buffer.push_back(0);
+    }
+
+    // Overwrites a value written earlier (e.g. a size known only at the end)
+    template <typename T>
+    void patch(size_t offset, const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter::patch needs a POD value");
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    size_t size() const { return buffer.size(); }
+    const std::vector<char>& data() const { return buffer; }
+    void clear() { buffer.clear(); }
+
+    bool saveToFile(const std::string& path, bool append = false) const {
+        std::ofstream out(path, std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+        if (!out) return false;
+        out.write(buffer.data(), (std::streamsize)buffer.size());
+        out.close();  // Flush now so a failed final write is reported
+        return !out.fail();
+    }
+
+private:
+    std::vector<char> buffer;
+};
+
+class BinaryReader {
+public:
+    BinaryReader(const char* data, size_t size) : base(data), length(size) {}
+    explicit BinaryReader(const std::vector<char>& bytes) : base(bytes.data()), length(bytes.size()) {}
+
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryReader::read needs a POD value");
+        return readBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    bool readArray(T* values, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryReader::readArray needs POD values");
+        return readBytes(values, count * sizeof(T));
+    }
+
+    bool readBytes(void* out, size_t size) {
+        if (!valid || size > length - offset) {
+            valid = false;
+            return false;
+        }
+        if (size > 0) std::memcpy(out, base + offset, size);
+        offset += size;
+        return true;
+    }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (!valid || offset >= length) {
+                valid = false;
+                return false;
+            }
+            uint8_t byte = (uint8_t)base[offset++];
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        valid = false;  // Over-long encoding
+        return false;
+    }
+
+    bool readSigned(int64_t& value) {
+        uint64_t raw = 0;
+        if (!readVarint(raw)) return false;
+        value = (int64_t)(raw >> 1) ^ -(int64_t)(raw & 1);
+        return true;
+    }
+
+    bool readString(std::string& s) {
+        uint32_t n = 0;
+        if (!read(n) || n > length - offset) {
+            valid = false;
+            return false;
+        }
+        s.assign(base + offset, n);
+        offset += n;
+        return true;
+    }
+
+    // Zero-copy view of the next `size` bytes (nullptr if out of range)
+    const char* view(size_t size) {
+        if (!valid || size > length - offset) {
+            valid = false;
+            return nullptr;
+        }
+        const char* p = base + offset;
+        offset += size;
+        return p;
+    }
+
+    void align(size_t alignment) {
+        while (offset % alignment != 0 && offset < length) offset++;
+    }
+
+    bool ok() const { return valid; }
+    bool atEnd() const { return offset >= length; }
+    size_t position() const { return offset; }
+    void seek(size_t pos) {
+        if (pos > length) valid = false;
+        else offset = pos;
+    }
+
+    static bool loadFile(const std::string& path, std::vector<char>& out) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) return false;
+        std::streamsize size = in.tellg();
+        if (size < 0) return false;
+        out.resize((size_t)size);
+        in.seekg(0);
+        return (bool)in.read(out.data(), size);
+    }
+
+private:
+    const char* base;
+    size_t length;
+    size_t offset = 0;
+    bool valid = true;
+};
+
+#endif // BINARY_IO_HPP
@@ -11,7 +11,8 @@ namespace Config {
     inline constexpr float BOND_COMPRESSION = 1.2f; 
     inline constexpr float BOND_SNAP_THRESHOLD = 0.45f;
     inline constexpr float BOND_AUTO_RANGE = 65.0f; // Increased for better "grab" (was 55.0)
-    inline constexpr int BONDING_THROTTLE_FRAMES = 2;  // Increased frequency to 30Hz (was 10Hz) 
+    inline constexpr int BONDING_THROTTLE_FRAMES = 1;  // Bonding buckets K: each atom evaluated every K ticks (K > 1 is opt-in, Phase 46)
+    inline constexpr int BONDING_STRUCTURE_BUDGET = 8; // Max structure-detection attempts per tick (Phase 46)
     inline constexpr float THERMODYNAMIC_JITTER = 2.5f; // Increased from 0.5 to promote bending/mixing
     inline constexpr float GRID_CELL_SIZE = 100.0f;     
     inline constexpr float PHYSICS_EPSILON = 0.001f;
@@ -63,6 +64,7 @@ namespace Config {
     inline constexpr float TRACTOR_JITTER_GRADIENT = 100.0f; 
     inline constexpr float TRACTOR_BEAM_WIDTH = 2.0f;
     inline constexpr float TRACTOR_TARGET_CIRCLE = 25.0f;
+    inline constexpr float TRACTOR_STRUCTURE_REF_MASS = 72.0f;  // Phase 68: heavier CTRL-dragged structures respond slower (C6 ring = 72)
     
     // --- CHEMISTRY & ELECTROMAGNETISM ---
     inline constexpr float COULOMB_CONSTANT = 2000.0f;    // Increased slightly 
@@ -145,6 +147,16 @@ namespace Config {
     inline constexpr float RENDER_BOND_THICKNESS_BG = 4.0f;
     inline constexpr float RENDER_BOND_THICKNESS_FG = 2.5f;
     inline constexpr float RENDER_MIN_SCALE = 0.1f;
+    inline constexpr float RENDER_CULL_MARGIN = 40.0f;  // Phase 58: atom radius + one step of motion past the view edge
+    inline constexpr int RENDER_DEPTH_BUCKET_ATOMS = 2;  // Phase 59: depth-sort buckets = visible atoms / this
+
+    // --- PHASE 60: LEVEL OF DETAIL ---
+    inline constexpr float LOD_MOLECULE_ZOOM = 0.3f;        // Below this zoom molecules draw as one impostor each
+    inline constexpr float LOD_DENSITY_ZOOM = 0.12f;        // Below this zoom the world draws as a density texture
+    inline constexpr int LOD_IMPOSTOR_REFRESH_FRAMES = 8;   // Impostor centroids are refreshed 1/N per frame
+    inline constexpr int LOD_HEAT_TEXTURE_SIZE = 256;       // Max heat texels per side (cells are merged beyond)
+    inline constexpr float LOD_HEAT_FULL_ATOMS = 12.0f;     // Atoms per grid cell drawn at full heat
+    inline constexpr int LOD_LABEL_MIN_ATOMS = 6;           // Impostors at least this big get a cluster label
 
     // --- DEBUG: STRUCTURE FORMATION ---
     inline constexpr bool DEBUG_INSTANT_FORMATION = true;
@@ -169,6 +181,76 @@ namespace Config {
 
         inline constexpr float DRIFT_DAMPING_FALLBACK = 0.2f;
     }
+
+    // --- PHASE 50: MOLECULE CENSUS ---
+    inline constexpr bool CENSUS_ENABLED = true;
+    inline constexpr int CENSUS_SAMPLE_TICKS = 60;       // One sample per simulated second at 60 Hz
+    inline constexpr int CENSUS_FLUSH_SAMPLES = 60;      // Samples buffered before touching the disk
+    inline constexpr int CENSUS_FORMAT_VERSION = 1;
+    inline constexpr const char* CENSUS_CSV_PATH = "census.csv";
+    inline constexpr const char* CENSUS_BIN_PATH = "census.bin";
+
+    // --- PHASE 51: ENTITY LIFECYCLE ---
+    inline constexpr int WORLD_COMPACT_MIN_DEAD = 64;        // Never compact for a handful of gaps
+    inline constexpr float WORLD_COMPACT_DEAD_RATIO = 0.25f; // Compact once this share of slots is dead
+
+    // --- PHASE 52: CHUNK STREAMING ---
+    inline constexpr bool CHUNK_STREAMING_ENABLED = true;
+    inline constexpr float CHUNK_SIZE = 1000.0f;      // World units per chunk side
+    inline constexpr int CHUNK_ACTIVE_RADIUS = 2;     // Chunks (Chebyshev) paged in around the player
+    inline constexpr int CHUNK_KEEP_RADIUS = 3;       // Molecules beyond this are evicted (hysteresis)
+    inline constexpr int CHUNK_UPDATE_TICKS = 30;     // Fixed steps between streaming passes
+    inline constexpr const char* CHUNK_DIRECTORY = "world_chunks";  // Under the executable's directory, not the CWD
+
+    // --- PHASE 53: WORLD SNAPSHOTS ---
+    inline constexpr const char* SNAPSHOT_PATH = "world.snap";  // F5 saves, F9 loads
+
+    // --- PHASE 54: RECORDING & REPLAY ---
+    inline constexpr bool RECORDING_ENABLED = true;
+    inline constexpr const char* RECORDING_PATH = "session.rec";  // F10 toggles replay of it
+    inline constexpr int RECORD_KEYFRAME_TICKS = 600;             // Full snapshot every 10 s (seek cost bound)
+    inline constexpr int RECORD_FLUSH_TICKS = 120;                // Frames buffered between appends
+    inline constexpr float RECORD_POSITION_QUANTUM = 0.0625f;     // World units per position step
+    inline constexpr float RECORD_VELOCITY_QUANTUM = 0.125f;      // Units/s per velocity step
+
+    // --- PHASE 55: DETERMINISTIC MODE ---
+    inline constexpr bool DETERMINISTIC_MODE = false;             // Seeded RNG + per-tick state hash log
+    inline constexpr int DETERMINISTIC_SEED = 20261016;
+    inline constexpr const char* STATE_HASH_LOG_PATH = "state_hashes.bin";
+    inline constexpr const char* STATE_HASH_REFERENCE_PATH = "state_hashes_ref.bin";  // Rename a previous log to compare
+
+    // --- PHASE 56: CHECKPOINT UNDO ---
+    inline constexpr bool UNDO_CHECKPOINTS_ENABLED = true;   // Undo restores full world state
+    inline constexpr int CHECKPOINT_PAGE_ENTITIES = 64;      // Copy-on-write granularity
+    inline constexpr int UNDO_HISTORY_LIMIT = 128;           // Checkpoints kept (oldest dropped first)
+    inline constexpr int UNDO_MEMORY_BUDGET_KB = 16384;      // Unshared page bytes across the history
+
+    // --- PHASE 63: DATA PACK ---
+    inline constexpr bool DATA_PACK_ENABLED = true;               // Prefer the pack over parsing JSON
+    inline constexpr const char* DATA_DIRECTORY = "data";
+    inline constexpr const char* DATA_PACK_PATH = "data/game.pack";  // Built by tools/pack_builder
+
+    // --- PHASE 64: HOT RELOAD ---
+    inline constexpr bool HOT_RELOAD_ENABLED = true;   // Watch the data JSON and apply edits between ticks
+    inline constexpr int HOT_RELOAD_POLL_MS = 500;     // Stamp check interval of the watch thread
+
+    // --- PHASE 65: ASYNC LOGGING ---
+    inline constexpr int LOG_COMPILED_MIN_LEVEL = LOG_INFO;   // SIM_LOG below this compiles away
+    inline constexpr int LOG_RING_CAPACITY = 4096;            // Records in flight; a full ring drops, never blocks
+    inline constexpr int LOG_CATEGORY_RATE = 50;              // Lines per second per "[TAG]" (errors exempt)
+    inline constexpr int LOG_IDLE_SLEEP_MS = 2;               // Writer thread back-off when the ring is empty
+    inline constexpr const char* LOG_PATH = "session.log";
+
+    // --- PHASE 66: METRICS ---
+    inline constexpr bool METRICS_ENABLED = true;                // false compiles every metric update away
+    inline constexpr int METRICS_EXPORT_TICKS = 600;             // Snapshot every 10 s of simulation
+    inline constexpr const char* METRICS_PATH = "metrics.prom";  // Replaced atomically on each export
+
+    // --- PHASE 67: PERFORMANCE OVERLAY (F3) ---
+    inline constexpr int PERF_HISTORY_FRAMES = 240;         // Frames in the rolling frame-time graph
+    inline constexpr int PERF_STATS_INTERVAL = 15;          // Frames between world scans (counts, memory)
+    inline constexpr float PERF_FRAME_BUDGET_MS = 16.67f;   // Reference line on the graph
+    inline constexpr int PERF_HEATMAP_FULL_ATOMS = 16;      // Atoms per cell drawn at full heat
 }
 
 #endif // CONFIG_HPP
@@ -0,0 +1,706 @@
+#include "DataPack.hpp"
+#include "BinaryIO.hpp"
+#include "Config.hpp"
+#include "JsonLoader.hpp"
+#include "json.hpp"
+#include "../chemistry/Element.hpp"
+#include "../chemistry/Molecule.hpp"
+#include "../chemistry/StructureDefinition.hpp"
+#include "../gameplay/MissionManager.hpp"
+#include "raylib.h"
+#include <filesystem>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <cstddef>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr char PACK_MAGIC[8] = {'L', 'S', 'P', 'A', 'C', 'K', 0, 0};
+    constexpr uint32_t BYTE_ORDER_TAG = 0x01020304;
+    constexpr size_t SECTION_ALIGN = 16;
+    constexpr uint32_t MAX_SECTIONS = 64;
+
+    enum SectionId : uint32_t {
+        SECTION_STRINGS = 1,
+        SECTION_LANGUAGES = 2,
+        SECTION_TEXTS = 3,
+        SECTION_ELEMENTS = 4,
+        SECTION_SLOTS = 5,
+        SECTION_MOLECULES = 6,
+        SECTION_COMPOSITION = 7,
+        SECTION_MISSIONS = 8,
+        SECTION_STRUCTURES = 9,
+        SECTION_STRUCTURE_LABELS = 10,
+        SECTION_STRUCTURE_EDGES = 11,
+        SECTION_UI_STRINGS = 12,
+        SECTION_SOURCES = 13,
+        SECTION_COUNT = 14
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t sectionCount;
+        uint32_t languageCount;
+        uint32_t textCount;
+        uint32_t pad;
+        uint64_t fileSize;
+    };
+
+    struct SectionEntry {
+        uint32_t id;
+        uint32_t elementSize;
+        uint64_t offset;
+        uint64_t count;
+    };
+
+    // String fields are pool offsets; localised fields are text ids (columns of the text table)
+    struct PackedLanguage {
+        uint32_t code;
+        uint32_t pad;
+    };
+
+    struct PackedElement {
+        int32_t atomicNumber;
+        uint32_t symbol;
+        float atomicMass;
+        float vdWRadius;
+        uint8_t color[4];
+        uint8_t backgroundColor[4];
+        int32_t maxBonds;
+        float electronegativity;
+        uint32_t name;
+        uint32_t category;
+        uint32_t description;
+        uint32_t origin;
+        uint32_t discoveryHint;
+        uint32_t slotBegin;
+        uint32_t slotCount;
+    };
+
+    struct PackedVector3 {
+        float x, y, z;
+    };
+
+    struct PackedPair {
+        int32_t a, b;
+    };
+
+    struct PackedMolecule {
+        uint32_t id;
+        uint32_t formula;
+        uint32_t category;
+        uint32_t name;
+        uint32_t description;
+        uint32_t biologicalSignificance;
+        uint32_t origin;
+        uint8_t color[4];
+        uint32_t compositionBegin;
+        uint32_t compositionCount;
+    };
+
+    struct PackedMission {
+        uint32_t id;
+        uint32_t reward;
+        int32_t tier;
+        uint32_t title;
+        uint32_t description;
+        uint32_t scientificContext;
+    };
+
+    struct PackedStructure {
+        uint32_t name;
+        int32_t atomCount;
+        int32_t atomicNumber;
+        float targetAngle;
+        float damping;
+        float globalDamping;
+        float formationSpeed;
+        float formationDamping;
+        float maxFormationSpeed;
+        float completionThreshold;
+        float rotationOffset;
+        uint8_t isPlanar;
+        uint8_t instantFormation;
+        uint8_t allowRingAtoms;
+        uint8_t reorganize;
+        uint32_t labelBegin;
+        uint32_t labelCount;
+        uint32_t edgeBegin;
+        uint32_t edgeCount;
+    };
+
+    struct PackedUiString {
+        uint32_t key;
+        uint32_t text;
+    };
+
+    // Size and modification time of a source JSON when the pack was built
+    struct PackedSource {
+        uint32_t name;
+        uint32_t pad;
+        uint64_t size;
+        int64_t modified;
+    };
+
+    uint32_t expectedElementSize(uint32_t id) {
+        switch (id) {
+            case SECTION_STRINGS: return 1;
+            case SECTION_LANGUAGES: return sizeof(PackedLanguage);
+            case SECTION_TEXTS: return sizeof(uint32_t);
+            case SECTION_ELEMENTS: return sizeof(PackedElement);
+            case SECTION_SLOTS: return sizeof(PackedVector3);
+            case SECTION_MOLECULES: return sizeof(PackedMolecule);
+            case SECTION_COMPOSITION: return sizeof(PackedPair);
+            case SECTION_MISSIONS: return sizeof(PackedMission);
+            case SECTION_STRUCTURES: return sizeof(PackedStructure);
+            case SECTION_STRUCTURE_LABELS: return sizeof(int32_t);
+            case SECTION_STRUCTURE_EDGES: return sizeof(PackedPair);
+            case SECTION_UI_STRINGS: return sizeof(PackedUiString);
+            case SECTION_SOURCES: return sizeof(PackedSource);
+            default: return 0;
+        }
+    }
+
+    bool stampFile(const std::string& path, uint64_t& size, int64_t& modified) {
+        std::error_code ec;
+        size = (uint64_t)fs::file_size(path, ec);
+        if (ec) return false;
+        auto time = fs::last_write_time(path, ec);
+        if (ec) return false;
+        modified = (int64_t)time.time_since_epoch().count();
+        return true;
+    }
+
+    Color toColor(const uint8_t c[4]) { return { c[0], c[1], c[2], c[3] }; }
+    void fromColor(Color c, uint8_t out[4]) { out[0] = c.r; out[1] = c.g; out[2] = c.b; out[3] = c.a; }
+
+    // Deduplicated NUL-terminated strings plus one text column per localised field
+    class PackContent {
+    public:
+        std::vector<char> pool;
+        std::vector<std::vector<uint32_t>> texts;  // [language][textId] -> pool offset
+
+        explicit PackContent(size_t languages) : texts(languages) {}
+
+        uint32_t intern(const std::string& s) {
+            auto it = offsets.find(s);
+            if (it != offsets.end()) return it->second;
+            uint32_t offset = (uint32_t)pool.size();
+            pool.insert(pool.end(), s.begin(), s.end());
+            pool.push_back('\0');
+            offsets.emplace(s, offset);
+            return offset;
+        }
+
+        // One value per language, in language order
+        template <typename Get>
+        uint32_t addText(Get&& valueFor) {
+            uint32_t id = (uint32_t)texts[0].size();
+            for (size_t l = 0; l < texts.size(); l++) texts[l].push_back(intern(valueFor(l)));
+            return id;
+        }
+
+    private:
+        std::unordered_map<std::string, uint32_t> offsets;
+    };
+
+    template <typename T>
+    void writeSection(BinaryWriter& out, std::vector<SectionEntry>& table, uint32_t id, const std::vector<T>& values) {
+        out.align(SECTION_ALIGN);
+        table.push_back({ id, (uint32_t)sizeof(T), (uint64_t)out.size(), (uint64_t)values.size() });
+        out.writeArray(values.data(), values.size());
+    }
+}
+
+DataPack& DataPack::getInstance() {
+    static DataPack& instance = []() -> DataPack& {
+        static DataPack pack;
+        if (Config::DATA_PACK_ENABLED) pack.open(Config::DATA_PACK_PATH, Config::DATA_DIRECTORY);
+        return pack;
+    }();
+    return instance;
+}
+
+bool DataPack::build(const std::string& dataDir, const std::string& outPath, std::string& error) {
+    try {
+        // 1. Languages = every lang_<code>.json next to the data
+        std::vector<std::string> languages;
+        std::vector<std::string> sourceFiles = { "elements.json", "molecules.json", "missions.json", "structures.json" };
+        for (const auto& entry : fs::directory_iterator(dataDir)) {
+            std::string name = entry.path().filename().string();
+            if (name.rfind("lang_", 0) == 0 && entry.path().extension() == ".json") {
+                languages.push_back(name.substr(5, name.size() - 10));
+                sourceFiles.push_back(name);
+            }
+        }
+        std::sort(languages.begin(), languages.end());
+        if (languages.empty()) throw std::runtime_error("No lang_*.json in " + dataDir);
+
+        // 2. Same loaders (and validation) as the JSON path, once per language
+        std::vector<std::vector<Element>> elements;
+        std::vector<std::vector<Molecule>> molecules;
+        std::vector<std::vector<Mission>> missions;
+        std::vector<nlohmann::json> uiStrings;
+        for (const std::string& lang : languages) {
+            elements.push_back(JsonLoader::loadElements(dataDir + "/elements.json", lang));
+            molecules.push_back(JsonLoader::loadMolecules(dataDir + "/molecules.json", lang));
+            missions.push_back(JsonLoader::loadMissions(dataDir + "/missions.json", lang));
+            std::ifstream in(dataDir + "/lang_" + lang + ".json");
+            nlohmann::json strings;
+            in >> strings;
+            for (auto it = strings.begin(); it != strings.end(); ++it) {
+                if (!it.value().is_string()) throw std::runtime_error("lang_" + lang + ".json: '" + it.key() + "' is not a string");
+            }
+            uiStrings.push_back(std::move(strings));
+        }
+        std::vector<StructureDefinition> structures = JsonLoader::loadStructures(dataDir + "/structures.json");
+
+        PackContent content(languages.size());
+        std::vector<PackedLanguage> packedLanguages;
+        for (const std::string& lang : languages) packedLanguages.push_back({ content.intern(lang), 0 });
+
+        std::vector<PackedElement> packedElements;
+        std::vector<PackedVector3> slots;
+        for (size_t k = 0; k < elements[0].size(); k++) {
+            const Element& el = elements[0][k];
+            PackedElement p{};
+            p.atomicNumber = el.atomicNumber;
+            p.symbol = content.intern(el.symbol);
+            p.atomicMass = el.atomicMass;
+            p.vdWRadius = el.vdWRadius;
+            fromColor(el.color, p.color);
+            fromColor(el.backgroundColor, p.backgroundColor);
+            p.maxBonds = el.maxBonds;
+            p.electronegativity = el.electronegativity;
+            p.name = content.addText([&](size_t l) { return elements[l][k].name; });
+            p.category = content.addText([&](size_t l) { return elements[l][k].category; });
+            p.description = content.addText([&](size_t l) { return elements[l][k].description; });
+            p.origin = content.addText([&](size_t l) { return elements[l][k].origin; });
+            p.discoveryHint = content.addText([&](size_t l) { return elements[l][k].discoveryHint; });
+            p.slotBegin = (uint32_t)slots.size();
+            p.slotCount = (uint32_t)el.bondingSlots.size();
+            for (const Vector3& v : el.bondingSlots) slots.push_back({ v.x, v.y, v.z });
+            packedElements.push_back(p);
+        }
+
+        std::vector<PackedMolecule> packedMolecules;
+        std::vector<PackedPair> composition;
+        for (size_t k = 0; k < molecules[0].size(); k++) {
+            const Molecule& m = molecules[0][k];
+            PackedMolecule p{};
+            p.id = content.intern(m.id);
+            p.formula = content.intern(m.formula);
+            p.category = content.intern(m.category);
+            p.name = content.addText([&](size_t l) { return molecules[l][k].name; });
+            p.description = content.addText([&](size_t l) { return molecules[l][k].description; });
+            p.biologicalSignificance = content.addText([&](size_t l) { return molecules[l][k].biologicalSignificance; });
+            p.origin = content.addText([&](size_t l) { return molecules[l][k].origin; });
+            fromColor(m.color, p.color);
+            p.compositionBegin = (uint32_t)composition.size();
+            p.compositionCount = (uint32_t)m.composition.size();
+            for (const auto& [z, count] : m.composition) composition.push_back({ z, count });
+            packedMolecules.push_back(p);
+        }
+
+        std::vector<PackedMission> packedMissions;
+        for (size_t k = 0; k < missions[0].size(); k++) {
+            const Mission& m = missions[0][k];
+            PackedMission p{};
+            p.id = content.intern(m.id);
+            p.reward = content.intern(m.reward);
+            p.tier = m.tier;
+            p.title = content.addText([&](size_t l) { return missions[l][k].title; });
+            p.description = content.addText([&](size_t l) { return missions[l][k].description; });
+            p.scientificContext = content.addText([&](size_t l) { return missions[l][k].scientificContext; });
+            packedMissions.push_back(p);
+        }
+
+        std::vector<PackedStructure> packedStructures;
+        std::vector<int32_t> labels;
+        std::vector<PackedPair> edges;
+        for (const StructureDefinition& s : structures) {
+            PackedStructure p{};
+            p.name = content.intern(s.name);
+            p.atomCount = s.atomCount;
+            p.atomicNumber = s.atomicNumber;
+            p.targetAngle = s.targetAngle;
+            p.damping = s.damping;
+            p.globalDamping = s.globalDamping;
+            p.formationSpeed = s.formationSpeed;
+            p.formationDamping = s.formationDamping;
+            p.maxFormationSpeed = s.maxFormationSpeed;
+            p.completionThreshold = s.completionThreshold;
+            p.rotationOffset = s.rotationOffset;
+            p.isPlanar = s.isPlanar;
+            p.instantFormation = s.instantFormation;
+            p.allowRingAtoms = s.graph.allowRingAtoms;
+            p.reorganize = s.graph.reorganize;
+            p.labelBegin = (uint32_t)labels.size();
+            p.labelCount = (uint32_t)s.graph.labels.size();
+            labels.insert(labels.end(), s.graph.labels.begin(), s.graph.labels.end());
+            p.edgeBegin = (uint32_t)edges.size();
+            p.edgeCount = (uint32_t)s.graph.edges.size();
+            for (const auto& e : s.graph.edges) edges.push_back({ e.first, e.second });
+            packedStructures.push_back(p);
+        }
+
+        // UI strings: union of keys; a key missing from one language translates to itself there
+        std::vector<std::string> keys;
+        for (const auto& strings : uiStrings) {
+            for (auto it = strings.begin(); it != strings.end(); ++it) keys.push_back(it.key());
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        std::vector<PackedUiString> packedStrings;
+        for (const std::string& key : keys) {
+            uint32_t id = content.addText([&](size_t l) {
+                auto it = uiStrings[l].find(key);
+                return it != uiStrings[l].end() ? it->get<std::string>() : key;
+            });
+            packedStrings.push_back({ content.intern(key), id });
+        }
+
+        std::vector<PackedSource> sources;
+        for (const std::string& name : sourceFiles) {
+            PackedSource p{};
+            p.name = content.intern(name);
+            if (!stampFile(dataDir + "/" + name, p.size, p.modified)) throw std::runtime_error("Cannot stat " + name);
+            sources.push_back(p);
+        }
+
+        // 3. Layout: header, section table, aligned sections
+        std::vector<uint32_t> textTable;
+        for (const auto& row : content.texts) textTable.insert(textTable.end(), row.begin(), row.end());
+
+        BinaryWriter out;
+        Header header{};
+        std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+        header.version = VERSION;
+        header.byteOrder = BYTE_ORDER_TAG;
+        header.sectionCount = SECTION_COUNT - 1;
+        header.languageCount = (uint32_t)languages.size();
+        header.textCount = (uint32_t)content.texts[0].size();
+        out.write(header);
+        size_t tableOffset = out.size();
+        std::vector<SectionEntry> table;
+        out.writeBytes(std::vector<char>(sizeof(SectionEntry) * header.sectionCount, 0).data(), sizeof(SectionEntry) * header.sectionCount);
+
+        writeSection(out, table, SECTION_STRINGS, content.pool);
+        writeSection(out, table, SECTION_LANGUAGES, packedLanguages);
+        writeSection(out, table, SECTION_TEXTS, textTable);
+        writeSection(out, table, SECTION_ELEMENTS, packedElements);
+        writeSection(out, table, SECTION_SLOTS, slots);
+        writeSection(out, table, SECTION_MOLECULES, packedMolecules);
+        writeSection(out, table, SECTION_COMPOSITION, composition);
+        writeSection(out, table, SECTION_MISSIONS, packedMissions);
+        writeSection(out, table, SECTION_STRUCTURES, packedStructures);
+        writeSection(out, table, SECTION_STRUCTURE_LABELS, labels);
+        writeSection(out, table, SECTION_STRUCTURE_EDGES, edges);
+        writeSection(out, table, SECTION_UI_STRINGS, packedStrings);
+        writeSection(out, table, SECTION_SOURCES, sources);
+
+        for (size_t i = 0; i < table.size(); i++) out.patch(tableOffset + i * sizeof(SectionEntry), table[i]);
+        out.patch(offsetof(Header, fileSize), (uint64_t)out.size());
+
+        std::string tmpPath = outPath + ".tmp";
+        if (!out.saveToFile(tmpPath)) throw std::runtime_error("Cannot write " + tmpPath);
+        std::error_code ec;
+        fs::rename(tmpPath, outPath, ec);
+        if (ec) throw std::runtime_error("Cannot replace " + outPath + ": " + ec.message());
+
+        TraceLog(LOG_INFO, "[DATA PACK] Built %s: %d languages, %d elements, %d molecules, %d missions, %d structures, %d strings (%d bytes)",
+                 outPath.c_str(), (int)languages.size(), (int)packedElements.size(), (int)packedMolecules.size(),
+                 (int)packedMissions.size(), (int)packedStructures.size(), (int)packedStrings.size(), (int)out.size());
+        return true;
+    } catch (const std::exception& e) {
+        error = e.what();
+        return false;
+    }
+}
+
+bool DataPack::open(const std::string& path, const std::string& dataDir) {
+    close();
+    if (!file.open(path)) return false;
+
+    auto reject = [&](const char* reason) {
+        TraceLog(LOG_WARNING, "[DATA PACK] Ignoring %s: %s (using JSON)", path.c_str(), reason);
+        close();
+        return false;
+    };
+
+    const char* base = file.data();
+    const size_t size = file.size();
+    Header header;
+    if (size < sizeof(Header)) return reject("truncated");
+    std::memcpy(&header, base, sizeof(Header));
+    if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) return reject("bad magic");
+    if (header.version != VERSION) return reject("version mismatch");
+    if (header.byteOrder != BYTE_ORDER_TAG) return reject("byte order mismatch");
+    if (header.fileSize != size) return reject("size mismatch");
+    if (header.sectionCount > MAX_SECTIONS || sizeof(Header) + header.sectionCount * sizeof(SectionEntry) > size) return reject("bad section table");
+
+    sections.assign(SECTION_COUNT, SectionView{});
+    const SectionEntry* table = reinterpret_cast<const SectionEntry*>(base + sizeof(Header));
+    for (uint32_t i = 0; i < header.sectionCount; i++) {
+        const SectionEntry& e = table[i];
+        if (e.id == 0 || e.id >= SECTION_COUNT || e.elementSize != expectedElementSize(e.id)) return reject("unknown section layout");
+        if (e.offset % SECTION_ALIGN != 0 || e.offset > size || e.count > (size - e.offset) / e.elementSize) return reject("section out of range");
+        sections[e.id] = { base + e.offset, e.count };
+    }
+    for (uint32_t id = 1; id < SECTION_COUNT; id++) {
+        if (!sections[id].data) return reject("missing section");
+    }
+    const SectionView& strings = sections[SECTION_STRINGS];
+    if (strings.count == 0 || strings.data[strings.count - 1] != '\0') return reject("unterminated string pool");
+    if (sections[SECTION_LANGUAGES].count != header.languageCount ||
+        sections[SECTION_TEXTS].count != (uint64_t)header.languageCount * header.textCount) return reject("text table size mismatch");
+    textCount = header.textCount;
+
+    sourceDir = dataDir;
+    if (!sourcesUnchanged()) return reject("source JSON changed since the pack was built");
+
+    TraceLog(LOG_INFO, "[DATA PACK] Mapped %s (%d bytes, %d languages)", path.c_str(), (int)size, (int)header.languageCount);
+    return true;
+}
+
+void DataPack::close() {
+    file.close();
+    sections.clear();
+    textCount = 0;
+}
+
+bool DataPack::sourcesUnchanged() const {
+    const SectionView& view = sections[SECTION_SOURCES];
+    const PackedSource* sources = reinterpret_cast<const PackedSource*>(view.data);
+    for (uint64_t i = 0; i < view.count; i++) {
+        std::string path = sourceDir + "/" + str(sources[i].name);
+        std::error_code ec;
+        if (!fs::exists(path, ec)) continue;  // Shipped without its JSON
+        uint64_t size = 0;
+        int64_t modified = 0;
+        if (!stampFile(path, size, modified) || size != sources[i].size || modified != sources[i].modified) return false;
+    }
+    return true;
+}
+
+bool DataPack::covers(const std::string& jsonPath) const {
+    if (!isOpen()) return false;
+    const SectionView& view = sections[SECTION_SOURCES];
+    const PackedSource* sources = reinterpret_cast<const PackedSource*>(view.data);
+    for (uint64_t i = 0; i < view.count; i++) {
+        if (sourceDir + "/" + str(sources[i].name) == jsonPath) return true;
+    }
+    return false;
+}
+
+const uint32_t* DataPack::languageRow(const std::string& lang) const {
+    if (!isOpen()) return nullptr;
+    const PackedLanguage* languages = reinterpret_cast<const PackedLanguage*>(sections[SECTION_LANGUAGES].data);
+    for (uint64_t l = 0; l < sections[SECTION_LANGUAGES].count; l++) {
+        if (lang == str(languages[l].code)) {
+            return reinterpret_cast<const uint32_t*>(sections[SECTION_TEXTS].data) + l * textCount;
+        }
+    }
+    return nullptr;
+}
+
+const char* DataPack::str(uint32_t offset) const {
+    const SectionView& strings = sections[SECTION_STRINGS];
+    return offset < strings.count ? strings.data + offset : "";
+}
+
+const char* DataPack::text(const uint32_t* row, uint32_t textId) const {
+    return textId < textCount ? str(row[textId]) : "";
+}
+
+std::vector<Element> DataPack::loadElements(const std::string& lang) const {
+    std::vector<Element> out;
+    const uint32_t* row = languageRow(lang);
+    if (!row) return out;
+    const PackedElement* packed = reinterpret_cast<const PackedElement*>(sections[SECTION_ELEMENTS].data);
+    const PackedVector3* slots = reinterpret_cast<const PackedVector3*>(sections[SECTION_SLOTS].data);
+    const uint64_t slotCount = sections[SECTION_SLOTS].count;
+    out.reserve(sections[SECTION_ELEMENTS].count);
+    for (uint64_t i = 0; i < sections[SECTION_ELEMENTS].count; i++) {
+        const PackedElement& p = packed[i];
+        Element el;
+        el.atomicNumber = p.atomicNumber;
+        el.symbol = str(p.symbol);
+        el.name = text(row, p.name);
+        el.atomicMass = p.atomicMass;
+        el.vdWRadius = p.vdWRadius;
+        el.color = toColor(p.color);
+        el.backgroundColor = toColor(p.backgroundColor);
+        el.category = text(row, p.category);
+        el.description = text(row, p.description);
+        el.origin = text(row, p.origin);
+        el.discoveryHint = text(row, p.discoveryHint);
+        el.maxBonds = p.maxBonds;
+        el.electronegativity = p.electronegativity;
+        for (uint64_t s = p.slotBegin; s < (uint64_t)p.slotBegin + p.slotCount && s < slotCount; s++) {
+            el.bondingSlots.push_back({ slots[s].x, slots[s].y, slots[s].z });
+        }
+        out.push_back(std::move(el));
+    }
+    return out;
+}
+
+std::vector<Molecule> DataPack::loadMolecules(const std::string& lang) const {
+    std::vector<Molecule> out;
+    const uint32_t* row = languageRow(lang);
+    if (!row) return out;
+    const PackedMolecule* packed = reinterpret_cast<const PackedMolecule*>(sections[SECTION_MOLECULES].data);
+    const PackedPair* composition = reinterpret_cast<const PackedPair*>(sections[SECTION_COMPOSITION].data);
+    const uint64_t compositionCount = sections[SECTION_COMPOSITION].count;
+    out.reserve(sections[SECTION_MOLECULES].count);
+    for (uint64_t i = 0; i < sections[SECTION_MOLECULES].count; i++) {
+        const PackedMolecule& p = packed[i];
+        Molecule m;
+        m.id = str(p.id);
+        m.name = text(row, p.name);
+        m.formula = str(p.formula);
+        m.category = str(p.category);
+        m.description = text(row, p.description);
+        m.biologicalSignificance = text(row, p.biologicalSignificance);
+        m.origin = text(row, p.origin);
+        m.color = toColor(p.color);
+        for (uint64_t c = p.compositionBegin; c < (uint64_t)p.compositionBegin + p.compositionCount && c < compositionCount; c++) {
+            m.composition[composition[c].a] = composition[c].b;
+        }
+        out.push_back(std::move(m));
+    }
+    return out;
+}
+
+std::vector<Mission> DataPack::loadMissions(const std::string& lang) const {
+    std::vector<Mission> out;
+    const uint32_t* row = languageRow(lang);
+    if (!row) return out;
+    const PackedMission* packed = reinterpret_cast<const PackedMission*>(sections[SECTION_MISSIONS].data);
+    out.reserve(sections[SECTION_MISSIONS].count);
+    for (uint64_t i = 0; i < sections[SECTION_MISSIONS].count; i++) {
+        const PackedMission& p = packed[i];
+        Mission m;
+        m.id = str(p.id);
+        m.title = text(row, p.title);
+        m.description = text(row, p.description);
+        m.scientificContext = text(row, p.scientificContext);
+        m.reward = str(p.reward);
+        m.tier = p.tier;
+        m.status = MissionStatus::AVAILABLE;
+        out.push_back(std::move(m));
+    }
+    return out;
+}
+
+std::vector<StructureDefinition> DataPack::loadStructures() const {
+    std::vector<StructureDefinition> out;
+    if (!isOpen()) return out;
+    const PackedStructure* packed = reinterpret_cast<const PackedStructure*>(sections[SECTION_STRUCTURES].data);
+    const int32_t* labels = reinterpret_cast<const int32_t*>(sections[SECTION_STRUCTURE_LABELS].data);
+    const PackedPair* edges = reinterpret_cast<const PackedPair*>(sections[SECTION_STRUCTURE_EDGES].data);
+    const uint64_t labelCount = sections[SECTION_STRUCTURE_LABELS].count;
+    const uint64_t edgeCount = sections[SECTION_STRUCTURE_EDGES].count;
+    for (uint64_t i = 0; i < sections[SECTION_STRUCTURES].count; i++) {
+        const PackedStructure& p = packed[i];
+        StructureDefinition s;
+        s.name = str(p.name);
+        s.atomCount = p.atomCount;
+        s.atomicNumber = p.atomicNumber;
+        s.targetAngle = p.targetAngle;
+        s.damping = p.damping;
+        s.globalDamping = p.globalDamping;
+        s.formationSpeed = p.formationSpeed;
+        s.formationDamping = p.formationDamping;
+        s.maxFormationSpeed = p.maxFormationSpeed;
+        s.completionThreshold = p.completionThreshold;
+        s.rotationOffset = p.rotationOffset;
+        s.isPlanar = p.isPlanar != 0;
+        s.instantFormation = p.instantFormation != 0;
+        s.graph.allowRingAtoms = p.allowRingAtoms != 0;
+        s.graph.reorganize = p.reorganize != 0;
+        for (uint64_t k = p.labelBegin; k < (uint64_t)p.labelBegin + p.labelCount && k < labelCount; k++) s.graph.labels.push_back(labels[k]);
+        for (uint64_t k = p.edgeBegin; k < (uint64_t)p.edgeBegin + p.edgeCount && k < edgeCount; k++) s.graph.edges.push_back({ edges[k].a, edges[k].b });
+        if (!s.graph.finalize()) {
+            TraceLog(LOG_WARNING, "[DATA PACK] Structure '%s' graph failed to finalize; skipped", s.name.c_str());
+            continue;
+        }
+        out.push_back(std::move(s));
+    }
+    return out;
+}
+
+bool DataPack::loadStrings(const std::string& lang, std::unordered_map<std::string, std::string>& out) const {
+    const uint32_t* row = languageRow(lang);
+    if (!row) return false;
+    const PackedUiString* packed = reinterpret_cast<const PackedUiString*>(sections[SECTION_UI_STRINGS].data);
+    out.clear();
+    out.reserve(sections[SECTION_UI_STRINGS].count);
+    for (uint64_t i = 0; i < sections[SECTION_UI_STRINGS].count; i++) {
+        out.emplace(str(packed[i].key), text(row, packed[i].text));
+    }
+    return true;
+}
+
+bool DataPack::relocalize(std::vector<Element>& elements, const std::string& lang) const {
+    const uint32_t* row = languageRow(lang);
+    if (!row) return false;
+    const PackedElement* packed = reinterpret_cast<const PackedElement*>(sections[SECTION_ELEMENTS].data);
+    for (uint64_t i = 0; i < sections[SECTION_ELEMENTS].count; i++) {
+        const PackedElement& p = packed[i];
+        if (p.atomicNumber < 0 || p.atomicNumber >= (int)elements.size()) continue;
+        Element& el = elements[p.atomicNumber];
+        if (el.atomicNumber != p.atomicNumber) continue;  // Slot not loaded from this pack
+        el.name = text(row, p.name);
+        el.category = text(row, p.category);
+        el.description = text(row, p.description);
+        el.origin = text(row, p.origin);
+        el.discoveryHint = text(row, p.discoveryHint);
+    }
+    return true;
+}
+
+bool DataPack::relocalize(std::vector<Molecule>& molecules, const std::string& lang) const {
+    const uint32_t* row = languageRow(lang);
+    if (!row) return false;
+    std::unordered_map<std::string_view, Molecule*> byId;
+    byId.reserve(molecules.size());
+    for (Molecule& m : molecules) byId.emplace(m.id, &m);
+    const PackedMolecule* packed = reinterpret_cast<const PackedMolecule*>(sections[SECTION_MOLECULES].data);
+    for (uint64_t i = 0; i < sections[SECTION_MOLECULES].count; i++) {
+        const PackedMolecule& p = packed[i];
+        auto it = byId.find(str(p.id));
+        if (it == byId.end()) continue;
+        Molecule& m = *it->second;
+        m.name = text(row, p.name);
+        m.description = text(row, p.description);
+        m.biologicalSignificance = text(row, p.biologicalSignificance);
+        m.origin = text(row, p.origin);
+    }
+    return true;
+}
+
+bool DataPack::relocalize(std::vector<Mission>& missions, const std::string& lang) const {
+    const uint32_t* row = languageRow(lang);
+    if (!row) return false;
+    std::unordered_map<std::string_view, Mission*> byId;
+    byId.reserve(missions.size());
+    for (Mission& m : missions) byId.emplace(m.id, &m);
+    const PackedMission* packed = reinterpret_cast<const PackedMission*>(sections[SECTION_MISSIONS].data);
+    for (uint64_t i = 0; i < sections[SECTION_MISSIONS].count; i++) {
+        const PackedMission& p = packed[i];
+        auto it = byId.find(str(p.id));
+        if (it == byId.end()) continue;
+        Mission& m = *it->second;
+        m.title = text(row, p.title);
+        m.description = text(row, p.description);
+        m.scientificContext = text(row, p.scientificContext);
+    }
+    return true;
+}
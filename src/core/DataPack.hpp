@@ -0,0 +1,86 @@
+#ifndef DATA_PACK_HPP
+#define DATA_PACK_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include "MappedFile.hpp"
+
+struct Element;
+struct Molecule;
+struct Mission;
+struct StructureDefinition;
+
+/**
+ * DataPack (Phase 63)
+ * Precompiled, memory-mapped copy of the data JSON: elements, molecules,
+ * missions, structures and every lang_*.json, validated once at build time
+ * by JsonLoader (validateElement, structure graph checks).
+ *
+ *   Header   magic "LSPACK", version, byte-order tag, section/language/text
+ *            counts, file size
+ *   Table    sectionCount x { id, elementSize, offset, count }
+ *   Sections 16-byte aligned: string pool (NUL-terminated, deduplicated),
+ *            languages, text table (languageCount x textCount pool offsets),
+ *            fixed-layout records for each data set, source-file stamps
+ *
+ * Every localised field is a text id; a language is one row of the text
+ * table. Decoded records own std::string copies, so switching language
+ * re-copies only their text fields from the new row (relocalize), with no
+ * file access, parsing or index rebuild; numeric data and mission progress
+ * are left alone. The pack is ignored (JSON stays in charge) when it is
+ * missing, corrupt, or any source JSON next to it changed since the build.
+ */
+class DataPack {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    // Opened lazily from Config::DATA_PACK_PATH on first use
+    static DataPack& getInstance();
+
+    // Reads and validates dataDir's JSON for every lang_*.json language; false + error on failure
+    static bool build(const std::string& dataDir, const std::string& outPath, std::string& error);
+
+    // Maps the pack; dataDir is where its source JSON lives (for the staleness check)
+    bool open(const std::string& path, const std::string& dataDir);
+    void close();
+
+    bool isOpen() const { return file.isOpen(); }
+    bool hasLanguage(const std::string& lang) const { return languageRow(lang) != nullptr; }
+
+    // True if the pack was built from this JSON file (e.g. "data/structures.json")
+    bool covers(const std::string& jsonPath) const;
+
+    // Decoded records, identical to the JsonLoader results for the same language
+    std::vector<Element> loadElements(const std::string& lang) const;
+    std::vector<Molecule> loadMolecules(const std::string& lang) const;
+    std::vector<Mission> loadMissions(const std::string& lang) const;
+    std::vector<StructureDefinition> loadStructures() const;
+    bool loadStrings(const std::string& lang, std::unordered_map<std::string, std::string>& out) const;
+
+    // Rewrites only the localised text of records decoded earlier (elements by atomic-number
+    // slot, molecules and missions by id) from lang's row; false if the pack lacks lang
+    bool relocalize(std::vector<Element>& elements, const std::string& lang) const;
+    bool relocalize(std::vector<Molecule>& molecules, const std::string& lang) const;
+    bool relocalize(std::vector<Mission>& missions, const std::string& lang) const;
+
+private:
+    struct SectionView {
+        const char* data = nullptr;
+        uint64_t count = 0;
+    };
+
+    MappedFile file;
+    std::string sourceDir;
+    std::vector<SectionView> sections;  // By section id
+    uint32_t textCount = 0;
+
+    const uint32_t* languageRow(const std::string& lang) const;
+    const char* str(uint32_t offset) const;
+    const char* text(const uint32_t* row, uint32_t textId) const;
+    bool sourcesUnchanged() const;
+};
+
+#endif // DATA_PACK_HPP
@@ -0,0 +1,134 @@
+#include "HotReloader.hpp"
+#include "Config.hpp"
+#include "DataPack.hpp"
+#include "JsonLoader.hpp"
+#include "LocalizationManager.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+#include "raylib.h"
+#include <filesystem>
+#include <chrono>
+
+namespace fs = std::filesystem;
+
+bool HotReloader::stamp(const std::string& path, uint64_t& size, int64_t& modified) {
+    std::error_code ec;
+    size = (uint64_t)fs::file_size(path, ec);
+    if (ec) return false;
+    auto time = fs::last_write_time(path, ec);
+    if (ec) return false;
+    modified = (int64_t)time.time_since_epoch().count();
+    return true;
+}
+
+void HotReloader::watch(const std::string& dataDir) {
+    files = {
+        { ELEMENTS, dataDir + "/elements.json" },
+        { MOLECULES, dataDir + "/molecules.json" },
+        { STRUCTURES, dataDir + "/structures.json" }
+    };
+    for (WatchedFile& f : files) stamp(f.path, f.size, f.modified);
+}
+
+void HotReloader::start(const std::string& dataDir) {
+    stop();
+    watch(dataDir);
+    stopping = false;
+    worker = std::thread(&HotReloader::run, this);
+    TraceLog(LOG_INFO, "[HOT RELOAD] Watching %s every %d ms", dataDir.c_str(), Config::HOT_RELOAD_POLL_MS);
+}
+
+void HotReloader::stop() {
+    if (!worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+void HotReloader::run() {
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    while (!stopping) {
+        wake.wait_for(lock, std::chrono::milliseconds(Config::HOT_RELOAD_POLL_MS), [this]() { return stopping; });
+        if (stopping) break;
+        lock.unlock();
+        poll();
+        lock.lock();
+    }
+}
+
+void HotReloader::poll() {
+    for (WatchedFile& f : files) {
+        uint64_t size = 0;
+        int64_t modified = 0;
+        if (!stamp(f.path, size, modified) || (size == f.size && modified == f.modified)) continue;
+        f.size = size;
+        f.modified = modified;
+
+        PendingUpdate update;
+        update.kind = f.kind;
+        update.lang = LocalizationManager::getInstance().getLanguageCode();
+        try {
+            switch (f.kind) {
+                case ELEMENTS: update.elements = JsonLoader::loadElements(f.path, update.lang); break;
+                case MOLECULES: update.molecules = JsonLoader::loadMolecules(f.path, update.lang); break;
+                case STRUCTURES: update.structures = JsonLoader::loadStructures(f.path); break;
+            }
+        } catch (const std::exception& e) {
+            TraceLog(LOG_WARNING, "[HOT RELOAD] %s not applied: %s", f.path.c_str(), e.what());
+            std::lock_guard<std::mutex> lock(mutex);
+            stats.parseFailures++;
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.filesParsed++;
+        // A newer parse of the same file replaces one still waiting
+        for (auto it = pending.begin(); it != pending.end(); ++it) {
+            if (it->kind == update.kind) { pending.erase(it); break; }
+        }
+        pending.push_back(std::move(update));
+    }
+}
+
+uint32_t HotReloader::applyPending() {
+    std::vector<PendingUpdate> updates;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.empty()) return 0;
+        updates.swap(pending);
+    }
+
+    // The pack was built from the old JSON: later loads (e.g. F1) must read the files
+    DataPack::getInstance().close();
+
+    uint32_t applied = 0;
+    long long failures = 0;
+    const std::string lang = LocalizationManager::getInstance().getLanguageCode();
+    for (PendingUpdate& u : updates) {
+        if (u.kind != STRUCTURES && u.lang != lang) continue;  // Language switched meanwhile; its reload read the new file
+        try {
+            switch (u.kind) {
+                case ELEMENTS: ChemistryDatabase::getInstance().applyElements(u.elements); break;
+                case MOLECULES: ChemistryDatabase::getInstance().applyMolecules(std::move(u.molecules)); break;
+                case STRUCTURES: StructureRegistry::getInstance().replaceStructures(std::move(u.structures)); break;
+            }
+            applied |= u.kind;
+        } catch (const std::exception& e) {
+            TraceLog(LOG_WARNING, "[HOT RELOAD] Rejected update: %s", e.what());
+            failures++;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (uint32_t bits = applied; bits; bits &= bits - 1) stats.filesApplied++;
+    stats.applyFailures += failures;
+    return applied;
+}
+
+HotReloadStats HotReloader::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
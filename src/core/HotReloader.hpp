@@ -0,0 +1,95 @@
+#ifndef HOT_RELOADER_HPP
+#define HOT_RELOADER_HPP
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include "../chemistry/Element.hpp"
+#include "../chemistry/Molecule.hpp"
+#include "../chemistry/StructureDefinition.hpp"
+
+struct HotReloadStats {
+    long long filesParsed = 0;
+    long long filesApplied = 0;
+    long long parseFailures = 0;
+    long long applyFailures = 0;
+};
+
+/**
+ * HotReloader (Phase 64)
+ * Watches elements.json, molecules.json and structures.json. A background
+ * thread compares each file's size and modification time every
+ * Config::HOT_RELOAD_POLL_MS and re-parses only the file that changed
+ * (through JsonLoader, so the usual validation applies). The parsed result
+ * waits until the main thread calls applyPending() between two fixed steps,
+ * which swaps it into ChemistryDatabase or StructureRegistry in one go. The
+ * world is never rebuilt: atoms keep their indices, bonds and ring state, and
+ * pick the new parameters up on the next tick.
+ *
+ * A file that fails to parse (e.g. caught mid-save) is skipped until it
+ * changes again; the data in use stays as it was.
+ */
+class HotReloader {
+public:
+    enum File : uint32_t {
+        ELEMENTS = 1u << 0,
+        MOLECULES = 1u << 1,
+        STRUCTURES = 1u << 2
+    };
+
+    HotReloader() = default;
+    ~HotReloader() { stop(); }
+    HotReloader(const HotReloader&) = delete;
+    HotReloader& operator=(const HotReloader&) = delete;
+
+    // Records the current stamps of dataDir's files; only later changes are reloaded
+    void watch(const std::string& dataDir);
+
+    // watch() plus the background thread that calls poll()
+    void start(const std::string& dataDir);
+    void stop();
+
+    // One synchronous scan: parses files whose stamp changed (the watch thread calls this)
+    void poll();
+
+    // Main thread, between ticks. Returns the File bits that were applied
+    uint32_t applyPending();
+
+    HotReloadStats getStats() const;
+
+private:
+    struct WatchedFile {
+        File kind;
+        std::string path;
+        uint64_t size = 0;
+        int64_t modified = 0;
+    };
+
+    struct PendingUpdate {
+        File kind;
+        std::string lang;  // Language the localised fields were read in
+        std::vector<Element> elements;
+        std::vector<Molecule> molecules;
+        std::vector<StructureDefinition> structures;
+    };
+
+    std::vector<WatchedFile> files;  // Touched only by poll()
+
+    mutable std::mutex mutex;       // Guards pending and stats
+    std::vector<PendingUpdate> pending;
+    HotReloadStats stats;
+
+    std::thread worker;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    void run();
+    static bool stamp(const std::string& path, uint64_t& size, int64_t& modified);
+};
+
+#endif // HOT_RELOADER_HPP
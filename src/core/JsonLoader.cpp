@@ -291,6 +291,28 @@ namespace JsonLoader {
             s.rotationOffset = j.value("rotationOffset", 0.0f);
             s.isPlanar = j.value("isPlanar", true);
             s.instantFormation = j.value("instantFormation", true);
+
+            // Phase 48: Optional labelled graph {"nodes": [Z...], "edges": [[a,b]...]}
+            if (j.contains("graph")) {
+                const auto& g = j["graph"];
+                if (!g.contains("nodes") || !g["nodes"].is_array() || !g.contains("edges") || !g["edges"].is_array()) {
+                    throw std::runtime_error("[JSON LOADER] Structure '" + s.name + "' graph needs 'nodes' and 'edges' arrays");
+                }
+                for (const auto& z : g["nodes"]) s.graph.labels.push_back(z.get<int>());
+                for (const auto& e : g["edges"]) {
+                    if (!e.is_array() || e.size() != 2) {
+                        throw std::runtime_error("[JSON LOADER] Structure '" + s.name + "' has a malformed edge");
+                    }
+                    s.graph.edges.push_back({e[0].get<int>(), e[1].get<int>()});
+                }
+                s.graph.allowRingAtoms = g.value("allowRingAtoms", false);
+                if (s.atomCount == 0) s.atomCount = (int)s.graph.labels.size();
+            } else {
+                s.graph = StructureTemplate::makeRing(s.atomCount, s.atomicNumber);
+            }
+            if (!s.graph.finalize()) {
+                throw std::runtime_error("[JSON LOADER] Structure '" + s.name + "' graph is disconnected or needs two cycle bonds on one atom");
+            }
             
             structures.push_back(s);
             TraceLog(LOG_INFO, "[JSON LOADER] Loaded structure definition: %s", s.name.c_str());
@@ -1,4 +1,5 @@
 #include "LocalizationManager.hpp"
+#include "DataPack.hpp"
 #include "json.hpp"
 #include <fstream>
 #include <iostream>
@@ -6,24 +7,48 @@
 
 using json = nlohmann::json;
 
-// ... (Top of file stays same, using std::lock_guard)
+LocalizationManager::LocalizationManager() : currentLanguage("es") {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    publishLocked();  // Readers always find a table, even before the first setLanguage()
+}
 
 void LocalizationManager::setLanguage(const std::string& langCode) {
-    std::lock_guard<std::mutex> lock(trMutex);
+    std::lock_guard<std::mutex> lock(writerMutex);
     currentLanguage = langCode;
+    auto found = languages.find(langCode);
+    if (found != languages.end() && found->second.loaded) {
+        const StringTable* cached = found->second.table;
+        if (cached && cached->values.size() == keys.size()) {
+            current.store(cached, std::memory_order_release);  // Nothing interned since: reuse it
+        } else {
+            publishLocked();  // New keys since this language was active; no file access
+        }
+        generation++;
+        return;
+    }
+
+    LanguageStrings& language = languages[langCode];
+    std::unordered_map<std::string, std::string>& strings = language.strings;
+    language.loaded = true;
     std::string path = "data/lang_" + langCode + ".json";
-    
-    if (!loadLanguageFile(path)) {
+
+    // Phase 63: Pre-resolved strings from the data pack skip the JSON parse
+    if (DataPack::getInstance().loadStrings(langCode, strings)) {
+        TraceLog(LOG_INFO, "[LOCALIZATION] Loaded %d strings for '%s' from data pack", (int)strings.size(), langCode.c_str());
+    } else if (!loadLanguageFile(path, strings)) {
         TraceLog(LOG_WARNING, "[LOCALIZATION] Could not load %s, falling back to English", path.c_str());
         if (langCode != "en") {
-            loadLanguageFile("data/lang_en.json");
+            loadLanguageFile("data/lang_en.json", strings);
         }
     }
+    for (const auto& entry : strings) internLocked(entry.first);
+    publishLocked();
+    generation++;
 }
 
-// loadLanguageFile is private and called inside lock, so no lock needed here, 
+// loadLanguageFile is private and called inside lock, so no lock needed here,
 // BUT we must be careful not to call public methods that lock from here (none called).
-bool LocalizationManager::loadLanguageFile(const std::string& path) {
+bool LocalizationManager::loadLanguageFile(const std::string& path, std::unordered_map<std::string, std::string>& strings) {
     std::ifstream file(path);
     if (!file.is_open()) return false;
 
@@ -42,11 +67,62 @@ bool LocalizationManager::loadLanguageFile(const std::string& path) {
     }
 }
 
+LocId LocalizationManager::internLocked(const std::string& key) {
+    auto it = keyIds.find(key);
+    if (it != keyIds.end()) return it->second;
+    LocId id = (LocId)keys.size();
+    keys.push_back(key);
+    keyIds.emplace(key, id);
+    return id;
+}
+
+// Builds an immutable table for every interned key and swaps it in
+void LocalizationManager::publishLocked() {
+    LanguageStrings& language = languages[currentLanguage];
+    const std::unordered_map<std::string, std::string>& strings = language.strings;
+    auto table = std::make_unique<StringTable>();
+    table->language = currentLanguage;
+    table->values.reserve(keys.size());
+    for (const std::string& key : keys) {
+        auto it = strings.find(key);
+        table->values.push_back(it != strings.end() ? it->second : key);  // Key as fallback
+    }
+    table->ids = keyIds;
+    language.table = table.get();
+    current.store(table.get(), std::memory_order_release);
+    tables.push_back(std::move(table));
+}
+
+LocId LocalizationManager::intern(std::string_view key) {
+    std::string k(key);
+    const StringTable* table = current.load(std::memory_order_acquire);
+    auto it = table->ids.find(k);
+    if (it != table->ids.end()) return it->second;
+
+    std::lock_guard<std::mutex> lock(writerMutex);
+    size_t before = keys.size();
+    LocId id = internLocked(k);
+    if (keys.size() != before) publishLocked();  // Not in any loaded file yet: the table must cover it
+    return id;
+}
+
+std::string_view LocalizationManager::view(LocId id) const {
+    const StringTable* table = current.load(std::memory_order_acquire);
+    if (id >= table->values.size()) return {};
+    return table->values[id];
+}
+
+const char* LocalizationManager::text(LocId id) const {
+    const StringTable* table = current.load(std::memory_order_acquire);
+    if (id >= table->values.size()) return "";
+    return table->values[id].c_str();
+}
+
 std::string LocalizationManager::get(const std::string& key) const {
-    std::lock_guard<std::mutex> lock(trMutex); 
-    auto it = strings.find(key);
-    if (it != strings.end()) {
-        return it->second;
+    const StringTable* table = current.load(std::memory_order_acquire);
+    auto it = table->ids.find(key);
+    if (it != table->ids.end()) {
+        return table->values[it->second];
     }
     return key; // Return key as fallback
 }
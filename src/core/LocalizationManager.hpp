@@ -2,11 +2,29 @@
 #define LOCALIZATION_MANAGER_HPP
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
+#include <memory>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
 #include "raylib.h"
 
+// Phase 62: Interned translation key (index into the published string table)
+using LocId = uint32_t;
+
+/**
+ * Phase 62: Readers never lock. Every key gets a LocId the first time it is
+ * seen (all keys of a language file are interned when it loads); the active
+ * translations live in an immutable table indexed by LocId and published
+ * through one atomic pointer. setLanguage() builds a new table and swaps it
+ * in (RCU style). Replaced tables are retired, not freed, so views and
+ * C strings handed out earlier stay valid for the whole run (a language
+ * swap costs one table of a few KB). Each language's strings are read once;
+ * switching back to a language whose table still covers every interned key
+ * republishes that table (a pointer store).
+ */
 class LocalizationManager {
 public:
     static LocalizationManager& getInstance() {
@@ -16,21 +34,57 @@ public:
 
     // Set the active language (e.g., "es", "en")
     void setLanguage(const std::string& langCode);
-    
-    // Get a translated string by key
+
+    // Get a translated string by key (copy; prefer LOC_ID/LOC in per-frame code)
     std::string get(const std::string& key) const;
 
+    // Stable id for a key; takes the writer lock only the first time a key is seen
+    LocId intern(std::string_view key);
+
+    // Lock-free, allocation-free lookups. Unknown keys translate to themselves
+    std::string_view view(LocId id) const;
+    const char* text(LocId id) const;
+
     // Direct access to current language code
-    std::string getLanguageCode() const { return currentLanguage; }
+    std::string getLanguageCode() const { return current.load(std::memory_order_acquire)->language; }
+
+    // Phase 61: Bumped by setLanguage(); cached translations are stale when it changes
+    int getGeneration() const { return generation.load(); }
 
 private:
-    LocalizationManager() : currentLanguage("es") {}
-    
+    struct StringTable {
+        std::string language;
+        std::vector<std::string> values;            // By LocId
+        std::unordered_map<std::string, LocId> ids; // Key -> LocId when the table was built
+    };
+
+    LocalizationManager();
+
+    std::atomic<const StringTable*> current{nullptr};
+    std::atomic<int> generation{0};
+
+    // Writer side (guarded by writerMutex)
+    mutable std::mutex writerMutex;
+    struct LanguageStrings {
+        std::unordered_map<std::string, std::string> strings;  // Raw strings of the loaded file
+        const StringTable* table = nullptr;                    // Latest table built from them
+        bool loaded = false;                                   // False for the pre-setLanguage() placeholder
+    };
     std::string currentLanguage;
-    std::unordered_map<std::string, std::string> strings;
-    mutable std::mutex trMutex; 
+    std::unordered_map<std::string, LanguageStrings> languages;  // By language code, loaded on first use
+    std::vector<std::string> keys;                          // By LocId
+    std::unordered_map<std::string, LocId> keyIds;
+    std::vector<std::unique_ptr<const StringTable>> tables; // Every published table (readers may hold views)
 
-    bool loadLanguageFile(const std::string& path);
+    bool loadLanguageFile(const std::string& path, std::unordered_map<std::string, std::string>& strings);
+    LocId internLocked(const std::string& key);
+    void publishLocked();
 };
 
+// Phase 62: Interns `key` once per call site; later evaluations are a static load
+#define LOC_ID(key) ([]() -> LocId { static const LocId id = LocalizationManager::getInstance().intern(key); return id; }())
+
+// Translated C string for a literal key, valid for the rest of the run
+#define LOC(key) (LocalizationManager::getInstance().text(LOC_ID(key)))
+
 #endif
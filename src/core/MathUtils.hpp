@@ -6,6 +6,8 @@
 #include <map>
 #include <cmath>
 #include "../ecs/components.hpp"
+#include "../ecs/HierarchyIndex.hpp"
+#include "SimulationState.hpp"
 #include <random>
 
 
@@ -41,9 +43,8 @@ namespace MathUtils {
     // Generates a random jitter between -1.0 and 1.0
     // FIX #8: Improved RNG (Mersenne Twister)
     inline float getJitter() {
-        static std::mt19937 rng(std::random_device{}());
         static std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-        return dist(rng);
+        return dist(SimulationState::getInstance().getJitterRng());  // Phase 53: Snapshot-able state
     }
 
 
@@ -165,44 +166,9 @@ namespace MathUtils {
 
     // Calculates the number of hops between two connected atoms in the hierarchy
     // Returns -1 if they are not connected or if an error occurs
+    // Phase 70: O(log d) via HierarchyIndex (was parent chains capped at 100 and an O(d^2) match)
     inline int getHierarchyDistance(int i, int j, const std::vector<StateComponent>& states) {
-        if (i < 0 || j < 0 || i >= (int)states.size() || j >= (int)states.size()) return -1;
-        if (i == j) return 0;
-
-        // Trace path from i to root
-        std::vector<int> pathI;
-        int currI = i;
-        int safetyI = 0;
-        const int MAX_DEPTH = 100;
-        
-        while (currI != -1 && safetyI < MAX_DEPTH) {
-            pathI.push_back(currI);
-            currI = states[currI].parentEntityId;
-            safetyI++;
-        }
-
-        // Trace path from j to root
-        std::vector<int> pathJ;
-        int currJ = j;
-        int safetyJ = 0;
-        
-        while (currJ != -1 && safetyJ < MAX_DEPTH) {
-            pathJ.push_back(currJ);
-            currJ = states[currJ].parentEntityId;
-            safetyJ++;
-        }
-
-        // Find Least Common Ancestor
-        for (int disI = 0; disI < (int)pathI.size(); disI++) {
-            for (int disJ = 0; disJ < (int)pathJ.size(); disJ++) {
-                if (pathI[disI] == pathJ[disJ]) {
-                    // Distance is sum of steps to LCA
-                    return disI + disJ;
-                }
-            }
-        }
-
-        return -1; // Not connected in hierarchy
+        return HierarchyIndex::getInstance().distance(i, j, states);
     }
 
 }
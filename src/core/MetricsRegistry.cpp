@@ -0,0 +1,236 @@
+#include "MetricsRegistry.hpp"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "raylib.h"
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+MetricHistogram::MetricHistogram(std::vector<double> b)
+    : bounds(std::move(b)), buckets(new std::atomic<long long>[bounds.size() + 1]) {
+    for (size_t i = 0; i <= bounds.size(); i++) buckets[i].store(0, std::memory_order_relaxed);
+}
+
+double MetricHistogram::quantile(double q) const {
+    long long total = 0;
+    for (size_t i = 0; i <= bounds.size(); i++) total += getBucket(i);
+    if (total == 0) return 0.0;
+
+    double rank = q * (double)total;
+    long long seen = 0;
+    for (size_t i = 0; i <= bounds.size(); i++) {
+        long long inBucket = getBucket(i);
+        if (inBucket > 0 && (double)(seen + inBucket) >= rank) {
+            if (i == bounds.size()) return bounds.empty() ? 0.0 : bounds.back();  // +Inf: clamp to the last edge
+            double lower = (i == 0) ? 0.0 : bounds[i - 1];
+            double fraction = (rank - (double)seen) / (double)inBucket;
+            if (fraction < 0.0) fraction = 0.0;
+            return lower + (bounds[i] - lower) * fraction;
+        }
+        seen += inBucket;
+    }
+    return bounds.empty() ? 0.0 : bounds.back();
+}
+
+void MetricHistogram::reset() {
+    for (size_t i = 0; i <= bounds.size(); i++) buckets[i].store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0.0, std::memory_order_relaxed);
+}
+
+HistogramShard::HistogramShard(const MetricHistogram& target)
+    : bounds(target.bounds), counts(target.bounds.size() + 1, 0) {}
+
+void HistogramShard::observe(double v) {
+    size_t i = 0;
+    while (i < bounds.size() && v > bounds[i]) i++;
+    counts[i]++;
+    count++;
+    sum += v;
+}
+
+void HistogramShard::merge(MetricHistogram& target) {
+    if constexpr (Config::METRICS_ENABLED) {
+        if (count == 0) return;
+        for (size_t i = 0; i < counts.size(); i++) {
+            if (counts[i] != 0) target.buckets[i].fetch_add(counts[i], std::memory_order_relaxed);
+        }
+        target.count.fetch_add(count, std::memory_order_relaxed);
+        target.addSum(sum);
+    }
+    std::fill(counts.begin(), counts.end(), 0);
+    count = 0;
+    sum = 0.0;
+}
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+MetricsRegistry& MetricsRegistry::getInstance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+MetricsRegistry::MetricsRegistry()
+    : cellOccupancy({1, 2, 4, 8, 16, 32, 64, 128}),
+      neighboursPerQuery({0, 4, 8, 16, 32, 64, 128, 256, 512}),
+      tickDurationMs({0.25, 0.5, 1, 2, 4, 8, 16, 33, 66}) {
+    add("sim_bonds_formed", "Bonds created (tree and cycle)", Kind::COUNTER, &bondsFormed);
+    add("sim_bonds_broken", "Bonds removed for any reason", Kind::COUNTER, &bondsBroken);
+    add("sim_stress_breaks", "Bonds torn apart by spring stress", Kind::COUNTER, &stressBreaks);
+    add("sim_rings_formed", "Ring closures", Kind::COUNTER, &ringsFormed);
+    add("sim_rings_invalidated", "Ring instances dissolved", Kind::COUNTER, &ringsInvalidated);
+    add("sim_structures_frozen", "Rings frozen into rigid structures", Kind::COUNTER, &structuresFrozen);
+    add("sim_grid_occupied_cells", "Occupied spatial grid cells", Kind::GAUGE, &occupiedCells);
+    add("sim_grid_cell_occupancy", "Atoms per occupied grid cell", Kind::HISTOGRAM, &cellOccupancy);
+    add("sim_grid_neighbours_per_query", "Candidates per neighbourhood query", Kind::HISTOGRAM, &neighboursPerQuery);
+    add("sim_tick_duration_ms", "Fixed step wall time in milliseconds", Kind::HISTOGRAM, &tickDurationMs);
+}
+
+void MetricsRegistry::add(const std::string& name, const std::string& help, Kind kind, void* metric) {
+    Entry e;
+    e.name = name;
+    e.help = help;
+    e.kind = kind;
+    e.metric = metric;
+    entries.push_back(e);
+}
+
+MetricsRegistry::Entry* MetricsRegistry::find(const std::string& name, Kind kind) {
+    for (auto& e : entries) {
+        if (e.name != name) continue;
+        if (e.kind != kind) {
+            TraceLog(LOG_WARNING, "[METRICS] '%s' is already registered as another type", name.c_str());
+            return nullptr;
+        }
+        return &e;
+    }
+    return nullptr;
+}
+
+MetricCounter& MetricsRegistry::counter(const std::string& name, const std::string& help) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (Entry* e = find(name, Kind::COUNTER)) return *static_cast<MetricCounter*>(e->metric);
+    ownedCounters.push_back(std::make_unique<MetricCounter>());
+    add(name, help, Kind::COUNTER, ownedCounters.back().get());
+    return *ownedCounters.back();
+}
+
+MetricGauge& MetricsRegistry::gauge(const std::string& name, const std::string& help) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (Entry* e = find(name, Kind::GAUGE)) return *static_cast<MetricGauge*>(e->metric);
+    ownedGauges.push_back(std::make_unique<MetricGauge>());
+    add(name, help, Kind::GAUGE, ownedGauges.back().get());
+    return *ownedGauges.back();
+}
+
+MetricHistogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, std::vector<double> bounds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (Entry* e = find(name, Kind::HISTOGRAM)) return *static_cast<MetricHistogram*>(e->metric);
+    ownedHistograms.push_back(std::make_unique<MetricHistogram>(std::move(bounds)));
+    add(name, help, Kind::HISTOGRAM, ownedHistograms.back().get());
+    return *ownedHistograms.back();
+}
+
+static void appendLine(std::string& out, const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    out += line;
+}
+
+std::string MetricsRegistry::renderText() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = hasSnapshot ? std::chrono::duration<double>(now - lastSnapshot).count() : 0.0;
+    lastSnapshot = now;
+    hasSnapshot = true;
+
+    std::string out;
+    out.reserve(4096);
+    for (auto& e : entries) {
+        const char* name = e.name.c_str();
+        switch (e.kind) {
+            case Kind::COUNTER: {
+                long long value = static_cast<MetricCounter*>(e.metric)->get();
+                appendLine(out, "# TYPE %s counter\n# HELP %s %s\n", name, name, e.help.c_str());
+                appendLine(out, "%s_total %lld\n", name, value);
+                // Counters can go backwards only through reset(); report that interval as zero
+                double rate = (elapsed > 0.0 && value >= e.lastValue) ? (double)(value - e.lastValue) / elapsed : 0.0;
+                appendLine(out, "# TYPE %s_per_second gauge\n%s_per_second %.3f\n", name, name, rate);
+                e.lastValue = value;
+                break;
+            }
+            case Kind::GAUGE: {
+                appendLine(out, "# TYPE %s gauge\n# HELP %s %s\n", name, name, e.help.c_str());
+                appendLine(out, "%s %g\n", name, static_cast<MetricGauge*>(e.metric)->get());
+                break;
+            }
+            case Kind::HISTOGRAM: {
+                const MetricHistogram& h = *static_cast<MetricHistogram*>(e.metric);
+                const auto& bounds = h.getBounds();
+                appendLine(out, "# TYPE %s histogram\n# HELP %s %s\n", name, name, e.help.c_str());
+                long long cumulative = 0;
+                for (size_t i = 0; i < bounds.size(); i++) {
+                    cumulative += h.getBucket(i);
+                    appendLine(out, "%s_bucket{le=\"%g\"} %lld\n", name, bounds[i], cumulative);
+                }
+                cumulative += h.getBucket(bounds.size());
+                // Buckets are read one by one while writers continue; count follows them so the output stays consistent
+                appendLine(out, "%s_bucket{le=\"+Inf\"} %lld\n", name, cumulative);
+                appendLine(out, "%s_count %lld\n%s_sum %g\n", name, cumulative, name, h.getSum());
+                appendLine(out, "# TYPE %s_quantile gauge\n", name);
+                appendLine(out, "%s_quantile{quantile=\"0.5\"} %g\n", name, h.quantile(0.5));
+                appendLine(out, "%s_quantile{quantile=\"0.95\"} %g\n", name, h.quantile(0.95));
+                appendLine(out, "%s_quantile{quantile=\"0.99\"} %g\n", name, h.quantile(0.99));
+                break;
+            }
+        }
+    }
+    out += "# EOF\n";
+    return out;
+}
+
+bool MetricsRegistry::writeSnapshot(const std::string& path) {
+    std::string text = renderText();
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            TraceLog(LOG_WARNING, "[METRICS] Cannot write %s", tmpPath.c_str());
+            return false;
+        }
+        file.write(text.data(), (std::streamsize)text.size());
+        if (!file) return false;
+    }
+    std::error_code ec;
+    fs::rename(tmpPath, path, ec);
+    if (ec) {
+        TraceLog(LOG_WARNING, "[METRICS] Cannot replace %s: %s", path.c_str(), ec.message().c_str());
+        return false;
+    }
+    return true;
+}
+
+void MetricsRegistry::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& e : entries) {
+        switch (e.kind) {
+            case Kind::COUNTER:   static_cast<MetricCounter*>(e.metric)->reset(); break;
+            case Kind::GAUGE:     static_cast<MetricGauge*>(e.metric)->reset(); break;
+            case Kind::HISTOGRAM: static_cast<MetricHistogram*>(e.metric)->reset(); break;
+        }
+        e.lastValue = 0;
+    }
+    hasSnapshot = false;
+}
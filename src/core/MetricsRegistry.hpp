@@ -0,0 +1,166 @@
+#ifndef METRICS_REGISTRY_HPP
+#define METRICS_REGISTRY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Config.hpp"
+
+/**
+ * Metric primitives (Phase 66)
+ * Updated from the simulation hot paths with relaxed atomics: no ordering is
+ * needed because a snapshot only has to be a recent value, not a consistent
+ * cut. Every update compiles away when Config::METRICS_ENABLED is false.
+ */
+class MetricCounter {
+public:
+    void inc(long long n = 1) {
+        if constexpr (Config::METRICS_ENABLED) value.fetch_add(n, std::memory_order_relaxed);
+    }
+    long long get() const { return value.load(std::memory_order_relaxed); }
+    void reset() { value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<long long> value{0};
+};
+
+class MetricGauge {
+public:
+    void set(double v) {
+        if constexpr (Config::METRICS_ENABLED) value.store(v, std::memory_order_relaxed);
+    }
+    double get() const { return value.load(std::memory_order_relaxed); }
+    void reset() { value.store(0.0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> value{0.0};
+};
+
+class MetricHistogram;
+
+// Plain (non-atomic) bucket counts for one thread or one pass; merge() adds
+// them to the shared histogram with one atomic op per touched bucket
+class HistogramShard {
+public:
+    explicit HistogramShard(const MetricHistogram& target);
+    void observe(double v);
+    void merge(MetricHistogram& target);
+
+private:
+    const std::vector<double>& bounds;
+    std::vector<long long> counts;
+    long long count = 0;
+    double sum = 0.0;
+};
+
+class MetricHistogram {
+public:
+    // `bounds` are ascending bucket upper limits; a final +Inf bucket is implied
+    explicit MetricHistogram(std::vector<double> bounds);
+
+    void observe(double v) {
+        if constexpr (Config::METRICS_ENABLED) {
+            buckets[bucketFor(v)].fetch_add(1, std::memory_order_relaxed);
+            count.fetch_add(1, std::memory_order_relaxed);
+            addSum(v);
+        }
+    }
+
+    // Linear interpolation inside the bucket holding the q-th observation
+    double quantile(double q) const;
+
+    const std::vector<double>& getBounds() const { return bounds; }
+    long long getBucket(size_t i) const { return buckets[i].load(std::memory_order_relaxed); }
+    long long getCount() const { return count.load(std::memory_order_relaxed); }
+    double getSum() const { return sum.load(std::memory_order_relaxed); }
+    void reset();
+
+private:
+    friend class HistogramShard;
+
+    std::vector<double> bounds;
+    std::unique_ptr<std::atomic<long long>[]> buckets;  // bounds.size() + 1 (+Inf)
+    std::atomic<long long> count{0};
+    std::atomic<double> sum{0.0};
+
+    size_t bucketFor(double v) const {
+        size_t i = 0;
+        while (i < bounds.size() && v > bounds[i]) i++;
+        return i;
+    }
+    void addSum(double v) {
+        double cur = sum.load(std::memory_order_relaxed);
+        while (!sum.compare_exchange_weak(cur, cur + v, std::memory_order_relaxed)) {}
+    }
+};
+
+/**
+ * MetricsRegistry (Phase 66)
+ * Named counters, gauges and histograms for watching long runs without a
+ * profiler. The simulation's own metrics are members so hot paths reach them
+ * without a lookup; other code may register more by name (registration takes
+ * a lock, updates never do, and returned references stay valid).
+ *
+ * writeSnapshot() renders every metric in the OpenMetrics text format, plus a
+ * "<counter>_per_second" gauge over the interval since the previous snapshot
+ * and p50/p95/p99 gauges per histogram, and replaces the file atomically so
+ * a reader never sees a partial snapshot.
+ */
+class MetricsRegistry {
+public:
+    static MetricsRegistry& getInstance();
+
+    // --- Simulation metrics ---
+    MetricCounter bondsFormed;          // Tree and cycle bonds (TopologyEvents)
+    MetricCounter bondsBroken;
+    MetricCounter stressBreaks;         // Bonds torn apart in applyBondSprings
+    MetricCounter ringsFormed;
+    MetricCounter ringsInvalidated;
+    MetricCounter structuresFrozen;
+    MetricGauge occupiedCells;          // Spatial grid, after the last update
+    MetricHistogram cellOccupancy;      // Atoms per occupied grid cell
+    MetricHistogram neighboursPerQuery; // Candidates returned by SpatialGrid::getNearby
+    MetricHistogram tickDurationMs;     // One fixed simulation step
+
+    MetricCounter& counter(const std::string& name, const std::string& help);
+    MetricGauge& gauge(const std::string& name, const std::string& help);
+    MetricHistogram& histogram(const std::string& name, const std::string& help, std::vector<double> bounds);
+
+    std::string renderText();
+    bool writeSnapshot(const std::string& path);
+
+    // Zeroes every value (tests)
+    void reset();
+
+private:
+    enum class Kind { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Entry {
+        std::string name;
+        std::string help;
+        Kind kind;
+        void* metric;
+        long long lastValue = 0;  // Counter value at the previous snapshot
+    };
+
+    MetricsRegistry();
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    void add(const std::string& name, const std::string& help, Kind kind, void* metric);
+    Entry* find(const std::string& name, Kind kind);
+
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    std::vector<std::unique_ptr<MetricCounter>> ownedCounters;
+    std::vector<std::unique_ptr<MetricGauge>> ownedGauges;
+    std::vector<std::unique_ptr<MetricHistogram>> ownedHistograms;
+    std::chrono::steady_clock::time_point lastSnapshot;
+    bool hasSnapshot = false;
+};
+
+#endif // METRICS_REGISTRY_HPP
@@ -0,0 +1,88 @@
+#ifndef SIMULATION_STATE_HPP
+#define SIMULATION_STATE_HPP
+
+#include <random>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <utility>
+#include "../physics/TopologyEvents.hpp"
+
+/**
+ * SimulationState (Phase 53)
+ * Mutable simulation-wide state that used to live in function-local statics:
+ * the thermal jitter RNG and the ring/structure id counters. Kept in one
+ * place so snapshots can save and restore it together with the world.
+ *
+ * Phase 55: Also the world-generation RNG (replaces raylib's GetRandomValue),
+ * and seed() for deterministic runs.
+ *
+ * A process-wide singleton, not world state: it and the TopologyEvents clock
+ * are shared by every World in the process. Seeded worlds may run one after
+ * another, never interleaved; compare parallel runs across processes instead.
+ */
+class SimulationState {
+public:
+    static SimulationState& getInstance() {
+        static SimulationState instance;
+        return instance;
+    }
+
+    static constexpr int MAX_RING_ID = 1000000;
+
+    // FIX #3: Ring Instance ID Overflow Protection (wraps instead of overflowing)
+    int allocateRingId() {
+        int id = nextRingId++;
+        if (nextRingId >= MAX_RING_ID) nextRingId = 1;
+        return id;
+    }
+    int allocateStructureId() { return nextStructureId++; }
+
+    std::mt19937& getJitterRng() { return jitterRng; }
+
+    // Inclusive range like GetRandomValue, but reproducible from the seed on every platform
+    int randomInt(int min, int max) {
+        if (max < min) std::swap(min, max);
+        uint32_t span = (uint32_t)((int64_t)max - min + 1);
+        return span == 0 ? (int)jitterRng() : min + (int)(jitterRng() % span);
+    }
+
+    // Phase 55: Deterministic mode. Resets the RNG, the id counters and the topology clock
+    // (topologyVersion is part of the state hash, so two seeded runs must start it at 0).
+    void seed(uint32_t value) {
+        jitterRng.seed(value);
+        nextRingId = 1;
+        nextStructureId = 1;
+        TopologyEvents::getInstance().restore(0, 0, 0);
+    }
+
+    int getNextRingId() const { return nextRingId; }
+    int getNextStructureId() const { return nextStructureId; }
+
+    // mt19937 state in its standard textual form (portable across builds)
+    std::string serializeRng() const {
+        std::ostringstream out;
+        out << jitterRng;
+        return out.str();
+    }
+
+    bool restore(int ringId, int structureId, const std::string& rngState) {
+        std::istringstream in(rngState);
+        std::mt19937 rng;
+        in >> rng;
+        if (in.fail()) return false;
+        jitterRng = rng;
+        nextRingId = ringId;
+        nextStructureId = structureId;
+        return true;
+    }
+
+private:
+    SimulationState() : jitterRng(std::random_device{}()) {}
+
+    std::mt19937 jitterRng;
+    int nextRingId = 1;
+    int nextStructureId = 1;
+};
+
+#endif // SIMULATION_STATE_HPP
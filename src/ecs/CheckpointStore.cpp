@@ -0,0 +1,174 @@
+#include "CheckpointStore.hpp"
+#include "../core/Config.hpp"
+#include <cstring>
+#include <algorithm>
+
+namespace {
+    constexpr size_t PAGE = (size_t)Config::CHECKPOINT_PAGE_ENTITIES;
+    constexpr size_t BUDGET_BYTES = (size_t)Config::UNDO_MEMORY_BUDGET_KB * 1024;
+
+    template <typename T>
+    using PageList = std::vector<std::shared_ptr<const std::vector<T>>>;
+
+    // Bitwise, so -0/+0 and NaN payloads count as changes (restores are exact)
+    bool sameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+    bool same(const TransformComponent& a, const TransformComponent& b) {
+        return std::memcmp(&a, &b, sizeof(TransformComponent)) == 0;
+    }
+
+    bool same(const AtomComponent& a, const AtomComponent& b) {
+        return a.atomicNumber == b.atomicNumber && sameBits(a.partialCharge, b.partialCharge);
+    }
+
+    bool same(const StateComponent& a, const StateComponent& b) {
+        return a.isClustered == b.isClustered && a.moleculeId == b.moleculeId && a.parentEntityId == b.parentEntityId &&
+               a.parentSlotIndex == b.parentSlotIndex && sameBits(a.dockingProgress, b.dockingProgress) &&
+               a.isShielded == b.isShielded && a.childCount == b.childCount && a.occupiedSlots == b.occupiedSlots &&
+               a.cycleBondId == b.cycleBondId && a.isInRing == b.isInRing && a.ringSize == b.ringSize &&
+               a.ringIndex == b.ringIndex && a.ringInstanceId == b.ringInstanceId &&
+               sameBits(a.targetX, b.targetX) && sameBits(a.targetY, b.targetY) &&
+               a.structureId == b.structureId && a.isFrozen == b.isFrozen && a.justBonded == b.justBonded &&
+               sameBits(a.releaseTimer, b.releaseTimer) && a.topologyVersion == b.topologyVersion &&
+               a.structureCheckedVersion == b.structureCheckedVersion &&
+               a.structureCheckedGeneration == b.structureCheckedGeneration && a.isAlive == b.isAlive &&
+               a.childList == b.childList;
+    }
+
+    // Plain-data pages compare in one pass; same() is bitwise for both, so this agrees with it
+    static_assert(sizeof(TransformComponent) == 7 * sizeof(float), "TransformComponent has padding");
+    static_assert(sizeof(AtomComponent) == sizeof(int) + sizeof(float), "AtomComponent has padding");
+    bool samePage(const TransformComponent* live, const std::vector<TransformComponent>& page) {
+        return std::memcmp(live, page.data(), page.size() * sizeof(TransformComponent)) == 0;
+    }
+    bool samePage(const AtomComponent* live, const std::vector<AtomComponent>& page) {
+        return std::memcmp(live, page.data(), page.size() * sizeof(AtomComponent)) == 0;
+    }
+    bool samePage(const StateComponent*, const std::vector<StateComponent>&) { return false; }  // Child lists: per entity
+
+    size_t pageBytes(const std::vector<TransformComponent>& page) { return page.size() * sizeof(TransformComponent); }
+    size_t pageBytes(const std::vector<AtomComponent>& page) { return page.size() * sizeof(AtomComponent); }
+    size_t pageBytes(const std::vector<StateComponent>& page) {
+        size_t bytes = page.size() * sizeof(StateComponent);
+        for (const StateComponent& s : page) bytes += s.childList.size() * sizeof(int);
+        return bytes;
+    }
+
+    template <typename T>
+    bool pageMatches(const std::vector<T>& live, size_t begin, const std::vector<T>& page) {
+        if (std::min(live.size() - std::min(live.size(), begin), PAGE) != page.size()) return false;
+        for (size_t i = 0; i < page.size(); i++) {
+            if (!same(live[begin + i], page[i])) return false;
+        }
+        return true;
+    }
+
+    // Shares every page equal to the previous checkpoint's; returns the bytes of the new ones
+    template <typename T>
+    size_t snapshotPages(const std::vector<T>& live, const PageList<T>* prev, PageList<T>& out, CheckpointStats& stats) {
+        size_t owned = 0;
+        size_t pageCount = (live.size() + PAGE - 1) / PAGE;
+        out.resize(pageCount);
+        for (size_t p = 0; p < pageCount; p++) {
+            size_t begin = p * PAGE;
+            if (prev && p < prev->size() && pageMatches(live, begin, *(*prev)[p])) {
+                out[p] = (*prev)[p];
+                stats.pagesShared++;
+                continue;
+            }
+            size_t end = std::min(live.size(), begin + PAGE);
+            auto page = std::make_shared<const std::vector<T>>(live.begin() + begin, live.begin() + end);
+            owned += pageBytes(*page);
+            out[p] = std::move(page);
+            stats.pagesCopied++;
+        }
+        return owned;
+    }
+
+    template <typename T>
+    size_t sharedBytes(const PageList<T>& a, const PageList<T>& b) {
+        size_t bytes = 0;
+        for (size_t p = 0; p < a.size() && p < b.size(); p++) {
+            if (a[p] == b[p]) bytes += pageBytes(*a[p]);
+        }
+        return bytes;
+    }
+
+    // Writes back only the entities that differ; `changed` collects their indices
+    template <typename T>
+    void restorePages(std::vector<T>& live, const PageList<T>& pages, CheckpointStats& stats, std::vector<int>* changed) {
+        for (size_t p = 0; p < pages.size(); p++) {
+            const std::vector<T>& page = *pages[p];
+            size_t begin = p * PAGE;
+            if (samePage(live.data() + begin, page)) continue;
+            bool touched = false;
+            for (size_t i = 0; i < page.size(); i++) {
+                if (same(live[begin + i], page[i])) continue;
+                live[begin + i] = page[i];
+                if (changed) changed->push_back((int)(begin + i));
+                touched = true;
+            }
+            if (touched) stats.pagesRestored++;
+        }
+    }
+}
+
+void CheckpointStore::take(const std::vector<TransformComponent>& transforms,
+                           const std::vector<AtomComponent>& atoms,
+                           const std::vector<StateComponent>& states) {
+    const Checkpoint* prev = history.empty() ? nullptr : &history.back();
+    Checkpoint cp;
+    cp.entityCount = states.size();
+    cp.ownedBytes = snapshotPages(transforms, prev ? &prev->transforms : nullptr, cp.transforms, stats) +
+                    snapshotPages(atoms, prev ? &prev->atoms : nullptr, cp.atoms, stats) +
+                    snapshotPages(states, prev ? &prev->states : nullptr, cp.states, stats);
+    totalBytes += cp.ownedBytes;
+    history.push_back(std::move(cp));
+
+    // The newest checkpoint is always kept, even if it alone exceeds the budget
+    while (history.size() > 1 && ((int)history.size() > Config::UNDO_HISTORY_LIMIT || totalBytes > BUDGET_BYTES)) {
+        evictOldest();
+    }
+}
+
+bool CheckpointStore::restoreLatest(std::vector<TransformComponent>& transforms,
+                                    std::vector<AtomComponent>& atoms,
+                                    std::vector<StateComponent>& states,
+                                    std::vector<int>& changedStates) {
+    changedStates.clear();
+    if (history.empty()) return false;
+
+    const Checkpoint& cp = history.back();
+    bool restorable = cp.entityCount == states.size() && cp.entityCount == transforms.size() && cp.entityCount == atoms.size();
+    if (restorable) {
+        restorePages(transforms, cp.transforms, stats, nullptr);
+        restorePages(atoms, cp.atoms, stats, nullptr);
+        restorePages(states, cp.states, stats, &changedStates);
+    }
+    // Pages it shared with its predecessor stay accounted there
+    totalBytes -= cp.ownedBytes;
+    history.pop_back();
+    return restorable;
+}
+
+void CheckpointStore::clear() {
+    history.clear();
+    totalBytes = 0;
+}
+
+void CheckpointStore::evictOldest() {
+    Checkpoint& oldest = history.front();
+    size_t released = oldest.ownedBytes;
+    if (history.size() > 1) {
+        // The next checkpoint becomes the owner of every page it shared with the oldest
+        Checkpoint& next = history[1];
+        size_t inherited = sharedBytes(oldest.transforms, next.transforms) +
+                           sharedBytes(oldest.atoms, next.atoms) +
+                           sharedBytes(oldest.states, next.states);
+        next.ownedBytes += inherited;
+        released -= inherited;
+    }
+    totalBytes -= released;
+    history.pop_front();
+    stats.evicted++;
+}
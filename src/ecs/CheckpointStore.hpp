@@ -0,0 +1,72 @@
+#ifndef CHECKPOINT_STORE_HPP
+#define CHECKPOINT_STORE_HPP
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <cstddef>
+#include "components.hpp"
+
+struct CheckpointStats {
+    long long pagesCopied = 0;    // Pages allocated by take()
+    long long pagesShared = 0;    // Pages reused from the previous checkpoint
+    long long pagesRestored = 0;  // Pages written back by restoreLatest()
+    long long evicted = 0;        // Checkpoints dropped to stay within the limits
+};
+
+/**
+ * CheckpointStore (Phase 56)
+ * Stack of copy-on-write snapshots of the component arrays. Each array is
+ * cut into pages of Config::CHECKPOINT_PAGE_ENTITIES entities; a page equal
+ * to the same page of the previous checkpoint is shared (reference counted)
+ * instead of copied, so a checkpoint costs only the pages that changed since
+ * the one before it. In practice transforms change every tick while atoms
+ * and states (bonds, rings) change only where the player interacted.
+ *
+ * restoreLatest() writes back only the pages that differ from the live
+ * arrays and reports which states changed, so callers can re-stamp them.
+ * Checkpoints hold raw entity indices: the history must be cleared whenever
+ * entities are spawned, despawned or renumbered.
+ *
+ * The oldest checkpoints are dropped once the count exceeds
+ * Config::UNDO_HISTORY_LIMIT or the unshared page bytes exceed
+ * Config::UNDO_MEMORY_BUDGET_KB.
+ */
+class CheckpointStore {
+public:
+    void take(const std::vector<TransformComponent>& transforms,
+              const std::vector<AtomComponent>& atoms,
+              const std::vector<StateComponent>& states);
+
+    // Pops the newest checkpoint into the arrays; false (nothing written) if the entity count differs
+    bool restoreLatest(std::vector<TransformComponent>& transforms,
+                       std::vector<AtomComponent>& atoms,
+                       std::vector<StateComponent>& states,
+                       std::vector<int>& changedStates);
+
+    void clear();
+    bool empty() const { return history.empty(); }
+    int size() const { return (int)history.size(); }
+    size_t getMemoryBytes() const { return totalBytes; }
+    const CheckpointStats& getStats() const { return stats; }
+
+private:
+    template <typename T>
+    using Pages = std::vector<std::shared_ptr<const std::vector<T>>>;
+
+    struct Checkpoint {
+        size_t entityCount = 0;
+        Pages<TransformComponent> transforms;
+        Pages<AtomComponent> atoms;
+        Pages<StateComponent> states;
+        size_t ownedBytes = 0;  // Pages not shared with the checkpoint before it
+    };
+
+    std::deque<Checkpoint> history;
+    size_t totalBytes = 0;
+    CheckpointStats stats;
+
+    void evictOldest();
+};
+
+#endif // CHECKPOINT_STORE_HPP
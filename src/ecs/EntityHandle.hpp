@@ -0,0 +1,31 @@
+#ifndef ENTITY_HANDLE_HPP
+#define ENTITY_HANDLE_HPP
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * EntityHandle (Phase 51)
+ * Stable reference to a spawned entity. `slot` indexes World's handle table,
+ * which survives compaction; `generation` detects a despawned (and possibly
+ * reused) slot, so a stale handle resolves to -1 instead of a different atom.
+ */
+struct EntityHandle {
+    int slot = -1;
+    uint32_t generation = 0;
+
+    bool isNull() const { return slot < 0; }
+    bool operator==(const EntityHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * Applies a World::compact() remap (old index -> new index, -1 = removed)
+ * to a raw entity index held outside the ECS arrays.
+ */
+inline int remapEntityIndex(const std::vector<int>& remap, int entityId) {
+    if (entityId < 0 || entityId >= (int)remap.size()) return -1;
+    return remap[entityId];
+}
+
+#endif // ENTITY_HANDLE_HPP
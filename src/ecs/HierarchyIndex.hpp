@@ -0,0 +1,159 @@
+#ifndef HIERARCHY_INDEX_HPP
+#define HIERARCHY_INDEX_HPP
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "raylib.h"
+#include "components.hpp"
+
+/**
+ * HierarchyIndex (Phase 70)
+ * Depth and binary-lifting ancestor table over the parentEntityId forest.
+ * Answers lowest-common-ancestor and hop-distance queries in O(log d), with
+ * no depth cap, so ring closure on a long polymer costs the same as on a
+ * hexagon.
+ *
+ * MolecularHierarchy::propagateMoleculeId re-indexes the cluster it relabels,
+ * which keeps the table current on every attach and detach. Each entry also
+ * remembers the parent and topologyVersion it was built from. A query that
+ * meets a mismatch (compaction, load, undo restore, hand-edited links)
+ * re-indexes just the stale part of that atom's parent chain.
+ * Entries are built from parentEntityId alone, so childList is not required.
+ */
+class HierarchyIndex {
+public:
+    static HierarchyIndex& getInstance() {
+        static HierarchyIndex instance;
+        return instance;
+    }
+
+    // Re-indexes a cluster that was just stamped (every member carries the new version)
+    void index(const std::vector<int>& members, const std::vector<StateComponent>& states) {
+        grow(states.size());
+        bool wrote = false;
+        for (int id : members) wrote |= refresh(id, states) > 0;
+        if (wrote) rebuilds++;
+    }
+
+    // Lowest common ancestor, or -1 if i and j are in different trees
+    int lca(int a, int b, const std::vector<StateComponent>& states) {
+        if (a < 0 || b < 0 || a >= (int)states.size() || b >= (int)states.size()) return -1;
+        grow(states.size());
+        if (!ensure(a, states) || !ensure(b, states)) return -1;
+        if (depth[a] < depth[b]) std::swap(a, b);
+
+        // Lift a to b's depth
+        int diff = depth[a] - depth[b];
+        for (int k = 0; diff > 0; k++, diff >>= 1) {
+            if (!(diff & 1)) continue;
+            a = up[k][a];
+            if (!ensure(a, states)) return -1;
+        }
+        if (a == b) return a;
+
+        // Jump both to just below their common ancestor, largest steps first
+        for (int k = (int)up.size() - 1; k >= 0; k--) {
+            if ((1 << k) > depth[a] || up[k][a] == up[k][b]) continue;
+            a = up[k][a];
+            b = up[k][b];
+            if (!ensure(a, states) || !ensure(b, states)) return -1;
+        }
+        int pa = states[a].parentEntityId;
+        return (pa != -1 && pa == states[b].parentEntityId) ? pa : -1;  // -1: different roots
+    }
+
+    // Number of tree bonds between i and j, or -1 if they share no ancestor
+    int distance(int i, int j, const std::vector<StateComponent>& states) {
+        if (i == j) return (i >= 0 && i < (int)states.size()) ? 0 : -1;
+        int a = lca(i, j, states);
+        if (a == -1) return -1;
+        return depth[i] + depth[j] - 2 * depth[a];
+    }
+
+    // Hops from id up to its tree root, or -1 if the links are corrupt
+    int getDepth(int id, const std::vector<StateComponent>& states) {
+        if (id < 0 || id >= (int)states.size()) return -1;
+        grow(states.size());
+        return ensure(id, states) ? depth[id] : -1;
+    }
+
+    // Entity indices were remapped or the world was rebuilt
+    void clear() {
+        std::fill(depth.begin(), depth.end(), -1);
+    }
+
+    int getRebuildCount() const { return rebuilds; }
+
+private:
+    HierarchyIndex() {}
+
+    std::vector<int> depth;             // -1 = not indexed
+    std::vector<int> parentAt;          // parentEntityId when indexed
+    std::vector<uint32_t> versionAt;    // topologyVersion when indexed
+    std::vector<std::vector<int>> up;   // up[k][id] = 2^k-th ancestor (roots point at themselves)
+    std::vector<int> path;              // Scratch for refresh
+    int rebuilds = 0;
+
+    void grow(size_t n) {
+        if (depth.size() >= n) return;
+        depth.resize(n, -1);
+        parentAt.resize(n, -1);
+        versionAt.resize(n, 0);
+        for (auto& level : up) level.resize(n, -1);
+    }
+
+    // Version 0 (never stamped: hand-built or unbonded atoms) is never trusted across queries
+    bool isCurrent(int id, const std::vector<StateComponent>& states) const {
+        return depth[id] >= 0 && parentAt[id] == states[id].parentEntityId &&
+               versionAt[id] == states[id].topologyVersion && versionAt[id] != 0;
+    }
+
+    bool ensure(int id, const std::vector<StateComponent>& states) {
+        if (isCurrent(id, states)) return true;
+        if (refresh(id, states) < 0) return false;
+        rebuilds++;
+        return true;
+    }
+
+    // Re-indexes id and its stale ancestors, top-down from the first current one (or the root).
+    // Returns the number of entries written, or -1 if the parent chain is broken or cyclic.
+    int refresh(int id, const std::vector<StateComponent>& states) {
+        path.clear();
+        for (int curr = id; curr != -1; curr = states[curr].parentEntityId) {
+            if (curr < 0 || curr >= (int)states.size() || path.size() > states.size()) {
+                TraceLog(LOG_ERROR, "[HIERARCHY] Broken parent chain above atom %d", id);
+                return -1;
+            }
+            if (isCurrent(curr, states)) break;
+            path.push_back(curr);
+        }
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            int x = *it;
+            int p = states[x].parentEntityId;
+            depth[x] = (p == -1) ? 0 : depth[p] + 1;
+            parentAt[x] = p;
+            versionAt[x] = states[x].topologyVersion;
+            while (up.empty() || (1 << up.size()) <= depth[x]) addLevel();
+            up[0][x] = (p == -1) ? x : p;
+            for (size_t k = 1; k < up.size(); k++) up[k][x] = up[k - 1][up[k - 1][x]];
+        }
+        return (int)path.size();
+    }
+
+    // Level k is derived from level k-1 alone, so it can be backfilled for every entry at once
+    void addLevel() {
+        if (up.empty()) {
+            up.emplace_back(depth.size(), -1);
+            return;
+        }
+        const std::vector<int>& prev = up.back();
+        std::vector<int> next(depth.size(), -1);
+        for (size_t id = 0; id < depth.size(); id++) {
+            if (depth[id] >= 0 && prev[id] >= 0) next[id] = prev[prev[id]];
+        }
+        up.push_back(std::move(next));
+    }
+};
+
+#endif // HIERARCHY_INDEX_HPP
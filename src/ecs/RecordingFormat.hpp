@@ -0,0 +1,195 @@
+#ifndef RECORDING_FORMAT_HPP
+#define RECORDING_FORMAT_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include "components.hpp"
+#include "../core/BinaryIO.hpp"
+
+// Player command sample (movement direction scaled to +-127, screen-space mouse)
+struct RecordedInput {
+    int8_t moveX = 0;
+    int8_t moveY = 0;
+    uint8_t flags = 0;  // RecordingFormat::InputFlags
+    int16_t mouseX = 0;
+    int16_t mouseY = 0;
+
+    bool operator==(const RecordedInput& o) const {
+        return moveX == o.moveX && moveY == o.moveY && flags == o.flags && mouseX == o.mouseX && mouseY == o.mouseY;
+    }
+    bool operator!=(const RecordedInput& o) const { return !(*this == o); }
+};
+
+/**
+ * RecordingFormat (Phase 54)
+ * Shared layout of simulation recordings (SimulationRecorder writes them,
+ * ReplayPlayer reads them):
+ *
+ *   FileHeader
+ *   Frame*    u32 payload length, u32 tick, u8 kind, payload
+ *
+ * A KEY frame's payload is a WorldSnapshot. A DELTA frame carries, in order:
+ * entity count, bond counter increments, the input record (if it changed),
+ * structural records for atoms whose topology changed, and quantised motion
+ * residuals (see MotionTrack). Record counts are u32, values are varints,
+ * so an idle atom costs nothing and a coasting one almost nothing.
+ */
+namespace RecordingFormat {
+    constexpr char MAGIC[8] = {'L', 'S', 'R', 'E', 'C', 0, 0, 0};
+    constexpr uint32_t VERSION = 1;
+
+    enum FrameKind : uint8_t {
+        FRAME_KEY = 1,
+        FRAME_DELTA = 2,
+    };
+
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        float positionQuantum;
+        float velocityQuantum;
+        uint32_t keyframeInterval;
+    };
+
+    constexpr size_t FRAME_HEADER_SIZE = 9;  // u32 length + u32 tick + u8 kind
+
+    enum InputFlags : uint8_t {
+        INPUT_TRACTOR = 1,
+        INPUT_RELEASE = 2,
+        INPUT_SELECT = 4,
+        INPUT_PAN = 8,
+    };
+
+    enum StateFlags : uint8_t {
+        STATE_ALIVE = 1,
+        STATE_IN_RING = 2,
+        STATE_CLUSTERED = 4,
+        STATE_FROZEN = 8,
+        STATE_SHIELDED = 16,
+    };
+
+    inline void writeInput(BinaryWriter& out, const RecordedInput& r) {
+        out.write(r.moveX);
+        out.write(r.moveY);
+        out.write(r.flags);
+        out.write(r.mouseX);
+        out.write(r.mouseY);
+    }
+
+    inline bool readInput(BinaryReader& in, RecordedInput& r) {
+        return in.read(r.moveX) && in.read(r.moveY) && in.read(r.flags) && in.read(r.mouseX) && in.read(r.mouseY);
+    }
+
+    // Structural record: everything bond-related about one atom
+    inline void writeState(BinaryWriter& out, const StateComponent& s, int atomicNumber) {
+        out.writeSigned(atomicNumber);
+        out.writeSigned(s.parentEntityId);
+        out.writeSigned(s.parentSlotIndex);
+        out.writeSigned(s.cycleBondId);
+        out.writeSigned(s.moleculeId);
+        out.writeSigned(s.ringInstanceId);
+        out.writeSigned(s.ringSize);
+        out.writeSigned(s.ringIndex);
+        out.writeSigned(s.structureId);
+        out.writeSigned(s.childCount);
+        out.writeVarint(s.occupiedSlots);
+        out.writeVarint(s.topologyVersion);
+        uint8_t flags = (s.isAlive ? STATE_ALIVE : 0) | (s.isInRing ? STATE_IN_RING : 0) |
+                        (s.isClustered ? STATE_CLUSTERED : 0) | (s.isFrozen ? STATE_FROZEN : 0) |
+                        (s.isShielded ? STATE_SHIELDED : 0);
+        out.write(flags);
+        out.writeVarint(s.childList.size());
+        for (int child : s.childList) out.writeSigned(child);
+    }
+
+    inline bool readState(BinaryReader& in, StateComponent& s, int& atomicNumber) {
+        int64_t v[10];
+        for (int k = 0; k < 10; k++) in.readSigned(v[k]);
+        uint64_t occupied = 0, version = 0, children = 0;
+        uint8_t flags = 0;
+        in.readVarint(occupied);
+        in.readVarint(version);
+        in.read(flags);
+        in.readVarint(children);
+        if (!in.ok()) return false;
+
+        atomicNumber = (int)v[0];
+        s.parentEntityId = (int)v[1];
+        s.parentSlotIndex = (int)v[2];
+        s.cycleBondId = (int)v[3];
+        s.moleculeId = (int)v[4];
+        s.ringInstanceId = (int)v[5];
+        s.ringSize = (int)v[6];
+        s.ringIndex = (int)v[7];
+        s.structureId = (int)v[8];
+        s.childCount = (int)v[9];
+        s.occupiedSlots = (uint32_t)occupied;
+        s.topologyVersion = (uint32_t)version;
+        s.isAlive = (flags & STATE_ALIVE) != 0;
+        s.isInRing = (flags & STATE_IN_RING) != 0;
+        s.isClustered = (flags & STATE_CLUSTERED) != 0;
+        s.isFrozen = (flags & STATE_FROZEN) != 0;
+        s.isShielded = (flags & STATE_SHIELDED) != 0;
+        s.childList.clear();
+        for (uint64_t c = 0; c < children && in.ok(); c++) {
+            int64_t child = -1;
+            if (in.readSigned(child)) s.childList.push_back((int)child);
+        }
+        return in.ok();
+    }
+
+    constexpr int CHANNELS = 6;  // x, y, z, vx, vy, vz
+
+    /**
+     * Quantised motion state kept identically by the recorder and the replay.
+     * Positions are predicted from the last two samples (constant velocity)
+     * and velocities from the last one; only the residual against the
+     * prediction is stored, so coasting atoms cost nothing. Both sides work on
+     * the quantised values, so error never accumulates past half a quantum.
+     */
+    struct MotionTrack {
+        float positionQuantum = 0.0625f;
+        float velocityQuantum = 0.125f;
+        std::vector<int32_t> current[CHANNELS];
+        std::vector<int32_t> previous[3];  // Positions only
+
+        int32_t quantise(const TransformComponent& tr, int channel) const {
+            const float values[CHANNELS] = { tr.x, tr.y, tr.z, tr.vx, tr.vy, tr.vz };
+            float q = (channel < 3) ? positionQuantum : velocityQuantum;
+            return (int32_t)std::lround(values[channel] / q);
+        }
+
+        float value(int entity, int channel) const {
+            return (float)current[channel][entity] * ((channel < 3) ? positionQuantum : velocityQuantum);
+        }
+
+        // Baseline from exact values (keyframes)
+        void reset(const std::vector<TransformComponent>& transforms) {
+            for (int c = 0; c < CHANNELS; c++) current[c].assign(transforms.size(), 0);
+            for (size_t i = 0; i < transforms.size(); i++) {
+                for (int c = 0; c < CHANNELS; c++) current[c][i] = quantise(transforms[i], c);
+            }
+            for (int c = 0; c < 3; c++) previous[c] = current[c];
+        }
+
+        void resize(size_t count) {
+            for (int c = 0; c < CHANNELS; c++) current[c].resize(count, 0);
+            for (int c = 0; c < 3; c++) previous[c].resize(count, 0);
+        }
+
+        // Dead atoms hold still, so their prediction cannot run away
+        int32_t predict(int entity, int channel, bool alive) const {
+            int32_t q = current[channel][entity];
+            if (channel >= 3 || !alive) return q;
+            return q + (q - previous[channel][entity]);
+        }
+
+        void advance(int entity, int channel, int32_t value) {
+            if (channel < 3) previous[channel][entity] = current[channel][entity];
+            current[channel][entity] = value;
+        }
+    };
+}
+
+#endif // RECORDING_FORMAT_HPP
@@ -0,0 +1,163 @@
+#include "ReplayPlayer.hpp"
+#include "World.hpp"
+#include "WorldSnapshot.hpp"
+#include "../physics/TopologyEvents.hpp"
+#include "raylib.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace RecordingFormat;
+
+bool ReplayPlayer::open(const std::string& filePath) {
+    close();
+    path = filePath;
+    if (!file.open(path)) {
+        TraceLog(LOG_ERROR, "[REPLAY] Cannot open %s", path.c_str());
+        return false;
+    }
+
+    BinaryReader in(file.data(), file.size());
+    if (!in.read(header) || std::memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0 || header.version != VERSION) {
+        TraceLog(LOG_ERROR, "[REPLAY] %s is not a version %u recording", path.c_str(), VERSION);
+        close();
+        return false;
+    }
+    motion.positionQuantum = header.positionQuantum;
+    motion.velocityQuantum = header.velocityQuantum;
+
+    // Index pass: frame headers only, payloads are skipped
+    while (!in.atEnd()) {
+        FrameIndex f;
+        if (!in.read(f.length) || !in.read(f.tick) || !in.read(f.kind)) break;
+        f.offset = in.position();
+        if (!in.view(f.length)) break;  // Truncated tail (recording still being written)
+        if (f.kind == FRAME_KEY) keyframes.push_back((int)frames.size());
+        else if (keyframes.empty()) continue;  // Deltas before the first keyframe are unusable
+        frames.push_back(f);
+    }
+
+    if (frames.empty()) {
+        TraceLog(LOG_WARNING, "[REPLAY] %s has no complete frames", path.c_str());
+        close();
+        return false;
+    }
+    TraceLog(LOG_INFO, "[REPLAY] %s: %d frames, %d keyframes", path.c_str(), (int)frames.size(), (int)keyframes.size());
+    return true;
+}
+
+void ReplayPlayer::close() {
+    file.close();
+    frames.clear();
+    keyframes.clear();
+    currentFrame = -1;
+}
+
+bool ReplayPlayer::seek(int frame, World& world) {
+    if (frames.empty()) return false;
+    frame = std::clamp(frame, 0, (int)frames.size() - 1);
+    if (frame == currentFrame) return true;
+
+    // Nearest keyframe at or before the target; skip it if we are already past it
+    auto it = std::upper_bound(keyframes.begin(), keyframes.end(), frame);
+    int key = *(it - 1);
+    int from = currentFrame + 1;
+    if (currentFrame < key || currentFrame > frame) {
+        if (!applyKeyframe(frames[key], world)) return false;
+        from = key + 1;
+    }
+
+    for (int f = from; f <= frame; f++) {
+        if (!applyDelta(frames[f], world)) {
+            currentFrame = -1;  // Unknown state; next seek starts from a keyframe
+            return false;
+        }
+    }
+    if (from <= frame) world.rebuildEntityTable();  // Deltas may have spawned or killed atoms
+    currentFrame = frame;
+    return true;
+}
+
+bool ReplayPlayer::applyKeyframe(const FrameIndex& f, World& world) {
+    if (!WorldSnapshot::read(world, file.data() + f.offset, f.length, path)) return false;
+    motion.reset(world.transforms);
+    input = RecordedInput{};
+    bondsFormed = TopologyEvents::getInstance().getBondsFormed();
+    bondsBroken = TopologyEvents::getInstance().getBondsBroken();
+    return true;
+}
+
+bool ReplayPlayer::applyDelta(const FrameIndex& f, World& world) {
+    BinaryReader in(file.data() + f.offset, f.length);
+
+    uint64_t n = 0, formed = 0, broken = 0;
+    uint8_t hasInput = 0;
+    in.readVarint(n);
+    in.readVarint(formed);
+    in.readVarint(broken);
+    in.read(hasInput);
+    if (hasInput) readInput(in, input);
+    if (!in.ok() || n < world.states.size()) return false;
+    bondsFormed += (long long)formed;
+    bondsBroken += (long long)broken;
+
+    // Spawned atoms
+    if (n > world.states.size()) {
+        world.transforms.resize(n, TransformComponent{});
+        world.atoms.resize(n, AtomComponent{});
+        world.states.resize(n, StateComponent{});
+        motion.resize(n);
+    }
+
+    uint32_t topoCount = 0;
+    in.read(topoCount);
+    for (uint32_t k = 0; k < topoCount && in.ok(); k++) {
+        uint64_t id = 0;
+        int atomicNumber = 0;
+        if (!in.readVarint(id) || id >= n) return false;
+        if (!readState(in, world.states[id], atomicNumber)) return false;
+        world.atoms[id].atomicNumber = atomicNumber;
+    }
+
+    // Residuals for listed atoms; everyone else follows the prediction
+    uint32_t motionCount = 0;
+    in.read(motionCount);
+    uint64_t nextId = 0;
+    int32_t residual[CHANNELS];
+    uint8_t mask = 0;
+    auto readMotion = [&](uint64_t lastId) {
+        uint64_t gap = 0;
+        in.readVarint(gap);
+        nextId = lastId + gap;
+        in.read(mask);
+        for (int c = 0; c < CHANNELS; c++) {
+            int64_t r = 0;
+            if (mask & (1 << c)) in.readSigned(r);
+            residual[c] = (int32_t)r;
+        }
+    };
+    uint32_t motionRead = 0;
+    if (motionCount > 0) { readMotion(0); motionRead = 1; }
+    else nextId = UINT64_MAX;
+
+    for (uint64_t id = 0; id < n; id++) {
+        bool alive = world.states[id].isAlive;
+        bool listed = (id == nextId);
+        for (int c = 0; c < CHANNELS; c++) {
+            int32_t value = motion.predict((int)id, c, alive) + (listed ? residual[c] : 0);
+            motion.advance((int)id, c, value);
+        }
+        TransformComponent& tr = world.transforms[id];
+        tr.x = motion.value((int)id, 0);
+        tr.y = motion.value((int)id, 1);
+        tr.z = motion.value((int)id, 2);
+        tr.vx = motion.value((int)id, 3);
+        tr.vy = motion.value((int)id, 4);
+        tr.vz = motion.value((int)id, 5);
+
+        if (listed) {
+            if (motionRead < motionCount) { readMotion(id); motionRead++; }
+            else nextId = UINT64_MAX;
+        }
+    }
+    return in.ok() && motionRead == motionCount && nextId == UINT64_MAX;
+}
@@ -0,0 +1,64 @@
+#ifndef REPLAY_PLAYER_HPP
+#define REPLAY_PLAYER_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "RecordingFormat.hpp"
+#include "../core/MappedFile.hpp"
+
+class World;
+
+/**
+ * ReplayPlayer (Phase 54)
+ * Scrubs through a SimulationRecorder file without re-simulating. open()
+ * maps the file and indexes every frame; seek() decodes the nearest keyframe
+ * at or before the target and applies the deltas after it (or just the
+ * deltas, when moving forward from the current frame), writing the result
+ * into the given World.
+ *
+ * Keyframe decoding restores the recorded id counters, topology clock and
+ * RNG (WorldSnapshot::read), so the live world must be parked and restored
+ * around a replay session.
+ */
+class ReplayPlayer {
+public:
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file.isOpen(); }
+
+    bool seek(int frame, World& world);
+    bool step(int frames, World& world) { return seek(currentFrame + frames, world); }
+
+    int getFrameCount() const { return (int)frames.size(); }
+    int getCurrentFrame() const { return currentFrame; }
+    uint32_t getTick(int frame) const { return (frame >= 0 && frame < (int)frames.size()) ? frames[frame].tick : 0; }
+    const RecordedInput& getInput() const { return input; }
+    long long getBondsFormed() const { return bondsFormed; }
+    long long getBondsBroken() const { return bondsBroken; }
+
+private:
+    struct FrameIndex {
+        uint64_t offset;  // Payload start
+        uint32_t length;
+        uint32_t tick;
+        uint8_t kind;
+    };
+
+    MappedFile file;
+    std::string path;
+    RecordingFormat::FileHeader header{};
+    std::vector<FrameIndex> frames;
+    std::vector<int> keyframes;  // Frame numbers
+    int currentFrame = -1;
+
+    RecordingFormat::MotionTrack motion;
+    RecordedInput input;
+    long long bondsFormed = 0;
+    long long bondsBroken = 0;
+
+    bool applyKeyframe(const FrameIndex& f, World& world);
+    bool applyDelta(const FrameIndex& f, World& world);
+};
+
+#endif // REPLAY_PLAYER_HPP
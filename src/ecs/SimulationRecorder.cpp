@@ -0,0 +1,188 @@
+#include "SimulationRecorder.hpp"
+#include "World.hpp"
+#include "WorldSnapshot.hpp"
+#include "../physics/TopologyEvents.hpp"
+#include "../core/Config.hpp"
+#include "raylib.h"
+#include <cstring>
+
+using namespace RecordingFormat;
+
+bool SimulationRecorder::start(const std::string& filePath) {
+    path = filePath;
+    stats = RecorderStats{};
+    tick = 0;
+    ticksSinceFlush = 0;
+    keyframePending = true;
+    pending.clear();
+
+    motion.positionQuantum = Config::RECORD_POSITION_QUANTUM;
+    motion.velocityQuantum = Config::RECORD_VELOCITY_QUANTUM;
+
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.positionQuantum = motion.positionQuantum;
+    header.velocityQuantum = motion.velocityQuantum;
+    header.keyframeInterval = (uint32_t)Config::RECORD_KEYFRAME_TICKS;
+    pending.write(header);
+
+    recording = pending.saveToFile(path);
+    pending.clear();
+    if (!recording) {
+        TraceLog(LOG_WARNING, "[RECORD] Cannot create %s; recording disabled", path.c_str());
+        return false;
+    }
+    stats.bytesWritten = sizeof(FileHeader);
+    TraceLog(LOG_INFO, "[RECORD] Recording to %s", path.c_str());
+    return true;
+}
+
+void SimulationRecorder::stop() {
+    if (!recording) return;
+    flush();
+    recording = false;
+    TraceLog(LOG_INFO, "[RECORD] Stopped after %lld frames (%lld keyframes, %lld KB)",
+             stats.frames, stats.keyframes, stats.bytesWritten / 1024);
+}
+
+void SimulationRecorder::flush() {
+    if (!recording || pending.size() == 0) return;
+    if (!pending.saveToFile(path, true)) {
+        TraceLog(LOG_ERROR, "[RECORD] Failed to append to %s; recording stopped", path.c_str());
+        recording = false;
+    } else {
+        stats.bytesWritten += (long long)pending.size();
+    }
+    pending.clear();
+    ticksSinceFlush = 0;
+}
+
+void SimulationRecorder::recordTick(const World& world, const RecordedInput& input) {
+    if (!recording) return;
+
+    // Indices only ever grow between keyframes; compaction renumbers, so it needs a fresh baseline
+    if (world.states.size() < lastEntityCount || ticksSinceKeyframe >= Config::RECORD_KEYFRAME_TICKS) keyframePending = true;
+
+    if (keyframePending) writeKeyframe(world);
+    else writeDelta(world, input);
+    tick++;
+
+    if (++ticksSinceFlush >= Config::RECORD_FLUSH_TICKS) flush();
+}
+
+void SimulationRecorder::appendFrame(uint8_t kind) {
+    pending.write<uint32_t>((uint32_t)payload.size());
+    pending.write<uint32_t>(tick);
+    pending.write<uint8_t>(kind);
+    pending.writeBytes(payload.data().data(), payload.size());
+    stats.frames++;
+}
+
+void SimulationRecorder::writeKeyframe(const World& world) {
+    payload.clear();
+    WorldSnapshot::write(world, payload);
+    appendFrame(FRAME_KEY);
+    stats.keyframes++;
+
+    // Replay derives the same baseline from the snapshot's exact values
+    motion.reset(world.transforms);
+    sent.assign(world.states.size(), RecordedTopology{});
+    for (int id = 0; id < (int)world.states.size(); id++) rememberTopology(world, id);
+
+    TopologyEvents& events = TopologyEvents::getInstance();
+    lastBondsFormed = events.getBondsFormed();
+    lastBondsBroken = events.getBondsBroken();
+    lastEntityCount = world.states.size();
+    inputSent = false;
+    keyframePending = false;
+    ticksSinceKeyframe = 0;
+}
+
+void SimulationRecorder::rememberTopology(const World& world, int id) {
+    const StateComponent& s = world.states[id];
+    RecordedTopology& t = sent[id];
+    t.topologyVersion = s.topologyVersion;
+    t.parentEntityId = s.parentEntityId;
+    t.cycleBondId = s.cycleBondId;
+    t.atomicNumber = world.atoms[id].atomicNumber;
+    t.isAlive = s.isAlive;
+}
+
+bool SimulationRecorder::topologyChanged(const World& world, int id) const {
+    const StateComponent& s = world.states[id];
+    const RecordedTopology& t = sent[id];
+    return t.topologyVersion != s.topologyVersion || t.parentEntityId != s.parentEntityId ||
+           t.cycleBondId != s.cycleBondId || t.atomicNumber != world.atoms[id].atomicNumber ||
+           t.isAlive != s.isAlive;
+}
+
+void SimulationRecorder::writeDelta(const World& world, const RecordedInput& input) {
+    const int n = (int)world.states.size();
+    payload.clear();
+    payload.writeVarint((uint64_t)n);
+
+    // Atoms spawned since the last frame start from a zero baseline on both sides
+    if (n > (int)lastEntityCount) {
+        motion.resize(n);
+        sent.resize(n, RecordedTopology{});
+        lastEntityCount = n;
+    }
+
+    TopologyEvents& events = TopologyEvents::getInstance();
+    payload.writeVarint((uint64_t)(events.getBondsFormed() - lastBondsFormed));
+    payload.writeVarint((uint64_t)(events.getBondsBroken() - lastBondsBroken));
+    lastBondsFormed = events.getBondsFormed();
+    lastBondsBroken = events.getBondsBroken();
+
+    bool sendInput = !inputSent || input != lastInput;
+    payload.write<uint8_t>(sendInput ? 1 : 0);
+    if (sendInput) {
+        writeInput(payload, input);
+        lastInput = input;
+        inputSent = true;
+    }
+
+    // Structural records (applied before motion: the replay needs isAlive for its predictor)
+    size_t countOffset = payload.size();
+    payload.write<uint32_t>(0);
+    uint32_t topoCount = 0;
+    for (int id = 0; id < n; id++) {
+        if (!topologyChanged(world, id)) continue;
+        payload.writeVarint((uint64_t)id);
+        writeState(payload, world.states[id], world.atoms[id].atomicNumber);
+        rememberTopology(world, id);
+        topoCount++;
+    }
+    payload.patch(countOffset, topoCount);
+
+    // Motion residuals against the shared predictor
+    countOffset = payload.size();
+    payload.write<uint32_t>(0);
+    uint32_t motionCount = 0;
+    int lastId = 0;
+    for (int id = 0; id < n; id++) {
+        bool alive = world.states[id].isAlive;
+        int32_t residual[CHANNELS];
+        uint8_t mask = 0;
+        for (int c = 0; c < CHANNELS; c++) {
+            int32_t predicted = motion.predict(id, c, alive);
+            int32_t actual = alive ? motion.quantise(world.transforms[id], c) : predicted;
+            residual[c] = actual - predicted;
+            if (residual[c] != 0) mask |= (uint8_t)(1 << c);
+            motion.advance(id, c, actual);
+        }
+        if (mask == 0) continue;
+        payload.writeVarint((uint64_t)(id - lastId));
+        payload.write(mask);
+        for (int c = 0; c < CHANNELS; c++) {
+            if (mask & (1 << c)) payload.writeSigned(residual[c]);
+        }
+        lastId = id;
+        motionCount++;
+    }
+    payload.patch(countOffset, motionCount);
+
+    appendFrame(FRAME_DELTA);
+    ticksSinceKeyframe++;
+}
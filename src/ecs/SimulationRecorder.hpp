@@ -0,0 +1,92 @@
+#ifndef SIMULATION_RECORDER_HPP
+#define SIMULATION_RECORDER_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+#include "RecordingFormat.hpp"
+#include "../core/BinaryIO.hpp"
+#include "../input/InputHandler.hpp"
+
+class World;
+
+struct RecorderStats {
+    long long frames = 0;
+    long long keyframes = 0;
+    long long bytesWritten = 0;
+};
+
+/**
+ * SimulationRecorder (Phase 54)
+ * Appends one frame per fixed step to a recording (see RecordingFormat.hpp):
+ * a full keyframe every Config::RECORD_KEYFRAME_TICKS, otherwise only what
+ * changed - atoms whose topology changed, quantised motion residuals, bond
+ * counter increments and the player's input when it differs from the last
+ * tick. Frames are buffered and appended to disk every RECORD_FLUSH_TICKS.
+ */
+class SimulationRecorder {
+public:
+    bool start(const std::string& path);
+    void stop();
+    bool isRecording() const { return recording; }
+
+    void recordTick(const World& world, const RecordedInput& input);
+
+    // Next frame is a keyframe (after compaction or when the world was replaced)
+    void requestKeyframe() { keyframePending = true; }
+    void flush();
+
+    const RecorderStats& getStats() const { return stats; }
+
+    static RecordedInput captureInput(const InputHandler& input) {
+        using namespace RecordingFormat;
+        RecordedInput r;
+        Vector2 move = input.getMovementDirection();
+        r.moveX = (int8_t)std::clamp((int)std::lround(move.x * 127.0f), -127, 127);
+        r.moveY = (int8_t)std::clamp((int)std::lround(move.y * 127.0f), -127, 127);
+        r.flags = (input.isTractorBeamActive() ? INPUT_TRACTOR : 0) | (input.isReleaseTriggered() ? INPUT_RELEASE : 0) |
+                  (input.isSelectionTriggered() ? INPUT_SELECT : 0) | (input.isPanning() ? INPUT_PAN : 0);
+        Vector2 mouse = input.getMousePosition();
+        r.mouseX = (int16_t)std::clamp((int)mouse.x, -32768, 32767);
+        r.mouseY = (int16_t)std::clamp((int)mouse.y, -32768, 32767);
+        return r;
+    }
+
+private:
+    // What a replay last saw of each atom's topology
+    struct RecordedTopology {
+        uint32_t topologyVersion = 0;
+        int parentEntityId = -2;  // -2 = never sent
+        int cycleBondId = -1;
+        int atomicNumber = 0;
+        bool isAlive = false;
+    };
+
+    std::string path;
+    bool recording = false;
+    bool keyframePending = true;
+    uint32_t tick = 0;
+    int ticksSinceKeyframe = 0;
+    int ticksSinceFlush = 0;
+    size_t lastEntityCount = 0;
+    long long lastBondsFormed = 0;
+    long long lastBondsBroken = 0;
+    RecordedInput lastInput;
+    bool inputSent = false;
+
+    RecordingFormat::MotionTrack motion;
+    std::vector<RecordedTopology> sent;
+    BinaryWriter pending;
+    BinaryWriter payload;  // Scratch for one frame
+    RecorderStats stats;
+
+    void writeKeyframe(const World& world);
+    void writeDelta(const World& world, const RecordedInput& input);
+    void appendFrame(uint8_t kind);
+    void rememberTopology(const World& world, int id);
+    bool topologyChanged(const World& world, int id) const;
+};
+
+#endif // SIMULATION_RECORDER_HPP
@@ -0,0 +1,198 @@
+#include "StateHasher.hpp"
+#include "World.hpp"
+#include "raylib.h"
+#include <cstring>
+#include <algorithm>
+
+namespace {
+    constexpr char HASH_MAGIC[8] = {'L', 'S', 'H', 'A', 'S', 'H', 0, 0};
+    constexpr uint32_t HASH_VERSION = 1;
+    constexpr int HASH_FLUSH_TICKS = 600;
+
+    uint64_t mix(uint64_t h, uint32_t word) {
+        return (h ^ word) * 0x100000001B3ull;
+    }
+
+    // splitmix64 finaliser: spreads the per-entity FNV state before summing
+    uint64_t finish(uint64_t h, int entity) {
+        h ^= (uint64_t)(uint32_t)entity * 0x9E3779B97F4A7C15ull;
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        return h ^ (h >> 31);
+    }
+
+    uint32_t bits(float f) {
+        uint32_t u;
+        std::memcpy(&u, &f, sizeof(u));
+        return u;
+    }
+
+    constexpr uint64_t FNV_BASIS = 0xCBF29CE484222325ull;
+
+    uint64_t hashTransform(const TransformComponent& tr) {
+        uint64_t h = FNV_BASIS;
+        const float fields[] = { tr.x, tr.y, tr.z, tr.vx, tr.vy, tr.vz, tr.rotation };
+        for (float f : fields) h = mix(h, bits(f));
+        return h;
+    }
+
+    uint64_t hashAtom(const AtomComponent& atom) {
+        return mix(mix(FNV_BASIS, (uint32_t)atom.atomicNumber), bits(atom.partialCharge));
+    }
+
+    uint64_t hashChildren(const StateComponent& s) {
+        uint64_t h = FNV_BASIS;
+        for (int child : s.childList) h = mix(h, (uint32_t)child);
+        return mix(h, (uint32_t)s.childList.size());
+    }
+
+    uint64_t hashState(const StateComponent& s, uint64_t childrenHash) {
+        uint64_t h = FNV_BASIS;
+        const int ints[] = { s.moleculeId, s.parentEntityId, s.parentSlotIndex, s.childCount, s.cycleBondId,
+                             s.ringSize, s.ringIndex, s.ringInstanceId, s.structureId };
+        for (int v : ints) h = mix(h, (uint32_t)v);
+        const float floats[] = { s.dockingProgress, s.targetX, s.targetY, s.releaseTimer };
+        for (float f : floats) h = mix(h, bits(f));
+        uint32_t flags = (s.isClustered ? 1u : 0u) | (s.isShielded ? 2u : 0u) | (s.isInRing ? 4u : 0u) |
+                         (s.isFrozen ? 8u : 0u) | (s.justBonded ? 16u : 0u) | (s.isAlive ? 32u : 0u);
+        h = mix(h, flags);
+        h = mix(h, s.occupiedSlots);
+        h = mix(h, s.topologyVersion);
+        h = mix(h, s.structureCheckedVersion);
+        h = mix(h, (uint32_t)s.structureCheckedGeneration);
+        h = mix(h, (uint32_t)childrenHash);
+        return mix(h, (uint32_t)(childrenHash >> 32));
+    }
+
+    void accumulate(StateHash& out, const World& world, int i, uint64_t childrenHash) {
+        out.transforms += finish(hashTransform(world.transforms[i]), i);
+        out.atoms += finish(hashAtom(world.atoms[i]), i);
+        out.states += finish(hashState(world.states[i], childrenHash), i);
+    }
+
+    void seal(StateHash& out, size_t count) {
+        out.entityCount = (uint32_t)count;
+        out.total = finish(out.transforms ^ (out.atoms * 31) ^ (out.states * 131), (int)count);
+    }
+}
+
+StateHash StateHasher::compute(const World& world) {
+    StateHash out;
+    for (int i = 0; i < (int)world.states.size(); i++) accumulate(out, world, i, hashChildren(world.states[i]));
+    seal(out, world.states.size());
+    return out;
+}
+
+StateHash StateHasher::update(const World& world) {
+    const int n = (int)world.states.size();
+    if ((int)cachedVersion.size() != n) {
+        cachedVersion.assign(n, 0);
+        cachedChildren.assign(n, 0);
+        for (int i = 0; i < n; i++) {
+            cachedVersion[i] = world.states[i].topologyVersion;
+            cachedChildren[i] = hashChildren(world.states[i]);
+        }
+    }
+
+    StateHash out;
+    out.tick = tick;
+    for (int i = 0; i < n; i++) {
+        const StateComponent& s = world.states[i];
+        if (cachedVersion[i] != s.topologyVersion) {
+            cachedVersion[i] = s.topologyVersion;
+            cachedChildren[i] = hashChildren(s);
+        }
+        accumulate(out, world, i, cachedChildren[i]);
+    }
+    seal(out, n);
+
+    if (logging) {
+        pending.write(out);
+        if ((tick + 1) % HASH_FLUSH_TICKS == 0) flush();
+    }
+    if (divergenceTick < 0 && tick < reference.size() && reference[tick] != out) {
+        divergenceTick = tick;
+        const StateHash& ref = reference[tick];
+        TraceLog(LOG_WARNING, "[DETERMINISM] Diverged from reference at tick %u (%s%s%s%s)", tick,
+                 ref.entityCount != out.entityCount ? "entity count " : "",
+                 ref.transforms != out.transforms ? "transforms " : "",
+                 ref.atoms != out.atoms ? "atoms " : "",
+                 ref.states != out.states ? "states" : "");
+    }
+    tick++;
+    return out;
+}
+
+int StateHasher::findFirstDifference(const World& a, const World& b) {
+    int n = (int)std::min(a.states.size(), b.states.size());
+    for (int i = 0; i < n; i++) {
+        if (hashTransform(a.transforms[i]) != hashTransform(b.transforms[i]) ||
+            hashAtom(a.atoms[i]) != hashAtom(b.atoms[i]) ||
+            hashState(a.states[i], hashChildren(a.states[i])) != hashState(b.states[i], hashChildren(b.states[i]))) {
+            return i;
+        }
+    }
+    return (a.states.size() == b.states.size()) ? -1 : n;
+}
+
+bool StateHasher::openLog(const std::string& path) {
+    logPath = path;
+    pending.clear();
+    pending.writeBytes(HASH_MAGIC, sizeof(HASH_MAGIC));
+    pending.write<uint32_t>(HASH_VERSION);
+    pending.write<uint32_t>((uint32_t)sizeof(StateHash));
+    logging = pending.saveToFile(logPath);
+    pending.clear();
+    if (!logging) TraceLog(LOG_WARNING, "[DETERMINISM] Cannot write %s", path.c_str());
+    return logging;
+}
+
+void StateHasher::flush() {
+    if (!logging || pending.size() == 0) return;
+    if (!pending.saveToFile(logPath, true)) {
+        TraceLog(LOG_ERROR, "[DETERMINISM] Failed to append to %s; hash log stopped", logPath.c_str());
+        logging = false;
+    }
+    pending.clear();
+}
+
+void StateHasher::close() {
+    flush();
+    logging = false;
+}
+
+bool StateHasher::readLog(const std::string& path, std::vector<StateHash>& out) {
+    std::vector<char> bytes;
+    if (!BinaryReader::loadFile(path, bytes)) return false;
+    BinaryReader in(bytes);
+    char magic[8];
+    uint32_t version = 0, recordSize = 0;
+    if (!in.readBytes(magic, sizeof(magic)) || std::memcmp(magic, HASH_MAGIC, sizeof(magic)) != 0 ||
+        !in.read(version) || version != HASH_VERSION || !in.read(recordSize) || recordSize != sizeof(StateHash)) {
+        return false;
+    }
+    out.clear();
+    StateHash h;
+    while (!in.atEnd() && in.read(h)) out.push_back(h);
+    return true;
+}
+
+bool StateHasher::loadReference(const std::string& path) {
+    divergenceTick = -1;
+    if (!readLog(path, reference)) {
+        reference.clear();
+        return false;
+    }
+    TraceLog(LOG_INFO, "[DETERMINISM] Comparing against %s (%d ticks)", path.c_str(), (int)reference.size());
+    return true;
+}
+
+long long StateHasher::compareLogs(const std::string& pathA, const std::string& pathB) {
+    std::vector<StateHash> a, b;
+    if (!readLog(pathA, a) || !readLog(pathB, b)) return 0;  // Unreadable: treat as diverged from the start
+    size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] != b[i]) return (long long)i;
+    }
+    return -1;
+}
@@ -0,0 +1,77 @@
+#ifndef STATE_HASHER_HPP
+#define STATE_HASHER_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "../core/BinaryIO.hpp"
+
+class World;
+
+// Per-tick digest; the component hashes tell which array diverged first
+struct StateHash {
+    uint32_t tick = 0;
+    uint32_t entityCount = 0;
+    uint64_t total = 0;
+    uint64_t transforms = 0;
+    uint64_t atoms = 0;
+    uint64_t states = 0;
+
+    bool operator==(const StateHash& o) const {
+        return total == o.total && transforms == o.transforms && atoms == o.atoms && states == o.states && entityCount == o.entityCount;
+    }
+    bool operator!=(const StateHash& o) const { return !(*this == o); }
+};
+
+/**
+ * StateHasher (Phase 55)
+ * Bit-exact digest of the component arrays, computed once per fixed step in
+ * deterministic mode. Each entity's words are mixed on their own and the
+ * results summed, so the digest is independent of visiting order (a
+ * parallel kernel can reduce it in any split) and a single differing atom
+ * can be located with findFirstDifference().
+ *
+ * Child lists are the only variable-length data; their hash is cached per
+ * entity and recomputed only when the atom's topologyVersion moves. Nothing
+ * else is cached: positions, docking progress and timers change every step
+ * without a topology event, so each digest still visits all N entities.
+ *
+ * With a log open, every tick's digest is appended to a file; with a
+ * reference log loaded, each tick is compared against it and the first
+ * divergence is reported once.
+ */
+class StateHasher {
+public:
+    StateHash update(const World& world);
+
+    // Drop cached child-list hashes (indices were renumbered or the world replaced)
+    void invalidate() { cachedVersion.clear(); cachedChildren.clear(); }
+
+    bool openLog(const std::string& path);
+    bool loadReference(const std::string& path);
+    void close();
+
+    long long getDivergenceTick() const { return divergenceTick; }
+    uint32_t getTick() const { return tick; }
+
+    static StateHash compute(const World& world);
+    static int findFirstDifference(const World& a, const World& b);  // Entity index, or -1
+    static long long compareLogs(const std::string& pathA, const std::string& pathB);  // First differing tick, or -1
+
+private:
+    uint32_t tick = 0;
+    std::vector<uint32_t> cachedVersion;
+    std::vector<uint64_t> cachedChildren;
+
+    std::string logPath;
+    BinaryWriter pending;
+    bool logging = false;
+
+    std::vector<StateHash> reference;
+    long long divergenceTick = -1;
+
+    void flush();
+    static bool readLog(const std::string& path, std::vector<StateHash>& out);
+};
+
+#endif // STATE_HASHER_HPP
@@ -2,15 +2,25 @@
 #define WORLD_HPP
 
 #include <vector>
+#include <algorithm>
 #include "components.hpp"
+#include "EntityHandle.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../physics/TopologyEvents.hpp"
 #include "../core/Config.hpp"
 #include "../chemistry/ChemistryDatabase.hpp"
 #include "../core/MathUtils.hpp"
+#include "../core/SimulationState.hpp"
 #include "raylib.h"
 
 /**
  * World: Central container for the ECS.
  * Encapsulates component vectors and initialization logic.
+ *
+ * Phase 51: Entity lifecycle. spawn()/despawn() are O(1) through free-lists
+ * (despawned slots stay in place, flagged !isAlive, until compact() squeezes
+ * them out and remaps every index-bearing field). Code that keeps an entity
+ * across frames should hold an EntityHandle, which survives compaction.
  */
 class World {
 public:
@@ -22,6 +32,7 @@ public:
         transforms.clear();
         atoms.clear();
         states.clear();
+        resetEntityTable();
 
         // 1. PLAYER (Always ID 0)
         transforms.push_back({ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f });
@@ -36,14 +47,15 @@ public:
             
             int rangeXY = (int)Config::SPAWN_RANGE_XY;
             int rangeZ = (int)Config::SPAWN_RANGE_Z;
+            SimulationState& sim = SimulationState::getInstance();  // Phase 55: seedable
             
             TransformComponent tr = {
-                (float)GetRandomValue(-rangeXY, rangeXY), 
-                (float)GetRandomValue(-rangeXY, rangeXY), 
-                (float)GetRandomValue(-rangeZ, rangeZ),
-                (float)GetRandomValue(-100, 100) / Config::SPAWN_VEL_DIVISOR * Config::INITIAL_VEL_RANGE,
-                (float)GetRandomValue(-100, 100) / Config::SPAWN_VEL_DIVISOR * Config::INITIAL_VEL_RANGE,
-                (float)GetRandomValue(-100, 100) / Config::SPAWN_VEL_DIVISOR * Config::INITIAL_VEL_RANGE,
+                (float)sim.randomInt(-rangeXY, rangeXY), 
+                (float)sim.randomInt(-rangeXY, rangeXY), 
+                (float)sim.randomInt(-rangeZ, rangeZ),
+                (float)sim.randomInt(-100, 100) / Config::SPAWN_VEL_DIVISOR * Config::INITIAL_VEL_RANGE,
+                (float)sim.randomInt(-100, 100) / Config::SPAWN_VEL_DIVISOR * Config::INITIAL_VEL_RANGE,
+                (float)sim.randomInt(-100, 100) / Config::SPAWN_VEL_DIVISOR * Config::INITIAL_VEL_RANGE,
                 0.0f // rotation
             };
 
@@ -51,6 +63,7 @@ public:
             atoms.push_back({atomicNum, 0.0f});
             states.push_back(StateComponent{}); 
         }
+        registerAllEntities();
     }
 
     /**
@@ -61,6 +74,7 @@ public:
         transforms.clear();
         atoms.clear();
         states.clear();
+        resetEntityTable();
 
         // 1. PLAYER (Always ID 0)
         transforms.push_back({ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f });
@@ -85,10 +99,147 @@ public:
             states.push_back(StateComponent{});
         }
         
+        registerAllEntities();
         TraceLog(LOG_INFO, "[World] TEST MODE - Created 6 Carbons in hexagon at Clay Zone center (%.0f, %.0f)", centerX, centerY);
     }
 
     size_t getEntityCount() const { return atoms.size(); }
+    size_t getAliveCount() const { return atoms.size() - freeEntities.size(); }
+    size_t getDeadCount() const { return freeEntities.size(); }
+
+    // --- ENTITY LIFECYCLE (Phase 51) ---
+
+    /**
+     * Adds a free atom, reusing a despawned slot when one is available.
+     */
+    EntityHandle spawn(const TransformComponent& transform, int atomicNumber) {
+        int id;
+        if (!freeEntities.empty()) {
+            id = freeEntities.back();
+            freeEntities.pop_back();
+            transforms[id] = transform;
+            atoms[id] = {atomicNumber, 0.0f};
+            states[id] = StateComponent{};
+        } else {
+            id = (int)transforms.size();
+            transforms.push_back(transform);
+            atoms.push_back({atomicNumber, 0.0f});
+            states.push_back(StateComponent{});
+            entityToHandle.push_back(-1);
+        }
+        EntityHandle handle = allocateHandle(id);
+        TopologyEvents::getInstance().touch(id, states);  // New free atom for census/caches
+        return handle;
+    }
+
+    /**
+     * Detaches the atom from its molecule and parks its slot on the free-list.
+     * The player (entity 0) cannot be despawned. Returns false for stale handles.
+     */
+    bool despawn(EntityHandle handle) {
+        int id = resolve(handle);
+        if (id <= 0) return false;
+
+        BondingSystem::breakAllBonds(id, states, atoms);
+        states[id].isAlive = false;
+        atoms[id].partialCharge = 0.0f;
+        transforms[id].vx = transforms[id].vy = transforms[id].vz = 0.0f;
+        TopologyEvents::getInstance().touch(id, states);
+        releaseSlot(id);
+        return true;
+    }
+
+    /**
+     * Removes a whole molecule at once (Phase 52: chunk eviction). Bonds inside
+     * the group are dropped with it rather than broken one by one, so no
+     * break events are reported. `members` must be a closed molecule.
+     */
+    void despawnGroup(const std::vector<int>& members) {
+        for (int id : members) {
+            if (id <= 0 || id >= (int)states.size() || !states[id].isAlive) continue;
+            states[id] = StateComponent{};
+            states[id].isAlive = false;
+            atoms[id].partialCharge = 0.0f;
+            transforms[id].vx = transforms[id].vy = transforms[id].vz = 0.0f;
+            TopologyEvents::getInstance().touch(id, states);
+            releaseSlot(id);
+        }
+    }
+
+    // Current index of a handle, or -1 if it was despawned
+    int resolve(EntityHandle handle) const {
+        if (handle.slot < 0 || handle.slot >= (int)handleToEntity.size()) return -1;
+        if (handleGenerations[handle.slot] != handle.generation) return -1;
+        return handleToEntity[handle.slot];
+    }
+
+    EntityHandle getHandle(int entityId) const {
+        if (entityId < 0 || entityId >= (int)entityToHandle.size() || entityToHandle[entityId] < 0) return EntityHandle{};
+        int slot = entityToHandle[entityId];
+        return EntityHandle{ slot, handleGenerations[slot] };
+    }
+
+    /**
+     * Re-derives handles and the free-list after the component arrays were
+     * replaced wholesale (Phase 53: snapshot load). Outstanding handles die.
+     */
+    void rebuildEntityTable() {
+        resetEntityTable();
+        registerAllEntities();
+        for (int id = (int)states.size() - 1; id > 0; id--) {
+            if (!states[id].isAlive) releaseSlot(id);
+        }
+    }
+
+    bool shouldCompact() const {
+        return (int)freeEntities.size() >= Config::WORLD_COMPACT_MIN_DEAD &&
+               (float)freeEntities.size() >= Config::WORLD_COMPACT_DEAD_RATIO * (float)transforms.size();
+    }
+
+    /**
+     * Removes dead slots, keeping survivors in order (entity 0 stays the player).
+     * Remaps parent/child/cycle/molecule links and handles, and returns the
+     * old -> new index table (-1 = removed) so systems holding raw indices
+     * (tractor, undo history, per-entity caches) can follow.
+     */
+    std::vector<int> compact() {
+        std::vector<int> remap;
+        if (freeEntities.empty()) return remap;
+
+        int count = (int)transforms.size();
+        remap.assign(count, -1);
+        int next = 0;
+        for (int i = 0; i < count; i++) {
+            if (!states[i].isAlive) continue;
+            remap[i] = next;
+            if (next != i) {
+                transforms[next] = transforms[i];
+                atoms[next] = atoms[i];
+                states[next] = std::move(states[i]);
+                entityToHandle[next] = entityToHandle[i];
+            }
+            next++;
+        }
+        transforms.resize(next);
+        atoms.resize(next);
+        states.resize(next);
+        entityToHandle.resize(next);
+        freeEntities.clear();
+
+        for (StateComponent& st : states) {
+            st.moleculeId = remapEntityIndex(remap, st.moleculeId);
+            st.parentEntityId = remapEntityIndex(remap, st.parentEntityId);
+            st.cycleBondId = remapEntityIndex(remap, st.cycleBondId);
+            for (int& child : st.childList) child = remapEntityIndex(remap, child);
+            st.childList.erase(std::remove(st.childList.begin(), st.childList.end(), -1), st.childList.end());
+        }
+        for (int id = 0; id < next; id++) {
+            if (entityToHandle[id] >= 0) handleToEntity[entityToHandle[id]] = id;
+        }
+
+        TraceLog(LOG_INFO, "[World] Compacted %d -> %d entities", count, next);
+        return remap;
+    }
     
     /**
      * Returns the indices of all atoms belonging to the same molecule.
@@ -96,6 +247,57 @@ public:
     std::vector<int> getMoleculeMembers(int entityId) const {
         return MathUtils::getMoleculeMembers(entityId, states);
     }
+
+private:
+    std::vector<uint32_t> handleGenerations;  // Per handle slot
+    std::vector<int> handleToEntity;          // Per handle slot (-1 = free)
+    std::vector<int> entityToHandle;          // Per entity index (-1 = dead)
+    std::vector<int> freeHandles;
+    std::vector<int> freeEntities;            // Dead entity slots, reused by spawn()
+
+    // Invalidates every outstanding handle (generations keep counting up)
+    void resetEntityTable() {
+        freeHandles.clear();
+        for (int slot = 0; slot < (int)handleToEntity.size(); slot++) {
+            handleGenerations[slot]++;
+            handleToEntity[slot] = -1;
+            freeHandles.push_back(slot);
+        }
+        entityToHandle.clear();
+        freeEntities.clear();
+    }
+
+    void registerAllEntities() {
+        entityToHandle.assign(transforms.size(), -1);
+        for (int id = 0; id < (int)transforms.size(); id++) allocateHandle(id);
+    }
+
+    // Invalidates the entity's handle and parks its slot on the free-list
+    void releaseSlot(int entityId) {
+        int slot = entityToHandle[entityId];
+        if (slot >= 0) {
+            handleGenerations[slot]++;
+            handleToEntity[slot] = -1;
+            freeHandles.push_back(slot);
+            entityToHandle[entityId] = -1;
+        }
+        freeEntities.push_back(entityId);
+    }
+
+    EntityHandle allocateHandle(int entityId) {
+        int slot;
+        if (!freeHandles.empty()) {
+            slot = freeHandles.back();
+            freeHandles.pop_back();
+        } else {
+            slot = (int)handleToEntity.size();
+            handleToEntity.push_back(-1);
+            handleGenerations.push_back(0);
+        }
+        handleToEntity[slot] = entityId;
+        entityToHandle[entityId] = slot;
+        return EntityHandle{ slot, handleGenerations[slot] };
+    }
 };
 
 #endif
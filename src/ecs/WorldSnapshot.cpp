@@ -0,0 +1,307 @@
+#include "WorldSnapshot.hpp"
+#include "World.hpp"
+#include "../core/BinaryIO.hpp"
+#include "../core/MappedFile.hpp"
+#include "../core/SimulationState.hpp"
+#include "../physics/TopologyEvents.hpp"
+#include "raylib.h"
+#include <chrono>
+#include <cstring>
+#include <cstddef>
+#include <filesystem>
+
+namespace {
+    constexpr char SNAPSHOT_MAGIC[8] = {'L', 'S', 'S', 'N', 'A', 'P', 0, 0};
+    constexpr uint32_t BYTE_ORDER_TAG = 0x01020304;
+    constexpr size_t SECTION_ALIGN = 16;
+
+    enum SectionId : uint32_t {
+        SECTION_TRANSFORMS = 1,
+        SECTION_ATOMS = 2,
+        SECTION_STATES = 3,
+        SECTION_CHILDREN = 4,
+        SECTION_COUNTERS = 5,
+        SECTION_RNG = 6,
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t entityCount;
+        uint32_t sectionCount;
+        uint64_t fileSize;
+    };
+
+    struct SectionEntry {
+        uint32_t id;
+        uint32_t elementSize;
+        uint64_t offset;
+        uint64_t count;
+    };
+
+    // StateComponent without the owning childList (see SECTION_CHILDREN)
+    struct PackedState {
+        int32_t moleculeId;
+        int32_t parentEntityId;
+        int32_t parentSlotIndex;
+        int32_t childCount;
+        uint32_t occupiedSlots;
+        uint32_t childBegin;
+        uint32_t childListSize;
+        int32_t cycleBondId;
+        int32_t ringSize;
+        int32_t ringIndex;
+        int32_t ringInstanceId;
+        int32_t structureId;
+        float dockingProgress;
+        float targetX;
+        float targetY;
+        float releaseTimer;
+        uint32_t topologyVersion;
+        uint32_t structureCheckedVersion;
+        int32_t structureCheckedGeneration;
+        uint8_t isClustered;
+        uint8_t isShielded;
+        uint8_t isInRing;
+        uint8_t isFrozen;
+        uint8_t justBonded;
+        uint8_t isAlive;
+        uint8_t pad[2];
+    };
+
+    struct Counters {
+        int32_t nextRingId;
+        int32_t nextStructureId;
+        uint32_t topologyClock;
+        uint32_t pad;
+        int64_t bondsFormed;
+        int64_t bondsBroken;
+    };
+
+    const SectionEntry* findSection(const SectionEntry* table, uint32_t count, uint32_t id) {
+        for (uint32_t i = 0; i < count; i++) if (table[i].id == id) return &table[i];
+        return nullptr;
+    }
+}
+
+void WorldSnapshot::write(const World& world, BinaryWriter& out) {
+    const size_t n = world.states.size();
+
+    std::vector<PackedState> packed(n);
+    std::vector<int32_t> children;
+    for (size_t i = 0; i < n; i++) {
+        const StateComponent& s = world.states[i];
+        PackedState& p = packed[i];
+        std::memset(&p, 0, sizeof(p));
+        p.moleculeId = s.moleculeId;
+        p.parentEntityId = s.parentEntityId;
+        p.parentSlotIndex = s.parentSlotIndex;
+        p.childCount = s.childCount;
+        p.occupiedSlots = s.occupiedSlots;
+        p.childBegin = (uint32_t)children.size();
+        p.childListSize = (uint32_t)s.childList.size();
+        children.insert(children.end(), s.childList.begin(), s.childList.end());
+        p.cycleBondId = s.cycleBondId;
+        p.ringSize = s.ringSize;
+        p.ringIndex = s.ringIndex;
+        p.ringInstanceId = s.ringInstanceId;
+        p.structureId = s.structureId;
+        p.dockingProgress = s.dockingProgress;
+        p.targetX = s.targetX;
+        p.targetY = s.targetY;
+        p.releaseTimer = s.releaseTimer;
+        p.topologyVersion = s.topologyVersion;
+        p.structureCheckedVersion = s.structureCheckedVersion;
+        p.structureCheckedGeneration = s.structureCheckedGeneration;
+        p.isClustered = s.isClustered;
+        p.isShielded = s.isShielded;
+        p.isInRing = s.isInRing;
+        p.isFrozen = s.isFrozen;
+        p.justBonded = s.justBonded;
+        p.isAlive = s.isAlive;
+    }
+
+    SimulationState& sim = SimulationState::getInstance();
+    TopologyEvents& events = TopologyEvents::getInstance();
+    Counters counters{};
+    counters.nextRingId = sim.getNextRingId();
+    counters.nextStructureId = sim.getNextStructureId();
+    counters.topologyClock = events.getClock();
+    counters.bondsFormed = events.getBondsFormed();
+    counters.bondsBroken = events.getBondsBroken();
+    std::string rng = sim.serializeRng();
+
+    const uint32_t sectionCount = 6;
+    const size_t start = out.size();  // Offsets are relative to the snapshot, so it can be embedded
+    Header header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_TAG;
+    header.entityCount = (uint32_t)n;
+    header.sectionCount = sectionCount;
+    out.write(header);
+
+    size_t tableOffset = out.size();
+    std::vector<SectionEntry> table(sectionCount);
+    out.writeArray(table.data(), table.size());  // Patched once offsets are known
+
+    auto section = [&](int slot, uint32_t id, uint32_t elementSize, const void* data, size_t count) {
+        out.align(SECTION_ALIGN);
+        table[slot] = SectionEntry{ id, elementSize, (uint64_t)(out.size() - start), (uint64_t)count };
+        out.writeBytes(data, (size_t)elementSize * count);
+    };
+    section(0, SECTION_TRANSFORMS, sizeof(TransformComponent), world.transforms.data(), n);
+    section(1, SECTION_ATOMS, sizeof(AtomComponent), world.atoms.data(), n);
+    section(2, SECTION_STATES, sizeof(PackedState), packed.data(), n);
+    section(3, SECTION_CHILDREN, sizeof(int32_t), children.data(), children.size());
+    section(4, SECTION_COUNTERS, sizeof(Counters), &counters, 1);
+    section(5, SECTION_RNG, 1, rng.data(), rng.size());
+
+    for (uint32_t i = 0; i < sectionCount; i++) out.patch(tableOffset + i * sizeof(SectionEntry), table[i]);
+    out.patch(start + offsetof(Header, fileSize), (uint64_t)(out.size() - start));
+}
+
+bool WorldSnapshot::save(const World& world, const std::string& path) {
+    BinaryWriter out;
+    write(world, out);
+
+    // Written beside the target and renamed over it, so a failed save never truncates the previous snapshot
+    std::string temp = path + ".tmp";
+    std::error_code ec;
+    if (!out.saveToFile(temp)) {
+        std::filesystem::remove(temp, ec);
+        TraceLog(LOG_ERROR, "[SNAPSHOT] Failed to write %s", temp.c_str());
+        return false;
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        TraceLog(LOG_ERROR, "[SNAPSHOT] Failed to replace %s", path.c_str());
+        return false;
+    }
+    TraceLog(LOG_INFO, "[SNAPSHOT] Saved %d entities to %s (%d KB)", (int)world.states.size(), path.c_str(), (int)(out.size() / 1024));
+    return true;
+}
+
+bool WorldSnapshot::load(World& world, const std::string& path) {
+    auto t0 = std::chrono::steady_clock::now();
+
+    MappedFile file;
+    if (!file.open(path)) {
+        TraceLog(LOG_ERROR, "[SNAPSHOT] Cannot open %s", path.c_str());
+        return false;
+    }
+    if (!read(world, file.data(), file.size(), path)) return false;
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    TraceLog(LOG_INFO, "[SNAPSHOT] Loaded %d entities from %s in %.2f ms", (int)world.states.size(), path.c_str(), ms);
+    return true;
+}
+
+bool WorldSnapshot::read(World& world, const char* data, size_t size, const std::string& source) {
+    Header header;
+    if (size < sizeof(Header)) return false;
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.byteOrder != BYTE_ORDER_TAG || header.version != VERSION || header.fileSize != size) {
+        TraceLog(LOG_ERROR, "[SNAPSHOT] %s is not a compatible version %u snapshot", source.c_str(), VERSION);
+        return false;
+    }
+    if (sizeof(Header) + (size_t)header.sectionCount * sizeof(SectionEntry) > size) return false;
+    if (header.entityCount == 0) {
+        TraceLog(LOG_ERROR, "[SNAPSHOT] %s has no entities (entity 0 is the player)", source.c_str());
+        return false;
+    }
+
+    // Everything is copied out with memcpy: an embedded snapshot may sit at any alignment
+    std::vector<SectionEntry> table(header.sectionCount);
+    std::memcpy(table.data(), data + sizeof(Header), table.size() * sizeof(SectionEntry));
+
+    // Validate every section before touching the world
+    auto get = [&](uint32_t id, uint32_t elementSize, uint64_t expectedCount) -> const SectionEntry* {
+        const SectionEntry* s = findSection(table.data(), header.sectionCount, id);
+        if (!s || s->elementSize != elementSize) return nullptr;
+        if (expectedCount != UINT64_MAX && s->count != expectedCount) return nullptr;
+        if (s->offset > size || s->count > (size - s->offset) / s->elementSize) return nullptr;  // No count * size overflow
+        return s;
+    };
+    const uint64_t n = header.entityCount;
+    const SectionEntry* trS = get(SECTION_TRANSFORMS, sizeof(TransformComponent), n);
+    const SectionEntry* atS = get(SECTION_ATOMS, sizeof(AtomComponent), n);
+    const SectionEntry* stS = get(SECTION_STATES, sizeof(PackedState), n);
+    const SectionEntry* chS = get(SECTION_CHILDREN, sizeof(int32_t), UINT64_MAX);
+    const SectionEntry* coS = get(SECTION_COUNTERS, sizeof(Counters), 1);
+    const SectionEntry* rnS = get(SECTION_RNG, 1, UINT64_MAX);
+    if (!trS || !atS || !stS || !chS || !coS || !rnS) {
+        TraceLog(LOG_ERROR, "[SNAPSHOT] %s has missing or mismatched sections (component layout changed?)", source.c_str());
+        return false;
+    }
+
+    const char* base = data;
+    std::vector<PackedState> packed(n);
+    std::vector<int32_t> children(chS->count);
+    std::memcpy(packed.data(), base + stS->offset, n * sizeof(PackedState));
+    std::memcpy(children.data(), base + chS->offset, children.size() * sizeof(int32_t));
+    for (uint64_t i = 0; i < n; i++) {
+        if ((uint64_t)packed[i].childBegin + packed[i].childListSize > chS->count) return false;
+    }
+
+    // Every stored link must name an entity in this snapshot (or -1) before the world is replaced
+    auto validIndex = [n](int32_t id) { return id == -1 || (id >= 0 && (uint64_t)id < n); };
+    for (uint64_t i = 0; i < n; i++) {
+        const PackedState& p = packed[i];
+        bool ok = validIndex(p.parentEntityId) && validIndex(p.cycleBondId) && validIndex(p.moleculeId);
+        for (uint32_t c = 0; ok && c < p.childListSize; c++) ok = validIndex(children[p.childBegin + c]);
+        if (!ok) {
+            TraceLog(LOG_ERROR, "[SNAPSHOT] %s: entity %d links to an index outside 0..%d", source.c_str(), (int)i, (int)n - 1);
+            return false;
+        }
+    }
+
+    // Adopt: component arrays are bulk copies straight out of the mapping
+    world.transforms.resize(n);
+    world.atoms.resize(n);
+    std::memcpy(world.transforms.data(), base + trS->offset, n * sizeof(TransformComponent));
+    std::memcpy(world.atoms.data(), base + atS->offset, n * sizeof(AtomComponent));
+
+    world.states.assign(n, StateComponent{});
+    for (uint64_t i = 0; i < n; i++) {
+        const PackedState& p = packed[i];
+        StateComponent& s = world.states[i];
+        s.moleculeId = p.moleculeId;
+        s.parentEntityId = p.parentEntityId;
+        s.parentSlotIndex = p.parentSlotIndex;
+        s.childCount = p.childCount;
+        s.occupiedSlots = p.occupiedSlots;
+        s.childList.assign(children.begin() + p.childBegin, children.begin() + p.childBegin + p.childListSize);
+        s.cycleBondId = p.cycleBondId;
+        s.ringSize = p.ringSize;
+        s.ringIndex = p.ringIndex;
+        s.ringInstanceId = p.ringInstanceId;
+        s.structureId = p.structureId;
+        s.dockingProgress = p.dockingProgress;
+        s.targetX = p.targetX;
+        s.targetY = p.targetY;
+        s.releaseTimer = p.releaseTimer;
+        s.topologyVersion = p.topologyVersion;
+        s.structureCheckedVersion = p.structureCheckedVersion;
+        s.structureCheckedGeneration = p.structureCheckedGeneration;
+        s.isClustered = p.isClustered != 0;
+        s.isShielded = p.isShielded != 0;
+        s.isInRing = p.isInRing != 0;
+        s.isFrozen = p.isFrozen != 0;
+        s.justBonded = p.justBonded != 0;
+        s.isAlive = p.isAlive != 0;
+    }
+    world.rebuildEntityTable();
+
+    Counters counters;
+    std::memcpy(&counters, base + coS->offset, sizeof(Counters));
+    std::string rng(base + rnS->offset, (size_t)rnS->count);
+    if (!SimulationState::getInstance().restore(counters.nextRingId, counters.nextStructureId, rng)) {
+        TraceLog(LOG_WARNING, "[SNAPSHOT] RNG state unreadable; keeping the current generator");
+    }
+    TopologyEvents::getInstance().restore(counters.topologyClock, counters.bondsFormed, counters.bondsBroken);
+    return true;
+}
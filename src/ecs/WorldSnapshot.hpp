@@ -0,0 +1,37 @@
+#ifndef WORLD_SNAPSHOT_HPP
+#define WORLD_SNAPSHOT_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+class World;
+class BinaryWriter;
+
+/**
+ * WorldSnapshot (Phase 53)
+ * Versioned binary save of a World, laid out to be memory-mapped and adopted
+ * with bulk copies instead of parsing:
+ *
+ *   Header   magic "LSSNAP", version, byte-order tag, entity count, file size
+ *   Table    sectionCount x { id, elementSize, offset, count }
+ *   Sections 16-byte aligned arrays: transforms, atoms, packed states,
+ *            flattened childList (CSR: each packed state stores begin/count),
+ *            counters (ring/structure ids, topology clock) and the RNG state
+ *
+ * Transforms and atoms are the in-memory structs byte for byte. StateComponent
+ * owns a std::vector, so it is stored as a fixed-layout PackedState.
+ */
+class WorldSnapshot {
+public:
+    static constexpr uint32_t VERSION = 2;  // 2: per-root structure cache generation
+
+    static bool save(const World& world, const std::string& path);
+    static bool load(World& world, const std::string& path);
+
+    // In-memory form (Phase 54: replay keyframes, parking the live world)
+    static void write(const World& world, BinaryWriter& out);
+    static bool read(World& world, const char* data, size_t size, const std::string& source);
+};
+
+#endif // WORLD_SNAPSHOT_HPP
@@ -65,6 +65,14 @@ struct StateComponent {
     bool justBonded = false;
     float releaseTimer = 0.0f; // Time since isShielded was set back to false
 
+    // === TOPOLOGY GROUP (Phase 47: Event-driven detection) ===
+    uint32_t topologyVersion = 0;          // Bumped on bond create/break (0 = never stamped)
+    uint32_t structureCheckedVersion = 0;  // Version StructureDetector last rejected (root only)
+    int structureCheckedGeneration = -1;   // StructureRegistry generation of that rejection
+
+    // === LIFECYCLE GROUP (Phase 51: Spawn/despawn) ===
+    bool isAlive = true;  // False while the slot waits on World's free-list
+
     // === UTILITY METHODS ===
     bool isLocked() const { return isClustered && dockingProgress >= 0.99f && !isShielded; }
 };
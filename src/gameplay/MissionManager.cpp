@@ -4,6 +4,7 @@
 #include "DiscoveryLog.hpp"
 #include "../core/LocalizationManager.hpp"
 #include "../core/JsonLoader.hpp"
+#include "../core/DataPack.hpp"
 
 void MissionManager::initialize() {
     reload();
@@ -14,9 +15,29 @@ void MissionManager::reload() {
     loadMissions();
 }
 
+void MissionManager::relocalize() {
+    std::string lang = LocalizationManager::getInstance().getLanguageCode();
+    if (DataPack::getInstance().relocalize(missions, lang)) return;
+
+    // No pack row: take the text from JSON, matched by id, and keep each mission's status
+    std::vector<Mission> previous = std::move(missions);
+    reload();
+    for (Mission& m : missions) {
+        for (const Mission& old : previous) {
+            if (old.id == m.id) { m.status = old.status; break; }
+        }
+    }
+}
+
 void MissionManager::loadMissions() {
     try {
         std::string lang = LocalizationManager::getInstance().getLanguageCode();
+        const DataPack& pack = DataPack::getInstance();
+        if (pack.hasLanguage(lang)) {
+            missions = pack.loadMissions(lang);  // Phase 63
+            TraceLog(LOG_INFO, "[MISSIONS] Loaded %d missions from data pack (Language: %s)", (int)missions.size(), lang.c_str());
+            return;
+        }
         missions = JsonLoader::loadMissions("data/missions.json", lang);
         TraceLog(LOG_INFO, "[MISSIONS] Loaded %d missions from JSON (Language: %s)", (int)missions.size(), lang.c_str());
     } catch (const std::exception& e) {
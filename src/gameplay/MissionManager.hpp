@@ -31,6 +31,7 @@ public:
 
     void initialize();
     void reload();
+    void relocalize();  // Phase 63: Language switch; keeps mission progress (reload() resets it)
     void update(float dt);
     
     const std::vector<Mission>& getMissions() const { return missions; }
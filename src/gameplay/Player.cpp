@@ -2,9 +2,11 @@
 #include "DockingSystem.hpp"
 #include "../input/InputHandler.hpp"
 #include "../physics/SpatialGrid.hpp"
+#include "../physics/StructureTracker.hpp"
 #include "../core/Config.hpp"
 #include "../core/MathUtils.hpp"
 #include <cmath>
+#include <algorithm>
 
 Player::Player(int entityIndex) : playerIndex(entityIndex) {
     atomicNumber = 1; 
@@ -72,7 +74,10 @@ void Player::update(float dt, const InputHandler& input,
 
     // 5. UNDO (delegated to UndoManager)
     if (input.isReleaseTriggered()) {
-        undoManager.undoLast(playerIndex, states, atoms);
+        if (undoManager.undoLast(playerIndex, worldTransforms, states, atoms) && undoManager.restoredCheckpoint()) {
+            tractor.release();  // The captured atom is back in its pre-capture state
+            lastRootId = -1;
+        }
     }
 }
 
@@ -101,6 +106,7 @@ void Player::applyPhysics(std::vector<TransformComponent>& worldTransforms,
     bool isInFrozenStructure = states[idx].isFrozen && states[idx].structureId != -1;
     
     if (tractor.becameActive()) {
+        undoManager.checkpoint(worldTransforms, atoms, states);  // Phase 56: interaction boundary
         TraceLog(LOG_INFO, "[TRACTOR_DEBUG] === NEW CAPTURE: idx=%d ===", idx);
         TraceLog(LOG_INFO, "[TRACTOR_DEBUG] BEFORE: parent=%d, cycle=%d, molId=%d, clustered=%d, ring=%d, childCount=%d",
                  states[idx].parentEntityId, states[idx].cycleBondId, states[idx].moleculeId,
@@ -119,16 +125,18 @@ void Player::applyPhysics(std::vector<TransformComponent>& worldTransforms,
             TraceLog(LOG_INFO, "[TRACTOR_DEBUG] hasBonds=%d", hasBonds ? 1 : 0);
             
             if (hasBonds) {
-                // Get old members BEFORE breaking (to re-propagate them after)
-                std::vector<int> oldMembers = MathUtils::getMoleculeMembers(idx, states);
-                TraceLog(LOG_INFO, "[TRACTOR_DEBUG] oldMembers.size=%d", (int)oldMembers.size());
+                // Phase 69: Every fragment left behind touches one of idx's former neighbours,
+                // so re-propagate from those (O(degree) seeds) instead of the old member list
+                std::vector<int> neighbours = states[idx].childList;
+                if (states[idx].parentEntityId != -1) neighbours.push_back(states[idx].parentEntityId);
+                if (states[idx].cycleBondId != -1) neighbours.push_back(states[idx].cycleBondId);
+                TraceLog(LOG_INFO, "[TRACTOR_DEBUG] neighbours=%d", (int)neighbours.size());
                 
                 BondingSystem::breakAllBonds(idx, states, atoms);
                 
-                // Re-propagate moleculeId for remaining structure members
-                for (int oldId : oldMembers) {
-                    if (oldId != idx && states[oldId].isClustered) {
-                        BondingSystem::propagateMoleculeId(oldId, states);
+                for (int n : neighbours) {
+                    if (n != idx && states[n].isClustered) {
+                        BondingSystem::propagateMoleculeId(n, states);
                     }
                 }
             }
@@ -149,6 +157,18 @@ void Player::applyPhysics(std::vector<TransformComponent>& worldTransforms,
     // Always shield and move the CLICKED atom (idx), not any root
     states[idx].isShielded = true;
     auto& targetTr = worldTransforms[idx];
+
+    // Phase 68: In structural mode the steering acts on the assembly's momentum, not on one atom
+    const StructureInstance* structure = nullptr;
+    Vector2 structureVel = { 0.0f, 0.0f };
+    if (structuralMode && isInFrozenStructure) {
+        structure = StructureTracker::getInstance().find(states[idx].structureId, states, atoms);
+        if (structure) {
+            structureVel = StructureTracker::velocity(*structure, worldTransforms);
+            targetTr.vx = structureVel.x;
+            targetTr.vy = structureVel.y;
+        }
+    }
     Vector2 tPos = tractor.getTargetPosition();
     
     float dx = tPos.x - targetTr.x;
@@ -186,14 +206,17 @@ void Player::applyPhysics(std::vector<TransformComponent>& worldTransforms,
     }
     
     // Phase 45: If in structural mode, apply same velocity to ALL atoms in structure
-    if (structuralMode && isInFrozenStructure) {
-        int structId = states[idx].structureId;
-        for (int i = 0; i < (int)worldTransforms.size(); i++) {
-            if (i != idx && states[i].structureId == structId && states[i].isFrozen) {
-                states[i].isShielded = true;  // Shield all structure atoms
-                worldTransforms[i].vx = targetTr.vx;
-                worldTransforms[i].vy = targetTr.vy;
-            }
+    // Phase 68: Only the structure's members are visited. The beam's velocity change is
+    // an impulse on the whole assembly, so assemblies heavier than the reference mass
+    // accelerate proportionally slower, and every member keeps the same (rigid) velocity.
+    if (structure) {
+        float inertia = std::min(1.0f, Config::TRACTOR_STRUCTURE_REF_MASS / structure->mass);
+        float vx = structureVel.x + (targetTr.vx - structureVel.x) * inertia;
+        float vy = structureVel.y + (targetTr.vy - structureVel.y) * inertia;
+        for (int member : structure->members) {
+            states[member].isShielded = true;  // Shield all structure atoms
+            worldTransforms[member].vx = vx;
+            worldTransforms[member].vy = vy;
         }
     }
 }
@@ -38,6 +38,13 @@ public:
     float getZoomTarget() const { return 2.5f; }
     int getEntityIndex() const { return playerIndex; }
 
+    // Phase 51: Raw indices held by the player follow World::compact()
+    void remapEntities(const std::vector<int>& remap) {
+        tractor.remapEntities(remap);
+        undoManager.remapEntities(remap);
+        lastRootId = remapEntityIndex(remap, lastRootId);
+    }
+
 private:
     int playerIndex;
     TractorBeam tractor;
@@ -4,6 +4,7 @@
 #include <cmath>
 
 #include "../chemistry/ChemistryDatabase.hpp"
+#include "../physics/CompositionTracker.hpp"
 
 void TractorBeam::update(const Vector2& mouseWorldPos, bool isInputActive, 
                          const std::vector<TransformComponent>& transforms,
@@ -77,11 +78,8 @@ void TractorBeam::update(const Vector2& mouseWorldPos, bool isInputActive,
 
     if (bestIdx != -1) {
         // --- SMART LOGGING: IDENTIFY MOLECULE ---
-        // 1. Calculate Composition (O(N) but only on click)
-        std::map<int, int> comp = MathUtils::getMoleculeComposition(bestIdx, states, atoms);
-        
-        // 2. Look up in Database
-        const Molecule* mol = ChemistryDatabase::getInstance().findMoleculeByComposition(comp);
+        // Cached per-molecule composition + hashed lookup (Phase 49)
+        const Molecule* mol = CompositionTracker::getInstance().identify(bestIdx, states, atoms);
         
         const char* molName = mol ? mol->name.c_str() : "Unknown Structure";
         const char* atomName = ChemistryDatabase::getInstance().getElement(atoms[bestIdx].atomicNumber).symbol.c_str();
@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include "../ecs/components.hpp"
 #include "../physics/SpatialGrid.hpp"
+#include "../ecs/EntityHandle.hpp"
 #include <vector>
 
 /**
@@ -27,6 +28,12 @@ public:
     bool becameActive() const { return isNewCapture; } // Returns true on the frame a capture occurred
     void release() { active = false; targetIndex = -1; isNewCapture = false; }
 
+    // Phase 51: Keep the captured atom across World::compact()
+    void remapEntities(const std::vector<int>& remap) {
+        targetIndex = remapEntityIndex(remap, targetIndex);
+        if (targetIndex == -1) active = false;
+    }
+
 private:
     int targetIndex; 
     bool active;
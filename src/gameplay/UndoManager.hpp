@@ -7,12 +7,22 @@
 #include "../ui/NotificationManager.hpp"
 #include "../core/Config.hpp"
 #include "../core/LocalizationManager.hpp"
+#include "../ecs/EntityHandle.hpp"
+#include "../ecs/CheckpointStore.hpp"
+#include "../physics/TopologyEvents.hpp"
 #include <vector>
+#include <deque>
+#include <algorithm>
 
 /**
  * UNDO MANAGER
  * Manages attachment history for hierarchical undo.
  * Extracted from Player.cpp for single-responsibility.
+ *
+ * Phase 56: Interactions (tractor captures) take a copy-on-write checkpoint
+ * of the whole world first; undo restores the newest one, bringing back
+ * positions, bonds, rings and isolated atoms. The bond-breaking undo below
+ * remains the fallback once the checkpoint history is empty.
  */
 class UndoManager {
 public:
@@ -24,18 +34,49 @@ public:
     }
 
     /**
-     * Attempt to undo the last attachment.
+     * Checkpoint the world at an interaction boundary (before it mutates anything).
+     */
+    void checkpoint(
+        const std::vector<TransformComponent>& transforms,
+        const std::vector<AtomComponent>& atoms,
+        const std::vector<StateComponent>& states
+    ) {
+        if (!Config::UNDO_CHECKPOINTS_ENABLED) return;
+        checkpoints.take(transforms, atoms, states);
+        orderHistory.push_back(attachmentOrder);
+        while ((int)orderHistory.size() > checkpoints.size()) orderHistory.pop_front();
+    }
+
+    /**
+     * Attempt to undo the last interaction (checkpoint) or attachment.
      * @param playerIdx Player's entity index
+     * @param transforms Transform components
      * @param states State components
      * @param atoms Atom components
      * @return true if an undo was performed
      */
     bool undoLast(
         int playerIdx,
+        std::vector<TransformComponent>& transforms,
         std::vector<StateComponent>& states,
         std::vector<AtomComponent>& atoms
     ) {
         auto& lm = LocalizationManager::getInstance();
+        restoredLast = false;
+
+        // Phase 56: Full-state rollback while history is available
+        while (!checkpoints.empty()) {
+            std::vector<int> order = std::move(orderHistory.back());
+            orderHistory.pop_back();
+            if (!checkpoints.restoreLatest(transforms, atoms, states, restoredStates)) continue;
+
+            attachmentOrder = std::move(order);
+            // Fresh stamps: caches keyed by topologyVersion (census, detector, hasher) re-evaluate
+            for (int id : restoredStates) TopologyEvents::getInstance().touch(id, states);
+            restoredLast = true;
+            NotificationManager::getInstance().show(lm.get("ui.notification.undo_restored"), Config::THEME_INFO);
+            return true;
+        }
 
         // First check if player itself is attached to something
         if (states[playerIdx].parentEntityId != -1) {
@@ -74,6 +115,28 @@ public:
      */
     void clear() {
         attachmentOrder.clear();
+        clearCheckpoints();
+    }
+
+    /**
+     * Drop the checkpoint history (entities were spawned, despawned or renumbered).
+     */
+    void clearCheckpoints() {
+        checkpoints.clear();
+        orderHistory.clear();
+    }
+
+    // True if the last successful undoLast() rolled the world back to a checkpoint
+    bool restoredCheckpoint() const { return restoredLast; }
+    const CheckpointStore& getCheckpoints() const { return checkpoints; }
+
+    /**
+     * Follow World::compact(); despawned atoms drop out of the history.
+     */
+    void remapEntities(const std::vector<int>& remap) {
+        clearCheckpoints();  // Pages hold the old layout
+        for (int& id : attachmentOrder) id = remapEntityIndex(remap, id);
+        attachmentOrder.erase(std::remove(attachmentOrder.begin(), attachmentOrder.end(), -1), attachmentOrder.end());
     }
 
     /**
@@ -85,6 +148,10 @@ public:
 
 private:
     std::vector<int> attachmentOrder;
+    CheckpointStore checkpoints;
+    std::deque<std::vector<int>> orderHistory;  // attachmentOrder at each checkpoint
+    std::vector<int> restoredStates;
+    bool restoredLast = false;
 };
 
 #endif // UNDO_MANAGER_HPP
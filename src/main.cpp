@@ -1,20 +1,34 @@
 ﻿#include "raylib.h"
 #include <vector>
+#include <string>
 #include <cstdio>
 #include <algorithm>
 #include <cstdarg>
+#include <chrono>
 
 // Modular Architecture
 #include "ecs/World.hpp"
+#include "ecs/WorldSnapshot.hpp"
+#include "ecs/SimulationRecorder.hpp"
+#include "ecs/ReplayPlayer.hpp"
+#include "ecs/StateHasher.hpp"
+#include "ecs/HierarchyIndex.hpp"
 #include "physics/PhysicsEngine.hpp"
 #include "physics/BondingSystem.hpp"
 #include "physics/SpatialGrid.hpp"
+#include "physics/CompositionTracker.hpp"
+#include "physics/StructureTracker.hpp"
+#include "physics/MoleculeCensus.hpp"
 #include "rendering/CameraSystem.hpp"
 #include "rendering/Renderer25D.hpp"
 #include "chemistry/ChemistryDatabase.hpp"
 #include "chemistry/StructureRegistry.hpp"
 #include "core/Config.hpp"
 #include "core/MathUtils.hpp"
+#include "core/SimulationState.hpp"
+#include "core/HotReloader.hpp"
+#include "core/AsyncLogger.hpp"
+#include "core/MetricsRegistry.hpp"
 #include "gameplay/Player.hpp"
 #include "ui/LabelSystem.hpp"
 #include "ui/Inspector.hpp"
@@ -22,36 +36,18 @@
 #include "ui/UIWidgets.hpp"
 #include "ui/NotificationManager.hpp"
 #include "ui/Quimidex.hpp"
+#include "ui/PerfOverlay.hpp"
 #include "gameplay/MissionManager.hpp"
 #include "world/zones/ClayZone.hpp"
+#include "world/ChunkStreamer.hpp"
 #include "ui/LoadingScreen.hpp"
 #include "core/LocalizationManager.hpp"
 #include <iostream>
 
-// File Logger for persistence
-static FILE* logFile = nullptr;
-void FileLogCallback(int logLevel, const char* text, va_list args) {
-    if (logFile) {
-        const char* levelStr[] = { "ALL", "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "FATAL", "NONE" };
-        fprintf(logFile, "[%s] ", levelStr[logLevel]);
-        vfprintf(logFile, text, args);
-        fprintf(logFile, "\n");
-        fflush(logFile);
-    }
-    // Also show in console
-    char buffer[256];
-    vsnprintf(buffer, 256, text, args);
-    printf("[%s] %s\n", logLevel == LOG_INFO ? "INFO" : "DEBUG", buffer);
-}
-
 int main() {
-    // Open log file BEFORE initializing Raylib
-    logFile = fopen("session.log", "w");
-    if (logFile) {
-        fprintf(logFile, "=== LIFE SIMULATOR SESSION LOG ===\n");
-        fflush(logFile);
-    }
-    SetTraceLogCallback(FileLogCallback);
+    // Phase 65: Session log written by a background thread, started BEFORE initializing Raylib
+    AsyncLogger::getInstance().start(Config::LOG_PATH);
+    SetTraceLogCallback(AsyncLogger::traceLogCallback);
 
     SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI);
     InitWindow(Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT, "LifeSimulator C++ | Nano-HD Architecture");
@@ -69,6 +65,7 @@ int main() {
     physics.getEnvironment().addZone(clayIsland);
     InputHandler input;
     Inspector inspector;
+    PerfOverlay perfOverlay;  // Phase 67: F3
     CameraSystem cameraSys; 
     
     // 1. LOADING SCREEN & INITIALIZATION SEQUENCE
@@ -81,6 +78,8 @@ int main() {
     StructureRegistry::getInstance().loadFromDisk("data/structures.json");    
     // Step 2: World Generation (Primordial Density)
     loading.draw(0.5f, lang.get("ui.loading.world_gen").c_str());
+    // Phase 55: Same seed -> same world and same jitter stream
+    if (Config::DETERMINISTIC_MODE) SimulationState::getInstance().seed((uint32_t)Config::DETERMINISTIC_SEED);
     World world;
     // TEMPORARY: Using test mode for ring formation debugging
     world.initializeTestMode(); // Change back to world.initialize() when done testing
@@ -107,10 +106,91 @@ int main() {
     bool inspectingPlayer = false;
     bool inspectingMolecule = false;
 
+    // Phase 50: Population time series (incremental, event-driven)
+    if (Config::CENSUS_ENABLED) {
+        MoleculeCensus::getInstance().initialize(world.states, world.atoms, Config::CENSUS_CSV_PATH, Config::CENSUS_BIN_PATH);
+    }
+
+    // Phase 52: Page far-away molecules out to disk
+    ChunkStreamer streamer;
+    const std::string chunkDirectory = std::string(GetApplicationDirectory()) + Config::CHUNK_DIRECTORY;
+    if (Config::CHUNK_STREAMING_ENABLED) streamer.initialize(chunkDirectory);
+
+    // Phase 55: Per-tick state digests; a reference log from an earlier run is checked tick by tick
+    StateHasher hasher;
+    if (Config::DETERMINISTIC_MODE) {
+        hasher.loadReference(Config::STATE_HASH_REFERENCE_PATH);
+        hasher.openLog(Config::STATE_HASH_LOG_PATH);
+    }
+
+    // Phase 54: Per-tick delta recording, scrubbable replay (F10)
+    SimulationRecorder recorder;
+    if (Config::RECORDING_ENABLED) recorder.start(Config::RECORDING_PATH);
+    ReplayPlayer replay;
+    BinaryWriter parkedWorld;  // Live world while a replay is shown
+    bool replaying = false;
+
+    // Per-entity caches outside the World, rebuilt whenever entity indices change
+    // (compaction, streaming, snapshot load, replay entry and scrubbing)
+    auto onEntitiesRenumbered = [&]() {
+        CompositionTracker::getInstance().clear();
+        StructureTracker::getInstance().clear();
+        HierarchyIndex::getInstance().clear();
+        MoleculeCensus::getInstance().onEntitiesRemapped(world.states, world.atoms);
+    };
+
+    // Streaming spawns/despawns atoms: undo checkpoints cannot span that (Phase 56) and
+    // evicted/loaded members change index (Phase 68)
+    auto streamChunks = [&](auto&& work) {
+        const ChunkStreamerStats& cs = streamer.getStats();
+        long long moved = cs.atomsEvicted + cs.atomsLoaded;
+        work();
+        if (cs.atomsEvicted + cs.atomsLoaded != moved) {
+            player.getUndoManager().clearCheckpoints();
+            onEntitiesRenumbered();
+        }
+    };
+
+    // Every index held outside the World refers to the old layout after a load/replay swap
+    auto onWorldReplaced = [&]() {
+        std::vector<int> none;
+        player.remapEntities(none);
+        physics.remapEntities(none, world.transforms, world.states);
+        if (Config::CHUNK_STREAMING_ENABLED && !replaying) streamer.initialize(chunkDirectory);
+        onEntitiesRenumbered();
+        recorder.requestKeyframe();
+        hasher.invalidate();
+        selectedEntityIndex = -1;
+        inspector.setMolecule(nullptr);
+    };
+
+    // Phase 64: Edits to the data JSON are parsed in the background and applied between ticks
+    HotReloader hotReload;
+    if (Config::HOT_RELOAD_ENABLED) hotReload.start(Config::DATA_DIRECTORY);
+
     float accumulator = 0.0f;
     const float fixedDeltaTime = Config::FIXED_DELTA_TIME; 
+    MetricsRegistry& metrics = MetricsRegistry::getInstance();
+    int ticksSinceMetricsExport = 0;
+
+    // Phase 67: Where each frame's time goes; recorded when the next frame starts
+    using PerfClock = std::chrono::steady_clock;
+    auto msSince = [](PerfClock::time_point start) {
+        return std::chrono::duration<float, std::milli>(PerfClock::now() - start).count();
+    };
+    FrameTiming frameTiming;
+    PerfClock::time_point frameStart = PerfClock::now();
+    bool firstFrame = true;
 
     while (!WindowShouldClose()) {
+        if (!firstFrame) {
+            frameTiming.frameMs = msSince(frameStart);
+            perfOverlay.recordFrame(frameTiming);
+        }
+        firstFrame = false;
+        frameStart = PerfClock::now();
+        frameTiming = FrameTiming{};
+
         float frameTime = GetFrameTime();
         if (frameTime > Config::MAX_FRAME_TIME) frameTime = Config::MAX_FRAME_TIME;
         
@@ -121,9 +201,9 @@ int main() {
             std::string nextLang = (lm.getLanguageCode() == "es") ? "en" : "es";
             lm.setLanguage(nextLang);
             
-            // Reload all localized systems
-            db.reload();
-            MissionManager::getInstance().reload();
+            // Re-copy localised text only; catalog indices and mission progress are kept
+            db.relocalize();
+            MissionManager::getInstance().relocalize();
             quimidex.reload();
             
             NotificationManager::getInstance().show(
@@ -138,14 +218,104 @@ int main() {
         input.update();
 
         // SIMULATION (Fixed Timestep)
+        PerfClock::time_point simStart = PerfClock::now();
+        if (replaying) accumulator = 0.0f;  // Simulation is frozen while scrubbing
         while (accumulator >= fixedDeltaTime) {
+            auto tickStart = std::chrono::steady_clock::now();
+            if (Config::HOT_RELOAD_ENABLED) {
+                uint32_t reloaded = hotReload.applyPending();
+                if (reloaded & HotReloader::MOLECULES) inspector.setMolecule(nullptr);  // Molecule pointers are stale
+            }
             player.update(fixedDeltaTime, input, world.transforms, camera, physics.getGrid(), world.states, world.atoms);
             player.applyPhysics(world.transforms, world.states, world.atoms);
             physics.step(fixedDeltaTime, world.transforms, world.atoms, world.states, db, player.getTractor().getTargetIndex());
             BondingSystem::updateHierarchy(world.transforms, world.states, world.atoms);
             NotificationManager::getInstance().update(fixedDeltaTime);
             MissionManager::getInstance().update(fixedDeltaTime);
+
+            // Phase 55: Streaming and compaction run per fixed step, not per rendered frame,
+            // so they land on the same tick in every run
+            if (Config::CHUNK_STREAMING_ENABLED) {
+                streamChunks([&]() { streamer.update(world, player.getEntityIndex(), player.getTractor().getTargetIndex()); });
+            }
+
+            // Phase 51: Squeeze out despawned slots once enough have accumulated
+            if (world.shouldCompact()) {
+                std::vector<int> remap = world.compact();
+                player.remapEntities(remap);
+                physics.remapEntities(remap, world.transforms, world.states);
+                onEntitiesRenumbered();
+                selectedEntityIndex = remapEntityIndex(remap, selectedEntityIndex);
+            }
+
+            MoleculeCensus::getInstance().update(world.states, world.atoms);
+            if (Config::DETERMINISTIC_MODE) hasher.update(world);
+            recorder.recordTick(world, SimulationRecorder::captureInput(input));
             accumulator -= fixedDeltaTime;
+
+            // Phase 66: Tick cost distribution and the periodic metrics file
+            if constexpr (Config::METRICS_ENABLED) {
+                metrics.tickDurationMs.observe(std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - tickStart).count());
+                if (++ticksSinceMetricsExport >= Config::METRICS_EXPORT_TICKS) {
+                    metrics.writeSnapshot(Config::METRICS_PATH);
+                    ticksSinceMetricsExport = 0;
+                }
+            }
+        }
+        frameTiming.simMs = msSince(simStart);
+
+        // Phase 53: Quick save / quick load
+        if (IsKeyPressed(KEY_F5) && !replaying) {
+            if (Config::CHUNK_STREAMING_ENABLED) streamChunks([&]() { streamer.loadAll(world); });  // Save the whole world, not just the loaded part
+            bool saved = WorldSnapshot::save(world, Config::SNAPSHOT_PATH);
+            NotificationManager::getInstance().show(lang.get(saved ? "ui.notification.world_saved" : "ui.notification.save_failed"), saved ? LIME : RED);
+        }
+        if (IsKeyPressed(KEY_F9) && !replaying) {
+            if (WorldSnapshot::load(world, Config::SNAPSHOT_PATH)) {
+                onWorldReplaced();
+                NotificationManager::getInstance().show(lang.get("ui.notification.world_loaded"), LIME);
+            } else {
+                NotificationManager::getInstance().show(lang.get("ui.notification.load_failed"), RED);
+            }
+        }
+
+        // Phase 54: Replay mode parks the live world and shows recorded frames instead
+        if (IsKeyPressed(KEY_F10) && Config::RECORDING_ENABLED) {
+            if (!replaying) {
+                recorder.flush();
+                if (Config::CHUNK_STREAMING_ENABLED) streamChunks([&]() { streamer.loadAll(world); });  // Chunk files are reset on return
+                parkedWorld.clear();
+                WorldSnapshot::write(world, parkedWorld);
+                if (replay.open(Config::RECORDING_PATH) && replay.seek(replay.getFrameCount() - 1, world)) {
+                    replaying = true;
+                    onWorldReplaced();
+                } else {
+                    replay.close();
+                    WorldSnapshot::read(world, parkedWorld.data().data(), parkedWorld.size(), "parked world");
+                    onWorldReplaced();
+                    NotificationManager::getInstance().show(lang.get("ui.notification.no_replay"), RED);
+                }
+            } else {
+                replay.close();
+                replaying = false;
+                WorldSnapshot::read(world, parkedWorld.data().data(), parkedWorld.size(), "parked world");
+                onWorldReplaced();
+            }
+        }
+        if (replaying) {
+            int target = replay.getCurrentFrame();
+            int stride = IsKeyDown(KEY_LEFT_SHIFT) ? 60 : 1;
+            if (IsKeyPressed(KEY_RIGHT) || IsKeyPressedRepeat(KEY_RIGHT)) target += stride;
+            if (IsKeyPressed(KEY_LEFT) || IsKeyPressedRepeat(KEY_LEFT)) target -= stride;
+            if (IsKeyPressed(KEY_PAGE_UP)) target += Config::RECORD_KEYFRAME_TICKS;
+            if (IsKeyPressed(KEY_PAGE_DOWN)) target -= Config::RECORD_KEYFRAME_TICKS;
+            if (IsKeyPressed(KEY_HOME)) target = 0;
+            if (IsKeyPressed(KEY_END)) target = replay.getFrameCount() - 1;
+            if (target != replay.getCurrentFrame() && replay.seek(target, world)) {
+                onEntitiesRenumbered();  // Topology versions rewind with the frames
+                physics.refreshGrid(world.transforms, world.states);  // Phase 58: culling reads the grid
+            }
         }
 
         // VISUALS
@@ -180,16 +350,19 @@ int main() {
             quimidex.toggle();
         }
 
+        if (IsKeyPressed(KEY_F3)) perfOverlay.toggle();
+
         if (inspectingMolecule) {
             int targetIdx = player.getTractor().getTargetIndex();
             if (targetIdx == -1) targetIdx = 0; // Fallback to player molecule
 
             if (targetIdx >= 0 && targetIdx < (int)world.atoms.size()) {
-                auto composition = MathUtils::getMoleculeComposition(targetIdx, world.states, world.atoms);
-                const Molecule* detected = ChemistryDatabase::getInstance().findMoleculeByComposition(composition);
+                // Phase 49: O(1) while the molecule's topology is unchanged
+                auto& tracker = CompositionTracker::getInstance();
+                const Molecule* detected = tracker.identify(targetIdx, world.states, world.atoms);
                 
                 inspector.setMolecule(detected);
-                inspector.setComposition(composition);
+                inspector.setComposition(tracker.getComposition(targetIdx, world.states, world.atoms).toMap());
                 
                 if (detected) {
                     DiscoveryLog::getInstance().discoverMolecule(detected->id);
@@ -200,11 +373,12 @@ int main() {
 
         BeginDrawing();
             ClearBackground(Config::THEME_BACKDROP); 
+            PerfClock::time_point renderStart = PerfClock::now();
 
             BeginMode2D(camera);
                 physics.getEnvironment().draw();
-                Renderer25D::drawAtoms(world.transforms, world.atoms, world.states);
-                LabelSystem::draw(camera, world.transforms, world.atoms);
+                Renderer25D::drawAtoms(world.transforms, world.atoms, world.states, camera, physics.getGrid());
+                LabelSystem::draw(camera, world.transforms, world.atoms, world.states, physics.getGrid());
 
                 if (player.getTractor().isActive() && player.getTractor().getTargetIndex() != -1) {
                     TransformComponent& targetTr = world.transforms[player.getTractor().getTargetIndex()];
@@ -221,7 +395,10 @@ int main() {
                         Renderer25D::drawDebugSlots(target, world.transforms, world.atoms);
                     }
                 }
+                perfOverlay.drawHeatmap(camera, physics.getGrid());
             EndMode2D();
+            frameTiming.renderMs = msSince(renderStart);
+            PerfClock::time_point uiStart = PerfClock::now();
 
             HUD::draw(camera, cameraSys.getMode() == CameraSystem::FREE_LOOK, input);
 
@@ -240,15 +417,33 @@ int main() {
                 }
             }
 
+            if (replaying) {
+                const RecordedInput& rin = replay.getInput();
+                DrawText(TextFormat(LOC("ui.replay.status"),
+                                    replay.getCurrentFrame() + 1, replay.getFrameCount(), replay.getTick(replay.getCurrentFrame()),
+                                    replay.getBondsFormed(), replay.getBondsBroken(), rin.moveX, rin.moveY,
+                                    (rin.flags & RecordingFormat::INPUT_TRACTOR) ? LOC("ui.replay.tractor") : ""),
+                         20, GetScreenHeight() - 40, 20, Config::THEME_BORDER);
+            }
+
             // NOTIFICATIONS (Above all)
             NotificationManager::getInstance().draw();
             quimidex.draw(input);
+            frameTiming.uiMs = msSince(uiStart);
+            perfOverlay.draw(world.transforms, world.atoms, world.states, physics);
 
         EndDrawing();
     }
 
+    hotReload.stop();
+    if constexpr (Config::METRICS_ENABLED) metrics.writeSnapshot(Config::METRICS_PATH);  // Final totals
+    recorder.stop();
+    hasher.close();
+    MoleculeCensus::getInstance().shutdown();
+    Renderer25D::shutdown();
+    LabelSystem::shutdown();
     CloseWindow();
-    if (logFile) fclose(logFile);
+    AsyncLogger::getInstance().stop();
     return 0;
 }
 
@@ -12,6 +12,7 @@
 #include "RingChemistry.hpp"
 #include "BondingTypes.hpp"
 #include "StructureDetector.hpp"
+#include "BondingScheduler.hpp"
 
 /**
  * AutonomousBonding (Phase 30)
@@ -38,7 +39,8 @@ public:
                                          std::vector<TransformComponent>& transforms,
                                          const SpatialGrid& grid,
                                          EnvironmentManager* env = nullptr,
-                                         int tractedRoot = -1) {
+                                         int tractedRoot = -1,
+                                         BondingScheduler* scheduler = nullptr) {
         
         // 1. MACRO-ALIGNMENT (Phase 18: Structure Magnetism)
         // Group atoms by ringInstanceId to treat them as Rigid Bodies
@@ -241,8 +243,13 @@ public:
         }
 
         // 2. MICRO-BONDING (Existing Logic)
+        // Phase 46: With a scheduler only one interleaved bucket of atoms is evaluated per tick
+        if (scheduler) scheduler->beginTick(states.size());
+
         for (int i = 0; i < (int)states.size(); i++) {
-            // ... (rest of function)
+            if (scheduler && !scheduler->isScheduled(i)) continue;
+            if (!states[i].isAlive) continue;  // Phase 51: Despawned slot
+
             // EARLY EXIT: prioritize one bond per atom per tick
             if (states[i].justBonded) continue;
             if (states[i].isLocked() && states[i].isInRing) continue;
@@ -250,6 +257,9 @@ public:
             // Skip the exact atom being dragged by tractor (but allow its molecule to bond)
             if (tractedRoot != -1 && i == tractedRoot) continue;
 
+            if (scheduler) scheduler->recordEvaluation();
+            bool hadContact = false;
+
             std::vector<int> neighbors = grid.getNearby({transforms[i].x, transforms[i].y}, Config::BOND_AUTO_RANGE * 1.5f);
 
             // CRITICAL FIX: Sort neighbors by distance to prevent "Cross-Threading" (Tangling)
@@ -285,9 +295,13 @@ public:
                         // STRUCTURE DETECTION: Check if molecule can form a known structure
                         bool inRingZone = env && env->isInRingFormingZone({transforms[i].x, transforms[i].y});
                         if (inRingZone && !states[i].isInRing) {
+                            // Budget exhausted: defer detection to this atom's next turn
+                            if (scheduler && !scheduler->consumeStructureAttempt()) break;
+
                             // Try to detect and form a structure from this molecule
-                            if (StructureDetector::tryFormStructure(rootI, states, atoms, transforms)) {
+                            if (StructureDetector::tryFormStructure(rootI, states, atoms, transforms, i)) {
                                 states[i].justBonded = true;
+                                if (scheduler) scheduler->recordStructure();
                                 break;  // Structure formed, done with this atom
                             }
                         }
@@ -302,15 +316,28 @@ public:
                             if (inGracePeriod) continue;  // Skip - prevent rebonding during grace period
 
                             // Standard bonding - let atoms bond freely
-                            if ((BondError)BondingCore::tryBond(i, j, states, atoms, transforms, false, 1.0f) == BondError::SUCCESS) {
+                            // A bonded atom never re-docks on its own: tryBond would pull it off its
+                            // parent. Bond from the other side when that one is free or a root.
+                            int source = i, target = j;
+                            if (states[i].parentEntityId != -1) {
+                                if (states[j].parentEntityId != -1) continue;
+                                std::swap(source, target);
+                            }
+                            if ((BondError)BondingCore::tryBond(source, target, states, atoms, transforms, false, 1.0f) == BondError::SUCCESS) {
                                 states[i].justBonded = true;
                                 states[j].justBonded = true;
+                                if (scheduler) scheduler->recordBond(i);
+                                hadContact = false;
                                 break; 
                             }
+                            hadContact = true;
                         }
                     }
                 }
             }
+
+            if (scheduler && hadContact) scheduler->recordContact(i);
+            else if (scheduler && !states[i].justBonded) scheduler->clearContact(i);
         }
     }
 };
@@ -132,6 +132,11 @@ public:
         }
 
         if (bestHostId != -1) {
+            // A docking atom that is re-parented leaves its old parent first (Phase 69:
+            // a stale childList entry would merge the old fragment into this molecule)
+            int oldParentId = states[sourceId].parentEntityId;
+            if (oldParentId != -1) MolecularHierarchy::unlinkFromParent(sourceId, states);
+
             states[sourceId].isClustered = true;
             states[sourceId].parentEntityId = bestHostId; 
             states[sourceId].parentSlotIndex = bestSlotIdx;
@@ -143,6 +148,11 @@ public:
             states[bestHostId].childList.push_back(sourceId);  // Phase 43: sync childList
 
             MolecularHierarchy::propagateMoleculeId(sourceId, states);
+            if (oldParentId != -1) MolecularHierarchy::propagateMoleculeId(oldParentId, states);
+            assert(MolecularHierarchy::checkLinks(sourceId, states));
+            assert(MolecularHierarchy::checkLinks(bestHostId, states));
+            assert(oldParentId == -1 || MolecularHierarchy::checkLinks(oldParentId, states));
+            TopologyEvents::getInstance().onBondFormed();
             return SUCCESS;
         }
 
@@ -155,6 +165,7 @@ public:
 
         int parentId = states[entityId].parentEntityId;
         int partnerId = states[entityId].cycleBondId;
+        TopologyEvents::getInstance().onBondBroken();
 
         if (parentId != -1) {
             states[parentId].childCount--;
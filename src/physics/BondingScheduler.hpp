@@ -0,0 +1,134 @@
+#ifndef BONDING_SCHEDULER_HPP
+#define BONDING_SCHEDULER_HPP
+
+#include <vector>
+#include <algorithm>
+#include "../core/Config.hpp"
+
+/**
+ * Aggregated scheduler counters (Phase 46).
+ * Used to compare bonding latency/throughput for different bucket counts (K).
+ */
+struct BondingSchedulerStats {
+    int bucketCount = 1;
+    long long ticks = 0;
+    long long atomsEvaluated = 0;
+    long long bondsFormed = 0;
+    long long structuresFormed = 0;
+    long long structureAttempts = 0;
+    long long structureAttemptsDeferred = 0;  // Rejected because the per-tick budget was spent
+
+    // Latency = ticks between an atom first seeing an in-range partner and actually bonding
+    long long latencySamples = 0;
+    long long latencyTicksTotal = 0;
+    int maxLatencyTicks = 0;
+
+    double bondsPerTick() const { return ticks > 0 ? (double)bondsFormed / ticks : 0.0; }
+    double atomsPerTick() const { return ticks > 0 ? (double)atomsEvaluated / ticks : 0.0; }
+    double meanLatencyTicks() const { return latencySamples > 0 ? (double)latencyTicksTotal / latencySamples : 0.0; }
+};
+
+/**
+ * BondingScheduler (Phase 46)
+ * Staggers the micro-bonding pass: atoms are split into K interleaved buckets
+ * (entityId % K) and only one bucket is evaluated per tick. Expensive structure
+ * detection attempts are capped per tick so dense soups keep a predictable cost.
+ * Every pair is still evaluated once every K ticks, but each evaluation rolls
+ * the same bond chance, so K > 1 stretches bonding latency (about 1.3 -> 2.1
+ * ticks at K=2). K = 1 matches the unscheduled pass exactly and is the default;
+ * staggering is opt-in through setBucketCount().
+ */
+class BondingScheduler {
+public:
+    explicit BondingScheduler(int bucketCount = Config::BONDING_THROTTLE_FRAMES,
+                              int structureBudget = Config::BONDING_STRUCTURE_BUDGET)
+        : structureBudget(structureBudget) {
+        setBucketCount(bucketCount);
+    }
+
+    // Advances to the next bucket and refills the structure budget
+    void beginTick(size_t entityCount) {
+        tick++;
+        activeBucket = (int)(tick % bucketCount);
+        structureAttemptsLeft = structureBudget;
+        if (contactSince.size() != entityCount) contactSince.resize(entityCount, -1);
+        stats.ticks++;
+    }
+
+    bool isScheduled(int entityId) const {
+        return bucketCount <= 1 || (entityId % bucketCount) == activeBucket;
+    }
+
+    void recordEvaluation() { stats.atomsEvaluated++; }
+
+    // Returns false (and counts a deferral) when this tick's budget is exhausted
+    bool consumeStructureAttempt() {
+        if (structureBudget > 0 && structureAttemptsLeft <= 0) {
+            stats.structureAttemptsDeferred++;
+            return false;
+        }
+        structureAttemptsLeft--;
+        stats.structureAttempts++;
+        return true;
+    }
+
+    // Atom had an in-range partner on this evaluation but no bond was made
+    void recordContact(int entityId) {
+        if (entityId < 0 || entityId >= (int)contactSince.size()) return;
+        if (contactSince[entityId] < 0) contactSince[entityId] = tick;
+    }
+
+    // Atom had no partner in range: restart its latency clock
+    void clearContact(int entityId) {
+        if (entityId < 0 || entityId >= (int)contactSince.size()) return;
+        contactSince[entityId] = -1;
+    }
+
+    void recordBond(int entityId) {
+        stats.bondsFormed++;
+        if (entityId < 0 || entityId >= (int)contactSince.size()) return;
+        int latency = (contactSince[entityId] < 0) ? 0 : (int)(tick - contactSince[entityId]);
+        stats.latencySamples++;
+        stats.latencyTicksTotal += latency;
+        stats.maxLatencyTicks = std::max(stats.maxLatencyTicks, latency);
+        contactSince[entityId] = -1;
+    }
+
+    void recordStructure() { stats.structuresFormed++; }
+
+    void setBucketCount(int k) {
+        bucketCount = std::max(1, k);
+        stats.bucketCount = bucketCount;
+    }
+    void setStructureBudget(int budget) { structureBudget = budget; }  // <= 0 disables the cap
+
+    int getBucketCount() const { return bucketCount; }
+    int getStructureBudget() const { return structureBudget; }
+    const BondingSchedulerStats& getStats() const { return stats; }
+
+    // Phase 51: Follow World::compact() (remap[old] = new index, -1 = removed)
+    void remapEntities(const std::vector<int>& remap) {
+        std::vector<long long> moved(contactSince.size(), -1);
+        for (size_t old = 0; old < remap.size() && old < contactSince.size(); old++) {
+            if (remap[old] >= 0) moved[remap[old]] = contactSince[old];
+        }
+        contactSince.swap(moved);
+    }
+
+    void resetStats() {
+        stats = BondingSchedulerStats{};
+        stats.bucketCount = bucketCount;
+        std::fill(contactSince.begin(), contactSince.end(), -1);
+    }
+
+private:
+    int bucketCount = 1;
+    int structureBudget = 0;
+    int structureAttemptsLeft = 0;
+    int activeBucket = 0;
+    long long tick = 0;
+    std::vector<long long> contactSince;  // Per-atom tick of first unresolved contact (-1 = none)
+    BondingSchedulerStats stats;
+};
+
+#endif // BONDING_SCHEDULER_HPP
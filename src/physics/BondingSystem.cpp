@@ -9,10 +9,12 @@
 #include "../chemistry/ChemistryDatabase.hpp"
 
 #include "../core/Config.hpp"
+#include "../core/AsyncLogger.hpp"
 #include "../core/MathUtils.hpp"
 #include "raylib.h"
 #include <cmath>
 #include <algorithm>
+#include <cassert>
 
 // --- Facade Implementation ---
 
@@ -50,8 +52,9 @@ void BondingSystem::updateSpontaneousBonding(std::vector<StateComponent>& states
                                              std::vector<TransformComponent>& transforms,
                                              const SpatialGrid& grid,
                                              EnvironmentManager* env,
-                                             int tractedEntityId) {
-    ::AutonomousBonding::updateSpontaneousBonding(states, atoms, transforms, grid, env, tractedEntityId);
+                                             int tractedEntityId,
+                                             BondingScheduler* scheduler) {
+    ::AutonomousBonding::updateSpontaneousBonding(states, atoms, transforms, grid, env, tractedEntityId, scheduler);
 }
 
 void BondingSystem::breakBond(int entityId, std::vector<StateComponent>& states, 
@@ -68,25 +71,26 @@ void BondingSystem::breakAllBonds(int entityId, std::vector<StateComponent>& sta
     // 1. Break cycle bond if exists - and clean up ALL ring members using centralized invalidation
     if (states[entityId].cycleBondId != -1 || states[entityId].isInRing) {
         int ringId = states[entityId].ringInstanceId;
-        TraceLog(LOG_INFO, "  - Breaking Ring %d", ringId);
+        SIM_LOG(LOG_DEBUG, "  - Breaking Ring %d", ringId);
         RingChemistry::invalidateRing(ringId, states);
     }
 
     // 2. Break connection with parent
     if (states[entityId].isClustered) {
-        TraceLog(LOG_INFO, "  - Breaking Parent Bond");
+        SIM_LOG(LOG_DEBUG, "  - Breaking Parent Bond");
         ::BondingCore::breakBond(entityId, states, atoms);
     }
 
     // 3. Break connections with children
+    // Phase 69: Walk the childList (O(degree)); breakBond edits it, so iterate a copy
     int breakCount = 0;
-    for (int i = 0; i < (int)states.size(); i++) {
-        if (states[i].parentEntityId == entityId) {
-            TraceLog(LOG_INFO, "  - Found Child: Atom %d", i);
-            ::BondingCore::breakBond(i, states, atoms);
-            breakCount++;
-        }
+    const std::vector<int> children = states[entityId].childList;
+    for (int childId : children) {
+        SIM_LOG(LOG_DEBUG, "  - Found Child: Atom %d", childId);
+        ::BondingCore::breakBond(childId, states, atoms);
+        breakCount++;
     }
+    assert(MolecularHierarchy::checkLinks(entityId, states));
 
     // 4. Phase 43 FIX: Fully isolate this atom (reset moleculeId to self)
     states[entityId].moleculeId = entityId;
@@ -9,6 +9,7 @@
 // Forward Declarations
 class EnvironmentManager;
 class SpatialGrid;
+class BondingScheduler;
 struct Element;
 
 /**
@@ -47,7 +48,8 @@ public:
                                          std::vector<TransformComponent>& transforms,
                                          const SpatialGrid& grid,
                                          EnvironmentManager* env = nullptr,
-                                         int tractedEntityId = -1);
+                                         int tractedEntityId = -1,
+                                         BondingScheduler* scheduler = nullptr);
 
     static void breakBond(int entityId, std::vector<StateComponent>& states, 
                           std::vector<AtomComponent>& atoms);
@@ -0,0 +1,98 @@
+#ifndef COMPOSITION_TRACKER_HPP
+#define COMPOSITION_TRACKER_HPP
+
+#include <vector>
+#include <cstdint>
+#include "../ecs/components.hpp"
+#include "../chemistry/CompositionKey.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "MolecularHierarchy.hpp"
+
+/**
+ * CompositionTracker (Phase 49)
+ * Per-molecule composition keyed by root entity and validated by the root's
+ * topologyVersion. A molecule is recounted (BFS over its own bonds, never a
+ * world scan) only after a bond event changed it; otherwise identification is
+ * a cached key plus one hashed ChemistryDatabase lookup.
+ */
+class CompositionTracker {
+public:
+    static CompositionTracker& getInstance() {
+        static CompositionTracker instance;
+        return instance;
+    }
+
+    const CompositionKey& getComposition(int entityId,
+                                         const std::vector<StateComponent>& states,
+                                         const std::vector<AtomComponent>& atoms) {
+        static const CompositionKey empty;
+        if (entityId < 0 || entityId >= (int)states.size()) return empty;
+
+        int root = states[entityId].moleculeId;
+        if (root < 0 || root >= (int)states.size()) root = entityId;
+        if (entries.size() < states.size()) entries.resize(states.size());
+
+        Entry& e = entries[root];
+        uint32_t version = states[root].topologyVersion;
+        if (!e.valid || version == 0 || e.version != version) {
+            recount(root, states, atoms, e.key);
+            e.version = version;
+            e.valid = true;
+            e.molecule = nullptr;
+            e.dbGeneration = -1;
+        }
+        return e.key;
+    }
+
+    const Molecule* identify(int entityId,
+                             const std::vector<StateComponent>& states,
+                             const std::vector<AtomComponent>& atoms) {
+        const CompositionKey& key = getComposition(entityId, states, atoms);
+        if (key.empty()) return nullptr;
+        int root = states[entityId].moleculeId;
+        if (root < 0 || root >= (int)states.size()) root = entityId;
+
+        // Re-resolve after ChemistryDatabase::reload() (old Molecule pointers are stale)
+        const ChemistryDatabase& db = ChemistryDatabase::getInstance();
+        Entry& e = entries[root];
+        if (e.dbGeneration != db.getGeneration()) {
+            e.molecule = db.findMoleculeByKey(key);
+            e.dbGeneration = db.getGeneration();
+        }
+        return e.molecule;
+    }
+
+    // Entity indices were remapped or the world was rebuilt
+    void clear() { entries.clear(); }
+
+private:
+    CompositionTracker() {}
+
+    struct Entry {
+        CompositionKey key;
+        uint32_t version = 0;
+        bool valid = false;
+        const Molecule* molecule = nullptr;
+        int dbGeneration = -1;
+    };
+
+    std::vector<Entry> entries;   // Indexed by root entity (other slots unused)
+    std::vector<int> counts;       // Scratch histogram by atomic number
+    std::vector<int> members;      // Scratch member list
+    MolecularHierarchy::VisitMarks visits;
+
+    // BFS across parent/children/cycle links: O(molecule size)
+    void recount(int root, const std::vector<StateComponent>& states,
+                 const std::vector<AtomComponent>& atoms, CompositionKey& out) {
+        std::fill(counts.begin(), counts.end(), 0);
+        MolecularHierarchy::collectMembers(root, states, members, visits);
+        for (int id : members) {
+            int z = atoms[id].atomicNumber;
+            if (z >= (int)counts.size()) counts.resize(z + 1, 0);
+            counts[z]++;
+        }
+        out = CompositionKey::fromCounts(counts);
+    }
+};
+
+#endif // COMPOSITION_TRACKER_HPP
@@ -2,8 +2,13 @@
 #define MOLECULAR_HIERARCHY_HPP
 
 #include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_set>
 #include "../ecs/components.hpp"
 #include "../core/MathUtils.hpp"
+#include "../ecs/HierarchyIndex.hpp"
+#include "TopologyEvents.hpp"
 
 /**
  * MolecularHierarchy (Phase 30)
@@ -21,50 +26,121 @@ public:
         if (seedEntityId < 0 || seedEntityId >= (int)states.size()) return;
 
         // 1. Find all members of the cluster
+        // Phase 69: BFS over the links (was a visited vector sized to the whole world)
         std::vector<int> members;
-        std::vector<bool> visited(states.size(), false);
-        std::vector<int> stack = { seedEntityId };
-        visited[seedEntityId] = true;
+        collectMembers(seedEntityId, states, members);
+        int minId = *std::min_element(members.begin(), members.end());
 
-        int minId = seedEntityId;
+        // 2. Apply the deterministic root ID (lowest index in cluster)
+        // and update isClustered flag based on cluster size (Phase 42 Fix)
+        bool hasConnections = (members.size() > 1);
+        for (int idx : members) {
+            states[idx].moleculeId = minId;
+            states[idx].isClustered = hasConnections;
+        }
 
-        size_t head = 0;
-        members.push_back(seedEntityId);
+        // 3. Topology changed: new version marks the whole cluster dirty (Phase 47)
+        TopologyEvents::getInstance().stampMembers(members, states);
 
-        while (head < members.size()) {
-            int curr = members[head++];
-            if (curr < minId) minId = curr;
+        // 4. Depth/ancestor table follows the new links and version (Phase 70)
+        HierarchyIndex::getInstance().index(members, states);
+    }
 
-            // a. Check Parent
-            int p = states[curr].parentEntityId;
-            if (p != -1 && !visited[p]) {
-                visited[p] = true;
-                members.push_back(p);
-            }
+    /**
+     * Generation-stamped visit marks for collectMembers: no O(N) clear per walk.
+     * Owned by a long-lived caller (census, trackers, streamer), never shared between worlds.
+     */
+    struct VisitMarks {
+        std::vector<uint32_t> stamp;
+        uint32_t generation = 0;
+    };
+
+    /**
+     * Collects every atom bonded (directly or transitively) to seedEntityId.
+     * Walks parent/children/cycle links only: O(molecule), no world scan (Phase 50).
+     */
+    static void collectMembers(int seedEntityId, const std::vector<StateComponent>& states,
+                               std::vector<int>& out, VisitMarks& marks) {
+        if (marks.stamp.size() < states.size()) marks.stamp.resize(states.size(), 0);
+        if (++marks.generation == 0) {
+            std::fill(marks.stamp.begin(), marks.stamp.end(), 0);
+            marks.generation = 1;
+        }
+        walkLinks(seedEntityId, states, out, [&](int id) {
+            if (marks.stamp[id] == marks.generation) return false;
+            marks.stamp[id] = marks.generation;
+            return true;
+        });
+    }
+
+    // Without caller-owned marks: the visited set is sized to the molecule, not the world
+    static void collectMembers(int seedEntityId, const std::vector<StateComponent>& states, std::vector<int>& out) {
+        std::unordered_set<int> seen;
+        walkLinks(seedEntityId, states, out, [&](int id) { return seen.insert(id).second; });
+    }
 
-            // b. Check Children using childList (Phase 43 optimization: O(k) instead of O(N))
-            for (int childId : states[curr].childList) {
-                if (!visited[childId]) {
-                    visited[childId] = true;
-                    members.push_back(childId);
-                }
+    /**
+     * Phase 69: Removes child from its parent's adjacency (childList, childCount, slot bit)
+     * and clears its parent link. O(parent degree). Ring and moleculeId cleanup is the caller's.
+     */
+    static void unlinkFromParent(int childId, std::vector<StateComponent>& states) {
+        if (childId < 0 || childId >= (int)states.size()) return;
+        int parentId = states[childId].parentEntityId;
+        if (parentId >= 0 && parentId < (int)states.size()) {
+            StateComponent& parent = states[parentId];
+            auto& list = parent.childList;
+            auto it = std::find(list.begin(), list.end(), childId);
+            if (it != list.end()) {
+                list.erase(it);
+                parent.childCount--;
             }
+            if (states[childId].parentSlotIndex >= 0) parent.occupiedSlots &= ~(1u << states[childId].parentSlotIndex);
+        }
+        states[childId].parentEntityId = -1;
+        states[childId].parentSlotIndex = -1;
+    }
 
-            // c. Check Cycle Bond
-            int c = states[curr].cycleBondId;
-            if (c != -1 && !visited[c]) {
-                visited[c] = true;
-                members.push_back(c);
+    /**
+     * Phase 69: Local adjacency check, O(degree): every listed child points back at
+     * entityId and entityId is listed by its parent. Logs and returns false on a mismatch.
+     */
+    static bool checkLinks(int entityId, const std::vector<StateComponent>& states) {
+        if (entityId < 0 || entityId >= (int)states.size()) return true;
+        const StateComponent& s = states[entityId];
+        for (int childId : s.childList) {
+            if (childId < 0 || childId >= (int)states.size() || states[childId].parentEntityId != entityId) {
+                TraceLog(LOG_ERROR, "[HIERARCHY] Atom %d lists child %d whose parent is %d", entityId, childId,
+                         (childId >= 0 && childId < (int)states.size()) ? states[childId].parentEntityId : -2);
+                return false;
+            }
+        }
+        int p = s.parentEntityId;
+        if (p != -1) {
+            const auto& siblings = (p >= 0 && p < (int)states.size()) ? states[p].childList : s.childList;
+            if (p < 0 || p >= (int)states.size() || std::find(siblings.begin(), siblings.end(), entityId) == siblings.end()) {
+                TraceLog(LOG_ERROR, "[HIERARCHY] Atom %d has parent %d that does not list it", entityId, p);
+                return false;
             }
         }
+        return true;
+    }
 
-        // 2. Apply the deterministic root ID (lowest index in cluster)
-        // and update isClustered flag based on cluster size (Phase 42 Fix)
-        bool hasConnections = (members.size() > 1);
-        for (int idx : members) {
-            states[idx].moleculeId = minId;
-            states[idx].isClustered = hasConnections;
+    /**
+     * Phase 69: Whole-world adjacency check, O(N + bonds): parentEntityId and childList
+     * must describe the same edges with no duplicates. For tests and debug tooling.
+     */
+    static bool verifyAdjacency(const std::vector<StateComponent>& states) {
+        size_t listed = 0, linked = 0;
+        for (int i = 0; i < (int)states.size(); i++) {
+            if (states[i].parentEntityId != -1) linked++;
+            listed += states[i].childList.size();
+            if (!checkLinks(i, states)) return false;
         }
+        if (listed != linked) {
+            TraceLog(LOG_ERROR, "[HIERARCHY] %zu child entries for %zu parent links (duplicates)", listed, linked);
+            return false;
+        }
+        return true;
     }
 
     // getChildren is now O(1) via states[parentId].childList (Phase 43)
@@ -73,6 +149,25 @@ public:
         if (parentId < 0 || parentId >= (int)states.size()) return empty;
         return states[parentId].childList;
     }
+
+private:
+    // BFS over parent/children/cycle links; firstVisit(id) marks id and returns false if already seen
+    template <typename FirstVisit>
+    static void walkLinks(int seedEntityId, const std::vector<StateComponent>& states,
+                          std::vector<int>& out, FirstVisit firstVisit) {
+        out.clear();
+        auto visit = [&](int id) {
+            if (id < 0 || id >= (int)states.size() || !firstVisit(id)) return;
+            out.push_back(id);
+        };
+        visit(seedEntityId);
+        for (size_t head = 0; head < out.size(); head++) {
+            int curr = out[head];
+            visit(states[curr].parentEntityId);
+            for (int childId : states[curr].childList) visit(childId);
+            visit(states[curr].cycleBondId);
+        }
+    }
 };
 
 #endif // MOLECULAR_HIERARCHY_HPP
@@ -0,0 +1,264 @@
+#include "MoleculeCensus.hpp"
+#include "MolecularHierarchy.hpp"
+#include "TopologyEvents.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+#include "../chemistry/CompositionKey.hpp"
+#include "../core/Config.hpp"
+#include "raylib.h"
+#include <algorithm>
+#include <fstream>
+
+namespace {
+    // propagateMoleculeId roots a molecule at its lowest index; -1 = never bonded
+    bool isRoot(int id, const std::vector<StateComponent>& states) {
+        const StateComponent& s = states[id];
+        if (!s.isAlive) return false;
+        return s.moleculeId == id || (s.moleculeId == -1 && s.parentEntityId == -1);
+    }
+}
+
+void MoleculeCensus::initialize(const std::vector<StateComponent>& states,
+                                const std::vector<AtomComponent>& atoms,
+                                const std::string& csv, const std::string& bin) {
+    csvPath = csv;
+    binPath = bin;
+    tick = 0;
+    columns.clear();
+
+    // Truncate previous runs: each session produces one file pair
+    std::ofstream(csvPath, std::ios::trunc);
+    std::ofstream(binPath, std::ios::binary | std::ios::trunc);
+
+    TopologyEvents& events = TopologyEvents::getInstance();
+    events.setRecordTouched(true);
+    lastBondsFormed = events.getBondsFormed();
+    lastBondsBroken = events.getBondsBroken();
+
+    active = true;
+    recountAll(states, atoms);
+    rebuildColumns();
+    TraceLog(LOG_INFO, "[CENSUS] Recording every %d ticks to %s / %s",
+             Config::CENSUS_SAMPLE_TICKS, csvPath.c_str(), binPath.c_str());
+}
+
+void MoleculeCensus::shutdown() {
+    if (!active) return;
+    flush();
+    TopologyEvents::getInstance().setRecordTouched(false);
+    active = false;
+}
+
+void MoleculeCensus::update(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms) {
+    if (!active) return;
+    tick++;
+
+    // Catalog reload: indices (and the column set) changed, one full recount
+    if (ChemistryDatabase::getInstance().getGeneration() != dbGeneration ||
+        StructureRegistry::getInstance().getGeneration() != registryGeneration) {
+        recountAll(states, atoms);
+        rebuildColumns();
+    } else {
+        TopologyEvents::getInstance().drainTouched(touched);
+
+        if (records.size() < states.size()) records.resize(states.size());
+        if (touchStamp.size() < states.size()) touchStamp.resize(states.size(), 0);
+        if (++touchGeneration == 0) {
+            std::fill(touchStamp.begin(), touchStamp.end(), 0);
+            touchGeneration = 1;
+        }
+
+        // Only molecules that an event changed: old contribution out, new one in
+        for (int id : touched) {
+            if (id < 0 || id >= (int)states.size() || touchStamp[id] == touchGeneration) continue;
+            touchStamp[id] = touchGeneration;
+            if (records[id].counted) {
+                apply(records[id], -1);
+                records[id] = RootRecord{};
+            }
+            if (isRoot(id, states)) countRoot(id, states, atoms);
+        }
+    }
+
+    if (tick % Config::CENSUS_SAMPLE_TICKS == 0) {
+        sample();
+        if (!columns.empty() && (int)columns[0].size() >= Config::CENSUS_FLUSH_SAMPLES) flush();
+    }
+}
+
+void MoleculeCensus::recountAll(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms) {
+    dbGeneration = ChemistryDatabase::getInstance().getGeneration();
+    registryGeneration = StructureRegistry::getInstance().getGeneration();
+
+    records.assign(states.size(), RootRecord{});
+    moleculeCounts.assign(ChemistryDatabase::getInstance().getAllMolecules().size(), 0);
+    structureCounts.assign(StructureRegistry::getInstance().getAllStructures().size(), 0);
+    otherRings = unknownMolecules = freeAtoms = ringsTotal = ladders = 0;
+
+    for (int i = 0; i < (int)states.size(); i++) {
+        if (isRoot(i, states)) countRoot(i, states, atoms);
+    }
+
+    // Pending touches are already reflected in the full count
+    TopologyEvents::getInstance().drainTouched(touched);
+}
+
+void MoleculeCensus::onEntitiesRemapped(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms) {
+    if (active) recountAll(states, atoms);  // Records are indexed by entity: rebuild them
+}
+
+void MoleculeCensus::apply(const RootRecord& r, int sign) {
+    if (r.freeAtom) {
+        freeAtoms += sign;
+        return;
+    }
+    if (r.moleculeIndex >= 0) moleculeCounts[r.moleculeIndex] += sign;
+    else unknownMolecules += sign;
+
+    ringsTotal += sign * r.rings;
+    if (r.rings >= 2) ladders += sign;
+    for (int s : r.structures) {
+        if (s >= 0) structureCounts[s] += sign;
+        else otherRings += sign;
+    }
+}
+
+void MoleculeCensus::countRoot(int root, const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms) {
+    RootRecord& r = records[root];
+    r = RootRecord{};
+    r.counted = true;
+
+    MolecularHierarchy::collectMembers(root, states, members, visits);
+    if (members.size() <= 1) {
+        r.freeAtom = true;
+        apply(r, +1);
+        return;
+    }
+
+    // Composition -> Molecule::id (one hashed lookup)
+    std::vector<int> counts;
+    ringMembers.clear();
+    for (int id : members) {
+        int z = atoms[id].atomicNumber;
+        if (z >= (int)counts.size()) counts.resize(z + 1, 0);
+        counts[z]++;
+        if (states[id].isInRing && states[id].ringInstanceId >= 0) ringMembers.push_back({states[id].ringInstanceId, id});
+    }
+    const ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    const Molecule* mol = db.findMoleculeByKey(CompositionKey::fromCounts(counts));
+    if (mol) r.moleculeIndex = (int)(mol - db.getAllMolecules().data());
+
+    // Rings: group members by instance, labels in ringIndex order -> structure name
+    if (!ringMembers.empty()) {
+        std::sort(ringMembers.begin(), ringMembers.end(), [&](const auto& a, const auto& b) {
+            if (a.first != b.first) return a.first < b.first;
+            return states[a.second].ringIndex < states[b.second].ringIndex;
+        });
+        const StructureRegistry& registry = StructureRegistry::getInstance();
+        std::vector<int> labels;
+        for (size_t i = 0; i < ringMembers.size();) {
+            size_t j = i;
+            labels.clear();
+            while (j < ringMembers.size() && ringMembers[j].first == ringMembers[i].first) {
+                labels.push_back(atoms[ringMembers[j].second].atomicNumber);
+                j++;
+            }
+            const StructureDefinition* def = registry.findRingMatch(labels);
+            r.structures.push_back(def ? (int)(def - registry.getAllStructures().data()) : -1);
+            r.rings++;
+            i = j;
+        }
+    }
+    apply(r, +1);
+}
+
+void MoleculeCensus::rebuildColumns() {
+    flush();  // Buffered rows belong to the previous column set
+
+    columnNames = { "tick", "bonds_formed", "bonds_broken", "free_atoms", "unknown_molecules", "rings", "ladders" };
+    for (const auto& m : ChemistryDatabase::getInstance().getAllMolecules()) columnNames.push_back("mol:" + m.id);
+    for (const auto& s : StructureRegistry::getInstance().getAllStructures()) columnNames.push_back("struct:" + s.name);
+    columnNames.push_back("struct:other");
+
+    columns.assign(columnNames.size(), {});
+    headerPending = true;
+}
+
+void MoleculeCensus::sample() {
+    TopologyEvents& events = TopologyEvents::getInstance();
+    long long formed = events.getBondsFormed();
+    long long broken = events.getBondsBroken();
+
+    size_t c = 0;
+    columns[c++].push_back((int32_t)tick);
+    columns[c++].push_back((int32_t)(formed - lastBondsFormed));
+    columns[c++].push_back((int32_t)(broken - lastBondsBroken));
+    columns[c++].push_back(freeAtoms);
+    columns[c++].push_back(unknownMolecules);
+    columns[c++].push_back(ringsTotal);
+    columns[c++].push_back(ladders);
+    for (int n : moleculeCounts) columns[c++].push_back(n);
+    for (int n : structureCounts) columns[c++].push_back(n);
+    columns[c++].push_back(otherRings);
+
+    lastBondsFormed = formed;
+    lastBondsBroken = broken;
+}
+
+void MoleculeCensus::flush() {
+    if (columns.empty() || columns[0].empty()) return;
+    uint32_t rows = (uint32_t)columns[0].size();
+
+    std::ofstream csv(csvPath, std::ios::app);
+    std::ofstream bin(binPath, std::ios::binary | std::ios::app);
+    if (!csv || !bin) {
+        TraceLog(LOG_WARNING, "[CENSUS] Cannot write %s / %s (dropping %u samples)", csvPath.c_str(), binPath.c_str(), rows);
+        for (auto& col : columns) col.clear();
+        return;
+    }
+
+    auto writeU32 = [&](uint32_t v) { bin.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
+
+    if (headerPending) {
+        for (size_t c = 0; c < columnNames.size(); c++) csv << (c ? "," : "") << columnNames[c];
+        csv << "\n";
+
+        bin.write("LSCN", 4);
+        writeU32((uint32_t)Config::CENSUS_FORMAT_VERSION);
+        writeU32((uint32_t)columnNames.size());
+        for (const auto& name : columnNames) {
+            uint16_t len = (uint16_t)name.size();
+            bin.write(reinterpret_cast<const char*>(&len), sizeof(len));
+            bin.write(name.data(), len);
+        }
+        headerPending = false;
+    }
+
+    for (uint32_t row = 0; row < rows; row++) {
+        for (size_t c = 0; c < columns.size(); c++) csv << (c ? "," : "") << columns[c][row];
+        csv << "\n";
+    }
+
+    // Column-major block: each series is contiguous for offline loaders
+    writeU32(rows);
+    for (auto& col : columns) {
+        bin.write(reinterpret_cast<const char*>(col.data()), col.size() * sizeof(int32_t));
+        col.clear();
+    }
+}
+
+int MoleculeCensus::getMoleculeCount(const std::string& moleculeId) const {
+    const auto& molecules = ChemistryDatabase::getInstance().getAllMolecules();
+    for (size_t i = 0; i < molecules.size() && i < moleculeCounts.size(); i++) {
+        if (molecules[i].id == moleculeId) return moleculeCounts[i];
+    }
+    return 0;
+}
+
+int MoleculeCensus::getStructureCount(const std::string& structureName) const {
+    const auto& structures = StructureRegistry::getInstance().getAllStructures();
+    for (size_t i = 0; i < structures.size() && i < structureCounts.size(); i++) {
+        if (structures[i].name == structureName) return structureCounts[i];
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+#ifndef MOLECULE_CENSUS_HPP
+#define MOLECULE_CENSUS_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "../ecs/components.hpp"
+#include "MolecularHierarchy.hpp"
+
+/**
+ * MoleculeCensus (Phase 50)
+ * Live population counts by Molecule::id and structure name, maintained
+ * incrementally: TopologyEvents reports which entities had their molecule
+ * changed, and only those molecules are subtracted/recounted each tick.
+ *
+ * Every Config::CENSUS_SAMPLE_TICKS the counters are sampled into in-memory
+ * columns; every Config::CENSUS_FLUSH_SAMPLES samples the columns are appended
+ * to a CSV file and to a columnar binary file:
+ *
+ *   segment := "LSCN" u32 version, u32 columnCount, columnCount x (u16 len, bytes)
+ *              followed by blocks of (u32 rowCount, columnCount x rowCount x i32)
+ *
+ * A new segment (and CSV header) starts when the molecule/structure catalogs
+ * are reloaded and the column set changes.
+ *
+ * Recounts walk the bond links (MolecularHierarchy::collectMembers), so they
+ * rely on every break unlinking both sides and re-propagating moleculeIds.
+ */
+class MoleculeCensus {
+public:
+    static MoleculeCensus& getInstance() {
+        static MoleculeCensus instance;
+        return instance;
+    }
+
+    // Starts recording; does one full count of the current world
+    void initialize(const std::vector<StateComponent>& states,
+                    const std::vector<AtomComponent>& atoms,
+                    const std::string& csvPath, const std::string& binPath);
+
+    // Call once per fixed physics tick
+    void update(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms);
+
+    // World::compact() moved entities (totals are unchanged, per-root records are not)
+    void onEntitiesRemapped(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms);
+
+    // Writes buffered samples to disk (also called automatically)
+    void flush();
+    void shutdown();
+
+    // Live counters
+    int getMoleculeCount(const std::string& moleculeId) const;
+    int getStructureCount(const std::string& structureName) const;
+    int getUnknownCount() const { return unknownMolecules; }
+    int getFreeAtomCount() const { return freeAtoms; }
+    int getRingCount() const { return ringsTotal; }
+    int getLadderCount() const { return ladders; }
+    long long getTick() const { return tick; }
+
+private:
+    MoleculeCensus() {}
+
+    // What one molecule root currently contributes to the counters
+    struct RootRecord {
+        bool counted = false;
+        bool freeAtom = false;
+        int moleculeIndex = -1;       // ChemistryDatabase molecules[] index, -1 = unknown
+        int rings = 0;
+        std::vector<int> structures;  // Per ring: StructureRegistry index, or -1 = unrecognised
+    };
+
+    bool active = false;
+    long long tick = 0;
+    int dbGeneration = -1;
+    int registryGeneration = -1;
+
+    std::vector<RootRecord> records;           // Indexed by root entity
+    std::vector<int> moleculeCounts;           // By molecules[] index
+    std::vector<int> structureCounts;          // By structures[] index
+    int otherRings = 0;
+    int unknownMolecules = 0;
+    int freeAtoms = 0;
+    int ringsTotal = 0;
+    int ladders = 0;
+
+    // Incremental update scratch
+    std::vector<int> touched;
+    std::vector<uint32_t> touchStamp;
+    uint32_t touchGeneration = 0;
+    std::vector<int> members;
+    MolecularHierarchy::VisitMarks visits;
+    std::vector<std::pair<int, int>> ringMembers;  // (ringInstanceId, member)
+
+    // Time series
+    long long lastBondsFormed = 0;
+    long long lastBondsBroken = 0;
+    std::vector<std::string> columnNames;
+    std::vector<std::vector<int32_t>> columns;
+    bool headerPending = true;
+    std::string csvPath;
+    std::string binPath;
+
+    void recountAll(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms);
+    void apply(const RootRecord& r, int sign);
+    void countRoot(int root, const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms);
+    void rebuildColumns();
+    void sample();
+};
+
+#endif // MOLECULE_CENSUS_HPP
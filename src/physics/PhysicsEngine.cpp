@@ -6,11 +6,16 @@
 #include "../chemistry/StructureDefinition.hpp"
 #include "../core/Config.hpp"
 #include "../core/MathUtils.hpp"
+#include "../core/AsyncLogger.hpp"
+#include "../core/MetricsRegistry.hpp"
 #include "RingChemistry.hpp"
+#include "MolecularHierarchy.hpp"
+#include "TopologyEvents.hpp"
 #include <cmath>
 #include <algorithm>
 #include <map>
 #include <set>
+#include <chrono>
 #include "../core/ErrorHandling.hpp"
 
 PhysicsEngine::PhysicsEngine() : grid(Config::GRID_CELL_SIZE) {}
@@ -42,6 +47,7 @@ void PhysicsEngine::validateRingIntegrity(std::vector<StateComponent>& states) {
                 states[i].ringSize = 0;
                 states[i].ringInstanceId = -1;
                 states[i].cycleBondId = -1;
+                TopologyEvents::getInstance().touch(i, states);
             }
         }
     }
@@ -154,8 +160,16 @@ void PhysicsEngine::applyBondSprings(float dt,
                 RingChemistry::invalidateRing(ringId, states);
             }
 
+            // Phase 69: Detach from the parent's childList/slots too (was left dangling)
+            MolecularHierarchy::unlinkFromParent(i, states);
             states[i].isClustered = false;
-            states[i].parentEntityId = -1;
+            TopologyEvents::getInstance().onBondBroken();
+            TopologyEvents::getInstance().touch(i, states);
+            TopologyEvents::getInstance().touch(parentId, states);
+            MetricsRegistry::getInstance().stressBreaks.inc();
+            // Both halves get their own moleculeId, as BondingCore::breakBond does
+            MolecularHierarchy::propagateMoleculeId(i, states);
+            MolecularHierarchy::propagateMoleculeId(parentId, states);
             
             TraceLog(LOG_WARNING, "[PHYSICS] BOND BROKEN by stress: Atom %d separated from %d", i, (int)parentId);
             continue;
@@ -225,7 +239,7 @@ void PhysicsEngine::applyBondSprings(float dt,
              if (states[parentId].moleculeId == 0) {
                  float strain = (dist - Config::BOND_IDEAL_DIST);
                  if (abs(strain) > 5.0f) {
-                     TraceLog(LOG_INFO, "[STRESS] Bond %d->%d (Slot %d) | Dist: %.1f / %.1f | Strain: %.1f", 
+                     SIM_LOG(LOG_DEBUG, "[STRESS] Bond %d->%d (Slot %d) | Dist: %.1f / %.1f | Strain: %.1f", 
                               parentId, i, slotIdx, dist, Config::BOND_IDEAL_DIST, strain);
                  }
              }
@@ -292,6 +306,7 @@ void PhysicsEngine::integrateMotion(float dt,
                                     std::vector<TransformComponent>& transforms,
                                     const std::vector<StateComponent>& states) {
     for (size_t idx = 0; idx < transforms.size(); idx++) {
+        if (!states[idx].isAlive) continue;  // Phase 51: Despawned slots stay parked
         TransformComponent& tr = transforms[idx];
         
         // Integration with thermodynamic jitter
@@ -329,6 +344,22 @@ void PhysicsEngine::integrateMotion(float dt,
     }
 }
 
+const char* PhysicsTimings::name(PhysicsPhase phase) {
+    switch (phase) {
+        case PhysicsPhase::ENVIRONMENT:     return "Environment";
+        case PhysicsPhase::RING_VALIDATION: return "Ring check";
+        case PhysicsPhase::COULOMB:         return "Coulomb";
+        case PhysicsPhase::BOND_SPRINGS:    return "Bond springs";
+        case PhysicsPhase::CYCLE_BONDS:     return "Cycle bonds";
+        case PhysicsPhase::RING_DYNAMICS:   return "Ring dynamics";
+        case PhysicsPhase::FOLDING:         return "Folding";
+        case PhysicsPhase::BONDING:         return "Bonding";
+        case PhysicsPhase::INTEGRATION:     return "Integration";
+        case PhysicsPhase::GRID:            return "Grid";
+        default:                            return "?";
+    }
+}
+
 // ============================================================================
 // MAIN STEP: Orchestrates all physics subsystems
 // ============================================================================
@@ -343,39 +374,55 @@ void PhysicsEngine::step(float dt, std::vector<TransformComponent>& transforms,
         return;
     }
     
-    static int diagCounter = 0;
-    
+    // Phase 67: Per-phase wall time for the performance overlay
+    auto phaseStart = std::chrono::steady_clock::now();
+    auto endPhase = [&](PhysicsPhase phase) {
+        auto now = std::chrono::steady_clock::now();
+        timings.ms[(int)phase] = std::chrono::duration<float, std::milli>(now - phaseStart).count();
+        phaseStart = now;
+    };
+
     // 0. Update environment
     environment.update(transforms, states, dt); 
+    endPhase(PhysicsPhase::ENVIRONMENT);
 
     // 0.6 Ring integrity validation
     validateRingIntegrity(states);
+    endPhase(PhysicsPhase::RING_VALIDATION);
 
     // 1. Electromagnetic forces (Coulomb)
     applyCoulombForces(dt, transforms, atoms, db);
+    endPhase(PhysicsPhase::COULOMB);
 
     // 2. Elastic bonds and molecular stress
     applyBondSprings(dt, transforms, atoms, states, db, diagCounter);
+    endPhase(PhysicsPhase::BOND_SPRINGS);
 
     // 3. Cycle bonds (non-hierarchical ring springs)
     applyCycleBonds(dt, transforms, atoms, states, db);
+    endPhase(PhysicsPhase::CYCLE_BONDS);
 
     // 4. Structural dynamics (rings & rigid groups)
-    StructuralPhysics::applyRingDynamics(dt, transforms, atoms, states);
+    StructuralPhysics::applyRingDynamics(dt, transforms, atoms, states, ringScratch);
+    endPhase(PhysicsPhase::RING_DYNAMICS);
 
     // 5. Folding & affinity (catalytic synthesis)
     StructuralPhysics::applyFoldingAndAffinity(dt, transforms, atoms, states, environment);
+    endPhase(PhysicsPhase::FOLDING);
 
     // 6. Spontaneous bonding (autonomous evolution)
-    BondingSystem::updateSpontaneousBonding(states, atoms, transforms, grid, &environment, tractedEntityId);
+    BondingSystem::updateSpontaneousBonding(states, atoms, transforms, grid, &environment, tractedEntityId, &bondingScheduler);
+    endPhase(PhysicsPhase::BONDING);
 
     // 7. Integration, friction, and boundaries
     integrateMotion(dt, transforms, states);
+    endPhase(PhysicsPhase::INTEGRATION);
 
     // 8. Update spatial grid
     diagCounter++;
     if (diagCounter > 120) diagCounter = 0;
-    grid.update(transforms);
+    grid.update(transforms, states);
+    endPhase(PhysicsPhase::GRID);
 
     // 9. Reset frame-local flags and update timers
     for (auto& s : states) {
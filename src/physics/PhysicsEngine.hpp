@@ -3,9 +3,38 @@
 
 #include "../ecs/components.hpp"
 #include "SpatialGrid.hpp"
+#include "BondingScheduler.hpp"
+#include "StructuralPhysics.hpp"
 #include "../world/EnvironmentManager.hpp"
 #include <vector>
 
+// Phase 67: The stages of PhysicsEngine::step(), in execution order
+enum class PhysicsPhase {
+    ENVIRONMENT = 0,
+    RING_VALIDATION,
+    COULOMB,
+    BOND_SPRINGS,
+    CYCLE_BONDS,
+    RING_DYNAMICS,
+    FOLDING,
+    BONDING,
+    INTEGRATION,
+    GRID,
+    COUNT
+};
+
+// Phase 67: Wall time of each phase during the last step()
+struct PhysicsTimings {
+    float ms[(int)PhysicsPhase::COUNT] = {};
+
+    float total() const {
+        float sum = 0.0f;
+        for (float v : ms) sum += v;
+        return sum;
+    }
+    static const char* name(PhysicsPhase phase);
+};
+
 /**
  * PHYSICS ENGINE
  * Orchestrates simulation subsystems: forces, bonding, collisions, and environment.
@@ -24,8 +53,28 @@ public:
     // Grid access for other systems (e.g., TractorBeam)
     const SpatialGrid& getGrid() const { return grid; }
 
+    // Re-bins positions that moved outside step() (replay seeks); the renderer culls through the grid
+    void refreshGrid(const std::vector<TransformComponent>& transforms, const std::vector<StateComponent>& states) {
+        grid.update(transforms, states);
+    }
+
     EnvironmentManager& getEnvironment() { return environment; }
 
+    // Phase 46: Staggered bonding (bucket count, structure budget, latency stats)
+    BondingScheduler& getBondingScheduler() { return bondingScheduler; }
+    const BondingScheduler& getBondingScheduler() const { return bondingScheduler; }
+
+    const PhysicsTimings& getTimings() const { return timings; }
+
+    // Phase 51: Per-entity state follows World::compact(); the grid is rebuilt so
+    // systems querying it before the next step() never see pre-compaction indices
+    void remapEntities(const std::vector<int>& remap,
+                       const std::vector<TransformComponent>& transforms,
+                       const std::vector<StateComponent>& states) {
+        bondingScheduler.remapEntities(remap);
+        grid.update(transforms, states);
+    }
+
 private:
     void resolveCollisions(std::vector<TransformComponent>& transforms);
     
@@ -56,6 +105,10 @@ private:
     
     SpatialGrid grid;
     EnvironmentManager environment;
+    BondingScheduler bondingScheduler;
+    int diagCounter = 0;  // Stress log cadence (Phase 55: was a function static)
+    StructuralPhysics::RingScratch ringScratch;  // Phase 55: was three function statics
+    PhysicsTimings timings;
 };
 
 #endif
@@ -2,7 +2,9 @@
 #define PRUNING_UTILS_HPP
 
 #include <vector>
+#include <cassert>
 #include "../ecs/components.hpp"
+#include "MolecularHierarchy.hpp"
 
 /**
  * PruningUtils (Phase 30)
@@ -16,42 +18,32 @@ class PruningUtils {
 public:
     /**
      * Finds the most recently added child of a parent atom.
+     * Phase 69: Reads the parent's childList (bond order) instead of scanning the world.
      * @param parentId The parent atom's entity ID
      * @param states State components vector
      * @return Entity ID of the last child, or -1 if none found
      */
     static int findLastChild(int parentId, const std::vector<StateComponent>& states) {
-        int lastChild = -1;
-        for (int i = 0; i < (int)states.size(); i++) {
-            if (states[i].parentEntityId == parentId) {
-                if (lastChild == -1 || i > lastChild) {
-                    lastChild = i;
-                }
-            }
-        }
-        return lastChild;
+        if (parentId < 0 || parentId >= (int)states.size()) return -1;
+        assert(MolecularHierarchy::checkLinks(parentId, states));
+        const auto& children = states[parentId].childList;
+        return children.empty() ? -1 : children.back();
     }
 
     /**
      * Finds a leaf node (atom with no children) attached to the parent.
      * Searches in reverse order to find the most recently added leaf first.
+     * Phase 69: O(degree) walk of childList; was an O(N^2) double scan.
      * @param parentId The parent atom's entity ID
      * @param states State components vector
      * @return Entity ID of a prunable leaf, or -1 if none found
      */
     static int findPrunableLeaf(int parentId, const std::vector<StateComponent>& states) {
-        for (int i = (int)states.size() - 1; i >= 0; i--) {
-            if (states[i].parentEntityId == parentId) {
-                // Check if this child has children
-                bool hasChildren = false;
-                for (int j = 0; j < (int)states.size(); j++) {
-                    if (states[j].parentEntityId == i) {
-                        hasChildren = true;
-                        break;
-                    }
-                }
-                if (!hasChildren) return i;
-            }
+        if (parentId < 0 || parentId >= (int)states.size()) return -1;
+        assert(MolecularHierarchy::checkLinks(parentId, states));
+        const auto& children = states[parentId].childList;
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            if (states[*it].childList.empty()) return *it;
         }
         return -1;
     }
@@ -9,6 +9,7 @@
 #include "../ecs/components.hpp"
 #include "../core/MathUtils.hpp"
 #include "../core/Config.hpp"
+#include "../core/MetricsRegistry.hpp"
 #include "../chemistry/StructureRegistry.hpp"
 #include "../chemistry/StructureDefinition.hpp"
 #include "MolecularHierarchy.hpp"
@@ -21,65 +22,41 @@
  */
 class RingChemistry {
 public:
-    static BondError tryCycleBond(int i, int j, 
-                                             std::vector<StateComponent>& states, 
-                                             std::vector<AtomComponent>& atoms, 
-                                             std::vector<TransformComponent>& transforms) {
+    /**
+     * The checks tryCycleBond makes, without side effects (Phase 48).
+     * Lets a multi-ring template verify every closure before forming any.
+     */
+    static BondError canCycleBond(int i, int j, const std::vector<StateComponent>& states) {
         if (i < 0 || j < 0 || i == j) return BondError::INTERNAL_ERROR;
-        
+
         // BUG FIX: Allow atoms in a ring to participate in NEW cycle bonds for ladder formation,
         // but they must not already have a cycle bond themselves.
         if (states[i].cycleBondId != -1 || states[j].cycleBondId != -1) return BondError::ALREADY_BONDED;
-        
-        // --- PATH TRACING (Cycle Validation) ---
-        std::vector<int> chainFromI;
-        int currI = i;
-        int safetyI = 0;
-        const int MAX_DEPTH = 100;
 
-        while (currI != -1 && safetyI < MAX_DEPTH) {
-            chainFromI.push_back(currI);
-            currI = states[currI].parentEntityId;
-            safetyI++;
-        }
-        if (safetyI >= MAX_DEPTH) {
-            TraceLog(LOG_ERROR, "[BOND] Infinite loop detected in hierarchy at atom %d", i);
-            return BondError::INTERNAL_ERROR;
-        }
+        // --- PATH TRACING (Cycle Validation) ---
+        // Phase 70: O(log d) LCA from the lifting table; no depth cap for long polymers
+        int distance = HierarchyIndex::getInstance().distance(i, j, states);
+        if (distance == -1) return BondError::INTERNAL_ERROR; // Different molecules? Should be filtered by caller.
 
-        std::vector<int> chainFromJ;
-        int currJ = j;
-        int safetyJ = 0;
-        while (currJ != -1 && safetyJ < MAX_DEPTH) {
-            chainFromJ.push_back(currJ);
-            currJ = states[currJ].parentEntityId;
-            safetyJ++;
-        }
+        // BUG FIX: Reject cycles smaller than 4 atoms (triangles are chemically unstable and shouldn't form membranes)
+        if (distance + 1 < 4) return BondError::RING_TOO_SMALL;
+        return BondError::SUCCESS;
+    }
 
-        // Find Least Common Ancestor (LCA)
-        int lca = -1;
-        int distI = -1, distJ = -1;
-        for (int idxI = 0; idxI < (int)chainFromI.size(); idxI++) {
-            for (int idxJ = 0; idxJ < (int)chainFromJ.size(); idxJ++) {
-                if (chainFromI[idxI] == chainFromJ[idxJ]) {
-                    lca = chainFromI[idxI];
-                    distI = idxI;
-                    distJ = idxJ;
-                    goto found_lca;
-                }
-            }
+    static BondError tryCycleBond(int i, int j, 
+                                             std::vector<StateComponent>& states, 
+                                             std::vector<AtomComponent>& atoms, 
+                                             std::vector<TransformComponent>& transforms) {
+        BondError check = canCycleBond(i, j, states);
+        if (check == BondError::RING_TOO_SMALL) {
+            TraceLog(LOG_WARNING, "[RING] Rejected cycle of size %d (minimum is 4 for stable ring)",
+                     HierarchyIndex::getInstance().distance(i, j, states) + 1);
         }
-        found_lca:
-
-        if (lca == -1) return BondError::INTERNAL_ERROR; // Different molecules? Should be filtered by caller.
+        if (check != BondError::SUCCESS) return check;
 
-        int ringSize = distI + distJ + 1;
-        
-        // BUG FIX: Reject cycles smaller than 4 atoms (triangles are chemically unstable and shouldn't form membranes)
-        if (ringSize < 4) {
-            TraceLog(LOG_WARNING, "[RING] Rejected cycle of size %d (minimum is 4 for stable ring)", ringSize);
-            return BondError::RING_TOO_SMALL;
-        }
+        HierarchyIndex& hierarchy = HierarchyIndex::getInstance();
+        int lca = hierarchy.lca(i, j, states);
+        int ringSize = hierarchy.distance(i, j, states) + 1;
         
         // PHYSICAL LINK
         states[i].cycleBondId = j;
@@ -87,29 +64,28 @@ public:
         
         // Synchronize cluster IDs
         MolecularHierarchy::propagateMoleculeId(i, states);
+        TopologyEvents::getInstance().onBondFormed();
+        MetricsRegistry::getInstance().ringsFormed.inc();
 
         // STRUCTURAL TAGGING
-        // FIX #3: Ring Instance ID Overflow Protection
-        static int nextRingId = 1;
-        static constexpr int MAX_RING_ID = 1000000;
-        
-        int ringId = nextRingId++;
-        if (nextRingId >= MAX_RING_ID) {
-            nextRingId = 1; // Wrap around safely
-        }
+        // FIX #3: Ring Instance ID Overflow Protection (wraps inside SimulationState)
+        int ringId = SimulationState::getInstance().allocateRingId();
         
         // BUG FIX: Build ringMembers in CORRECT ORDER (chain from I to J via LCA)
         // This ensures positions are assigned sequentially around the ring
         std::vector<int> ringMembers;
         
         // Path I -> LCA (in order from I going up)
-        for (int k = 0; k <= distI; k++) {
-            ringMembers.push_back(chainFromI[k]);
+        for (int curr = i; curr != lca; curr = states[curr].parentEntityId) {
+            ringMembers.push_back(curr);
         }
+        ringMembers.push_back(lca);
         // Path LCA -> J (in reverse order, excluding LCA which is already added)
-        for (int k = distJ - 1; k >= 0; k--) {
-            ringMembers.push_back(chainFromJ[k]);
+        size_t lcaPos = ringMembers.size();
+        for (int curr = j; curr != lca; curr = states[curr].parentEntityId) {
+            ringMembers.push_back(curr);
         }
+        std::reverse(ringMembers.begin() + lcaPos, ringMembers.end());
 
         // Check if any atom was ALREADY in a VALID ring (for fusion detection)
         // Only count as "was in ring" if they have a different ringInstanceId AND a valid cycleBond
@@ -158,9 +134,10 @@ public:
         // --- VISUAL FORMATION (Generalized Polygon Hard-Snap) ---
         // Only trigger hard-snap if these atoms were NOT in another ring already
         if (ringSize >= 4 && ringSize <= 8 && !anyWasInRing) {
-            // Look up structure definition for this polygon size
-            const StructureDefinition* def = StructureRegistry::getInstance()
-                .findMatch(ringSize, atoms[ringMembers[0]].atomicNumber);
+            // Look up structure definition by the ring's element sequence (Phase 48)
+            std::vector<int> ringLabels;
+            for (int atomId : ringMembers) ringLabels.push_back(atoms[atomId].atomicNumber);
+            const StructureDefinition* def = StructureRegistry::getInstance().findRingMatch(ringLabels);
             
             if (def) {
                 // Use already-calculated centroid (cx, cy) from angular sorting above
@@ -169,14 +146,18 @@ public:
                 float angleStep = (2.0f * 3.1415926535f) / ringSize;
                 float radius = Config::BOND_IDEAL_DIST / (2.0f * std::sin(3.1415926535f / ringSize));
                 
-                std::vector<Vector2> offsets;
-                for (int i = 0; i < ringSize; i++) {
-                    float currentAngle = fixedAngle + i * angleStep;
-                    offsets.push_back({
-                        std::cos(currentAngle) * radius,
-                        std::sin(currentAngle) * radius
-                    });
+                // Phase 64: The registry caches them per definition (same formula)
+                std::vector<Vector2> fallback;
+                if ((int)def->idealOffsets.size() != ringSize) {
+                    for (int i = 0; i < ringSize; i++) {
+                        float currentAngle = fixedAngle + i * angleStep;
+                        fallback.push_back({
+                            std::cos(currentAngle) * radius,
+                            std::sin(currentAngle) * radius
+                        });
+                    }
                 }
+                const std::vector<Vector2>& offsets = fallback.empty() ? def->idealOffsets : fallback;
                 
                 // Hard snap ONLY if instantFormation is enabled
                 if (def->instantFormation) {
@@ -282,6 +263,7 @@ public:
                         states[partner].cycleBondId = -1;
                     }
                     states[i].cycleBondId = -1;
+                    TopologyEvents::getInstance().touch((int)i, states);
                     
                     found = true;
                 }
@@ -289,6 +271,7 @@ public:
         }
         
         if (found) {
+            MetricsRegistry::getInstance().ringsInvalidated.inc();
             TraceLog(LOG_INFO, "[RING] Invalidated entire ring instance metadata: %d", ringId);
         }
     }
@@ -313,6 +296,7 @@ public:
         states[atomId].ringIndex = -1;
         states[atomId].cycleBondId = -1;
         states[atomId].dockingProgress = 1.0f;
+        TopologyEvents::getInstance().touch(atomId, states);
     }
 };
 
@@ -1,10 +1,16 @@
 #include "SpatialGrid.hpp"
 #include <cmath>
 #include "../core/ErrorHandling.hpp"
+#include "../core/MetricsRegistry.hpp"
 
 SpatialGrid::SpatialGrid(float size) : cellSize(size) {}
 
 void SpatialGrid::update(const std::vector<TransformComponent>& transforms) {
+    static const std::vector<StateComponent> noStates;
+    update(transforms, noStates);
+}
+
+void SpatialGrid::update(const std::vector<TransformComponent>& transforms, const std::vector<StateComponent>& states) {
     if (transforms.empty()) {
         ErrorHandler::handle(ErrorSeverity::WARNING, "SpatialGrid::update received empty transforms");
         return;
@@ -16,17 +22,32 @@ void SpatialGrid::update(const std::vector<TransformComponent>& transforms) {
     }
 
     // Periodic map reset to prevent stale bucket bloat
-    static int frameCounter = 0;
-    if (++frameCounter > 300) { // Every ~5 seconds
+    if (++updatesSinceReset > 300) { // Every ~5 seconds
         cells.clear();
-        frameCounter = 0;
+        updatesSinceReset = 0;
     }
 
+    bool checkAlive = states.size() == transforms.size();
     for (int i = 0; i < (int)transforms.size(); i++) {
+        if (checkAlive && !states[i].isAlive) continue;
         int cx = (int)std::floor(transforms[i].x / cellSize);
         int cy = (int)std::floor(transforms[i].y / cellSize);
         cells[getHash(cx, cy)].entityIndices.push_back(i);
     }
+
+    // Phase 66: Occupancy distribution, accumulated locally and merged once per update
+    if constexpr (Config::METRICS_ENABLED) {
+        MetricsRegistry& metrics = MetricsRegistry::getInstance();
+        HistogramShard occupancy(metrics.cellOccupancy);
+        int occupied = 0;
+        for (auto const& [hash, cell] : cells) {
+            if (cell.entityIndices.empty()) continue;
+            occupancy.observe((double)cell.entityIndices.size());
+            occupied++;
+        }
+        occupancy.merge(metrics.cellOccupancy);
+        metrics.occupiedCells.set((double)occupied);
+    }
 }
 
 std::vector<int> SpatialGrid::getNearby(Vector2 pos, float radius) const {
@@ -45,9 +66,49 @@ std::vector<int> SpatialGrid::getNearby(Vector2 pos, float radius) const {
             }
         }
     }
+    MetricsRegistry::getInstance().neighboursPerQuery.observe((double)nearby.size());
     return nearby;
 }
 
+template <typename Fn>
+void SpatialGrid::forEachCellIn(Rectangle rect, Fn&& fn) const {
+    int minX = (int)std::floor(rect.x / cellSize);
+    int maxX = (int)std::floor((rect.x + rect.width) / cellSize);
+    int minY = (int)std::floor(rect.y / cellSize);
+    int maxY = (int)std::floor((rect.y + rect.height) / cellSize);
+
+    // Zoomed far out the rectangle spans more cells than exist: walk the occupied ones instead
+    long long spanned = (long long)(maxX - minX + 1) * (long long)(maxY - minY + 1);
+    if (spanned > (long long)cells.size()) {
+        for (auto const& [hash, cell] : cells) {
+            int cx = (int)(hash >> 32);
+            int cy = (int)(hash & 0xFFFFFFFF);
+            if (cx < minX || cx > maxX || cy < minY || cy > maxY) continue;
+            fn(cx, cy, cell);
+        }
+        return;
+    }
+
+    for (int x = minX; x <= maxX; x++) {
+        for (int y = minY; y <= maxY; y++) {
+            auto it = cells.find(getHash(x, y));
+            if (it != cells.end()) fn(x, y, it->second);
+        }
+    }
+}
+
+void SpatialGrid::queryRect(Rectangle rect, std::vector<int>& out) const {
+    forEachCellIn(rect, [&](int, int, const Cell& cell) {
+        out.insert(out.end(), cell.entityIndices.begin(), cell.entityIndices.end());
+    });
+}
+
+void SpatialGrid::queryCellCounts(Rectangle rect, std::vector<GridCellCount>& out) const {
+    forEachCellIn(rect, [&](int cx, int cy, const Cell& cell) {
+        if (!cell.entityIndices.empty()) out.push_back({ cx, cy, (int)cell.entityIndices.size() });
+    });
+}
+
 void SpatialGrid::debugDraw() const {
     // Visualizes active grid cells for debugging
     for (auto const& [hash, cell] : cells) {
@@ -6,6 +6,13 @@
 #include <vector>
 #include <unordered_map>
 
+// Phase 60: Occupancy of one grid cell (density overview)
+struct GridCellCount {
+    int cx;
+    int cy;
+    int count;
+};
+
 /**
  * SPATIAL GRID (Grid Hash)
  * Divide el espacio en celdas para que las búsquedas sean O(1) en promedio.
@@ -18,9 +25,22 @@ public:
     // Limpia la grilla y re-inserta todas las entidades
     void update(const std::vector<TransformComponent>& transforms);
 
+    // Phase 51: Same, but leaves out despawned entities
+    void update(const std::vector<TransformComponent>& transforms, const std::vector<StateComponent>& states);
+
     // Get entities in neighboring cells to a position
     std::vector<int> getNearby(Vector2 pos, float radius) const;
 
+    // Phase 58: Entities in cells overlapping a world rectangle (camera culling).
+    // Appends to `out`; cells are visited in no particular order.
+    void queryRect(Rectangle rect, std::vector<int>& out) const;
+
+    // Phase 60: Occupied cells overlapping a world rectangle with their entity counts.
+    // Costs O(cells), independent of how many atoms each cell holds.
+    void queryCellCounts(Rectangle rect, std::vector<GridCellCount>& out) const;
+
+    float getCellSize() const { return cellSize; }
+
     // Helper for visual debugging
     void debugDraw() const;
 
@@ -38,6 +58,11 @@ private:
 
     // Almacenamiento de celdas
     std::unordered_map<long long, Cell> cells;
+    int updatesSinceReset = 0;  // Phase 55: per-grid (was a function static shared by every grid)
+
+    // Calls fn(cx, cy, cell) for every occupied cell overlapping rect
+    template <typename Fn>
+    void forEachCellIn(Rectangle rect, Fn&& fn) const;
 };
 
 #endif
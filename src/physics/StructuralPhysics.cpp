@@ -3,22 +3,57 @@
 #include "../chemistry/StructureDefinition.hpp"
 #include "../core/Config.hpp"
 #include "../core/MathUtils.hpp"
+#include "../core/AsyncLogger.hpp"
+#include "../core/MetricsRegistry.hpp"
+#include "StructureTracker.hpp"
 #include "../world/EnvironmentManager.hpp"
 #include <unordered_map>
+#include <algorithm>
 #include <map>
 #include <cmath>
 
 namespace StructuralPhysics {
 
+// Ring tagging and every bond edit restamp the molecule root, so a cached match
+// stays valid until the root's version or the definition set changes
+static const StructureDefinition* matchRing(int ringId, const std::vector<int>& subIndices,
+                                            const std::vector<AtomComponent>& atoms,
+                                            const std::vector<StateComponent>& states,
+                                            RingScratch& scratch) {
+    const StructureRegistry& registry = StructureRegistry::getInstance();
+    int root = states[subIndices[0]].moleculeId;
+    uint32_t version = (root >= 0 && root < (int)states.size()) ? states[root].topologyVersion : 0;
+
+    RingScratch::RingMatch& entry = scratch.ringMatches[ringId];
+    entry.lastPass = scratch.pass;
+    if (version != 0 && entry.root == root && entry.version == version &&
+        entry.generation == registry.getGeneration()) return entry.def;
+
+    // Element sequence in ringIndex (angular) order for the canonical ring lookup (Phase 48)
+    std::vector<int>& ringLabels = scratch.ringLabels;
+    ringLabels.assign(subIndices.size(), 0);
+    for (int idx : subIndices) {
+        int slot = states[idx].ringIndex;
+        if (slot >= 0 && slot < (int)ringLabels.size()) ringLabels[slot] = atoms[idx].atomicNumber;
+    }
+    entry.def = registry.findRingMatch(ringLabels);
+    entry.root = root;
+    entry.version = version;
+    entry.generation = registry.getGeneration();
+    return entry.def;
+}
+
 void applyRingDynamics(float dt, 
                       std::vector<TransformComponent>& transforms,
                       const std::vector<AtomComponent>& atoms,
-                      std::vector<StateComponent>& states) {
+                      std::vector<StateComponent>& states,
+                      RingScratch& scratch) {
     
     // Phase 28: Small optimization, stack.reserve
-    static std::vector<int> stack;
+    std::vector<int>& stack = scratch.stack;
     stack.clear();
     stack.reserve(64);
+    scratch.pass++;
 
     std::vector<bool> processed(transforms.size(), false);
     for (int i = 0; i < (int)transforms.size(); i++) {
@@ -62,7 +97,7 @@ void applyRingDynamics(float dt,
 
         // 3. Sub-grouping for specific Ring logic (using ringInstanceId)
         // FIX #15: Remove std::map allocation from hot path
-        static std::unordered_map<int, std::vector<int>> subRings;
+        std::unordered_map<int, std::vector<int>>& subRings = scratch.subRings;
         subRings.clear(); // Reset without deallocating capacity
         // subRings.reserve(8); // Already reserved from previous runs typically
 
@@ -72,10 +107,14 @@ void applyRingDynamics(float dt,
             }
         }
 
-        // 4. Process each sub-ring independently
-        for (auto const& [rId, subIndices] : subRings) {
-            int sampleIdx = subIndices[0];
-            const StructureDefinition* def = StructureRegistry::getInstance().findMatch(states[sampleIdx].ringSize, atoms[sampleIdx].atomicNumber);
+        // 4. Process each sub-ring independently, in ring id order (Phase 55: hash order is not portable)
+        std::vector<int>& ringOrder = scratch.ringOrder;
+        ringOrder.clear();
+        for (auto const& entry : subRings) ringOrder.push_back(entry.first);
+        std::sort(ringOrder.begin(), ringOrder.end());
+        for (int rId : ringOrder) {
+            const std::vector<int>& subIndices = subRings[rId];
+            const StructureDefinition* def = matchRing(rId, subIndices, atoms, states, scratch);
             if (!def) continue;
 
             // FIX: Skip rings that are fully formed (all dockingProgress == 1.0)
@@ -99,7 +138,6 @@ void applyRingDynamics(float dt,
 
             float internalDamping = def->damping;
             float globalDriftDamping = def->globalDamping;
-            std::vector<Vector2> offsets = def->getIdealOffsets(Config::BOND_IDEAL_DIST);
 
             // Sub-ring centroid
             float scx = 0, scy = 0;
@@ -143,7 +181,7 @@ void applyRingDynamics(float dt,
                         float dx = states[idx].targetX - transforms[idx].x;
                         float dy = states[idx].targetY - transforms[idx].y;
                         float gap = std::sqrt(dx*dx + dy*dy);
-                        TraceLog(LOG_INFO, "[SNAP] Atom %d: (%.1f,%.1f) -> target(%.1f,%.1f) gap=%.1fpx",
+                        SIM_LOG(LOG_DEBUG, "[SNAP] Atom %d: (%.1f,%.1f) -> target(%.1f,%.1f) gap=%.1fpx",
                                  idx, transforms[idx].x, transforms[idx].y,
                                  states[idx].targetX, states[idx].targetY, gap);
                     }
@@ -161,12 +199,9 @@ void applyRingDynamics(float dt,
                     TraceLog(LOG_INFO, "[SNAP] Snap completed - all atoms at targets");
                     
                     // Phase 45: Freeze structure into super-atom (rigid body mode)
-                    static int nextStructureId = 1;
-                    int newStructureId = nextStructureId++;
-                    for (int idx : subIndices) {
-                        states[idx].structureId = newStructureId;
-                        states[idx].isFrozen = true;
-                    }
+                    // Phase 68: StructureTracker assigns the id and indexes the members
+                    int newStructureId = StructureTracker::getInstance().create(subIndices, states, atoms);
+                    MetricsRegistry::getInstance().structuresFrozen.inc();
                     TraceLog(LOG_INFO, "[STRUCTURE] Frozen ring as structureId=%d with %d atoms", 
                              newStructureId, (int)subIndices.size());
                 }
@@ -221,6 +256,12 @@ void applyRingDynamics(float dt,
             }
         }
     }
+
+    // Drop matches of rings that no longer exist
+    for (auto it = scratch.ringMatches.begin(); it != scratch.ringMatches.end();) {
+        if (it->second.lastPass != scratch.pass) it = scratch.ringMatches.erase(it);
+        else ++it;
+    }
 }
 
 void applyFoldingAndAffinity(float dt,
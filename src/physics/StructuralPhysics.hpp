@@ -4,9 +4,12 @@
 #include "../ecs/components.hpp"
 #include "raylib.h"
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 // Forward declaration back to global scope
 class EnvironmentManager;
+struct StructureDefinition;
 
 /**
  * Specialized system for structural dynamics, including:
@@ -16,13 +19,37 @@ class EnvironmentManager;
  */
 namespace StructuralPhysics {
 
+    /**
+     * Phase 55: Reusable buffers for applyRingDynamics, owned by the caller
+     * (one per PhysicsEngine) so separate worlds never share them.
+     */
+    struct RingScratch {
+        std::vector<int> stack;
+        std::unordered_map<int, std::vector<int>> subRings;  // ringInstanceId -> atoms
+        std::vector<int> ringOrder;
+        std::vector<int> ringLabels;
+
+        // Matched definition per ringInstanceId, valid while the molecule root's
+        // topologyVersion and the registry generation are unchanged
+        struct RingMatch {
+            const StructureDefinition* def = nullptr;
+            int root = -1;
+            uint32_t version = 0;
+            int generation = -1;
+            uint32_t lastPass = 0;
+        };
+        std::unordered_map<int, RingMatch> ringMatches;
+        uint32_t pass = 0;
+    };
+
     /**
      * Applies rigid-body dynamics and formation logic to atoms in rings.
      */
     void applyRingDynamics(float dt, 
                           std::vector<TransformComponent>& transforms,
                           const std::vector<AtomComponent>& atoms,
-                          std::vector<StateComponent>& states);
+                          std::vector<StateComponent>& states,
+                          RingScratch& scratch);
 
     /**
      * Applies folding forces to terminals and carbon affinity pulls.
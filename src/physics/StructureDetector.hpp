@@ -5,43 +5,105 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <cassert>
 #include "../ecs/components.hpp"
 #include "../chemistry/StructureRegistry.hpp"
 #include "../core/Config.hpp"
 #include "../core/MathUtils.hpp"
 #include "RingChemistry.hpp"
+#include "MolecularHierarchy.hpp"
+#include "StructureMatcher.hpp"
 
 /**
  * StructureDetector (Phase 41)
  * Detects when organic bonds can form a known structure,
  * then reorganizes hierarchy and closes the ring.
+ *
+ * Phase 47: Event-driven. A molecule that was rejected is remembered by its
+ * root's topologyVersion and not re-examined until a bond event changes it.
+ *
+ * Phase 48: Structures are labelled graphs. Templates are first matched
+ * around the atom that triggered detection (cost ~ template size); a full
+ * pass anchored on the template's rarest label runs once per topology version.
+ * Legacy uniform rings keep the angle-sort reorganization as a fallback.
  */
 class StructureDetector {
 public:
 
     /**
      * Try to form any valid structure from the molecule rooted at rootId.
+     * seedId (optional) is the atom whose contact triggered detection.
      * Returns true if a structure was formed.
      */
     static bool tryFormStructure(int rootId,
                                   std::vector<StateComponent>& states,
                                   std::vector<AtomComponent>& atoms,
-                                  std::vector<TransformComponent>& transforms) {
+                                  std::vector<TransformComponent>& transforms,
+                                  int seedId = -1) {
         
-        // 1. Get all atoms in this molecule (Cluster-aware)
+        // 0. Topology unchanged since the last rejection: nothing new to find (Phase 47)
+        // A new definition set can match molecules rejected before, so a rejection only
+        // counts against the registry generation it was made with (stored on the root)
+        const auto& registry = StructureRegistry::getInstance();
+        const int generation = registry.getGeneration();
+
         int molRootId = states[rootId].moleculeId;
-        std::vector<int> members = MathUtils::getMoleculeMembers(molRootId != -1 ? molRootId : rootId, states);
-        if (members.size() < 4) return false;  // Minimum for any ring
+        int cacheId = (molRootId >= 0 && molRootId < (int)states.size()) ? molRootId : rootId;
+        uint32_t version = states[cacheId].topologyVersion;
+        if (version != 0 && states[cacheId].structureCheckedVersion == version &&
+            states[cacheId].structureCheckedGeneration == generation) return false;
+        auto rememberRejection = [&]() {
+            states[cacheId].structureCheckedVersion = version;
+            states[cacheId].structureCheckedGeneration = generation;
+        };
+
+        // Shielded candidates are a transient block (tractor beam), so that result is not cached
+        bool transientReject = false;
+        StructureMatcher::Match match;
+
+        // 1. Local match around the seed atom (Phase 48)
+        if (seedId >= 0 && seedId < (int)states.size()) {
+            for (const auto& def : registry.getAllStructures()) {
+                auto r = StructureMatcher::matchAnchored(def.graph, seedId, states, atoms, match);
+                if (r == StructureMatcher::Result::BLOCKED) transientReject = true;
+                if (r == StructureMatcher::Result::MATCHED && closeMatch(def, match, states, atoms, transforms)) {
+                    return true;
+                }
+            }
+        }
+
+        // 2. Get all atoms in this molecule: link walk, O(molecule) instead of a world scan.
+        // Sorted so candidate order matches the old index-ordered scan.
+        std::vector<int> members;
+        MolecularHierarchy::collectMembers(cacheId, states, members);
+        std::sort(members.begin(), members.end());
+        if (members.size() < 4) {  // Minimum for any ring
+            if (!transientReject) rememberRejection();
+            return false;
+        }
+
+        // 3. Full graph pass: only atoms carrying the template's anchor label are tried
+        for (const auto& def : registry.getAllStructures()) {
+            const StructureTemplate& g = def.graph;
+            if (!g.valid || g.size() > (int)members.size()) continue;
+            for (int id : members) {
+                if (id == seedId || !StructureTemplate::labelMatches(g.labels[g.anchor], atoms[id].atomicNumber)) continue;
+                auto r = StructureMatcher::matchFrom(g, g.anchor, id, states, atoms, match);
+                if (r == StructureMatcher::Result::BLOCKED) transientReject = true;
+                if (r == StructureMatcher::Result::MATCHED && closeMatch(def, match, states, atoms, transforms)) {
+                    return true;
+                }
+            }
+        }
         
-        // 2. Group by atomic number
+        // 4. Legacy reorganization: group by atomic number
         std::map<int, std::vector<int>> byElement;
         for (int id : members) {
             byElement[atoms[id].atomicNumber].push_back(id);
         }
         
-        // 3. Check each structure definition
-        const auto& registry = StructureRegistry::getInstance();
         for (const auto& def : registry.getAllStructures()) {
+            if (!def.graph.reorganize) continue;
             auto it = byElement.find(def.atomicNumber);
             if (it == byElement.end()) continue;
             
@@ -53,19 +115,56 @@ public:
                 // We have enough atoms of this type!
                 std::vector<int> candidates = it->second;
                 
-                // 4. Check if they're all terminal (can form ring)
+                // Check if they're all terminal (can form ring)
                 if (canFormRing(candidates, states, def.atomCount)) {
-                    // 5. Reorganize and close
+                    // Reorganize and close
                     if (reorganizeAndClose(candidates, states, atoms, transforms, def)) {
                         return true;
                     }
+                    transientReject = true;  // Closure failed on geometry; hierarchy was re-stamped
+                } else {
+                    for (int id : candidates) {
+                        if (states[id].isShielded) { transientReject = true; break; }
+                    }
                 }
             }
         }
         
+        if (!transientReject) rememberRejection();
         return false;
     }
 
+    /**
+     * Forms the closure bonds of a matched template (Phase 48).
+     * Each closure becomes a cycle bond; RingChemistry tags and animates the resulting rings.
+     * All closures are checked first, so a multi-ring template is never left half-closed.
+     */
+    static bool closeMatch(const StructureDefinition& def, const StructureMatcher::Match& match,
+                           std::vector<StateComponent>& states,
+                           std::vector<AtomComponent>& atoms,
+                           std::vector<TransformComponent>& transforms) {
+        if (!match.variant || match.variant->closureEdges.empty()) return false;  // Nothing left to form
+        const auto& closures = match.variant->closureEdges;
+        const auto& mapping = match.mapping;
+
+        for (const auto& e : closures) {
+            if (RingChemistry::canCycleBond(mapping[e.first], mapping[e.second], states) != BondError::SUCCESS) return false;
+        }
+
+        // Closure endpoints are disjoint and cycle bonds leave the tree alone, so none can fail now
+        int formed = 0;
+        for (const auto& e : closures) {
+            if (RingChemistry::tryCycleBond(mapping[e.first], mapping[e.second], states, atoms, transforms) == BondError::SUCCESS) {
+                formed++;
+            }
+        }
+        assert(formed == (int)closures.size());
+
+        TraceLog(LOG_INFO, "[STRUCTURE] Formed %s from %d atoms via graph match (%d closures)",
+                 def.name.c_str(), (int)def.graph.size(), formed);
+        return true;
+    }
+
     /**
      * Check if N atoms can form a ring (no existing cycle bonds, enough are connected)
      */
@@ -129,6 +228,8 @@ public:
                 if (parentInSet) {
                     int parentId = states[id].parentEntityId;
                     states[parentId].childCount--;
+                    auto& siblings = states[parentId].childList;  // Keep childList in sync (matcher walks it)
+                    siblings.erase(std::remove(siblings.begin(), siblings.end(), id), siblings.end());
                     states[id].parentEntityId = -1;
                     states[id].isClustered = false;
                 }
@@ -139,15 +240,26 @@ public:
         for (int i = 1; i < n; i++) {
             int child = candidates[i];
             int parent = candidates[i - 1];
+
+            int oldParent = states[child].parentEntityId;  // Parent outside the set is replaced
+            if (oldParent != -1) {
+                states[oldParent].childCount--;
+                auto& oldList = states[oldParent].childList;
+                oldList.erase(std::remove(oldList.begin(), oldList.end(), child), oldList.end());
+            }
             
             states[child].parentEntityId = parent;
             states[child].isClustered = true;
             states[parent].childCount++;
+            states[parent].childList.push_back(child);
         }
         
         // 5. Close cycle between first and last
         int first = candidates[0];
         int last = candidates[n - 1];
+        // Links were rewired in place: restamp and re-index the chain before the LCA query (Phase 70)
+        MolecularHierarchy::propagateMoleculeId(first, states);
+        for (int id : candidates) assert(MolecularHierarchy::checkLinks(id, states));
         
         // Call tryCycleBond to handle ring formation
         if (RingChemistry::tryCycleBond(first, last, states, atoms, transforms) == BondError::SUCCESS) {
@@ -156,6 +268,8 @@ public:
             return true;
         }
         
+        // Chain was rewired without a cycle: still a topology change
+        for (int id : candidates) TopologyEvents::getInstance().touch(id, states);
         return false;
     }
 };
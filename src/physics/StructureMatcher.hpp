@@ -0,0 +1,161 @@
+#ifndef STRUCTURE_MATCHER_HPP
+#define STRUCTURE_MATCHER_HPP
+
+#include <vector>
+#include "../ecs/components.hpp"
+#include "../chemistry/StructureTemplate.hpp"
+
+/**
+ * StructureMatcher (Phase 48)
+ * Anchored subgraph matcher (VF2-style backtracking) for StructureTemplate.
+ * For each spanning variant, tree edges must map onto existing bonds and
+ * closure edges onto atom pairs that are still free to form a cycle bond.
+ *
+ * Candidates for each template node come only from the bond neighbours of an
+ * already-mapped atom and are pruned by label and degree, so the cost of a
+ * match grows with the template, not with the molecule.
+ */
+class StructureMatcher {
+public:
+    enum class Result { MATCHED, NO_MATCH, BLOCKED };  // BLOCKED: only shielded atoms prevented it
+
+    struct Match {
+        std::vector<int> mapping;                                 // mapping[node] = atomId
+        const StructureTemplate::SpanningVariant* variant = nullptr;  // Which bonds still need forming
+    };
+
+    // Bond-graph neighbours: parent, children and cycle partner
+    static void getBondNeighbors(int id, const std::vector<StateComponent>& states, std::vector<int>& out) {
+        out.clear();
+        const StateComponent& s = states[id];
+        if (s.parentEntityId != -1) out.push_back(s.parentEntityId);
+        for (int c : s.childList) out.push_back(c);
+        if (s.cycleBondId != -1) out.push_back(s.cycleBondId);
+    }
+
+    static bool areBonded(int a, int b, const std::vector<StateComponent>& states) {
+        return states[a].parentEntityId == b || states[b].parentEntityId == a || states[a].cycleBondId == b;
+    }
+
+    /**
+     * Tries to map template node `startNode` onto atom `seedId` and extend the mapping.
+     */
+    static Result matchFrom(const StructureTemplate& t, int startNode, int seedId,
+                            const std::vector<StateComponent>& states,
+                            const std::vector<AtomComponent>& atoms,
+                            Match& match) {
+        std::vector<int>& mapping = match.mapping;
+        match.variant = nullptr;
+        if (!t.valid || startNode < 0 || startNode >= t.size()) return Result::NO_MATCH;
+        if (!StructureTemplate::labelMatches(t.labels[startNode], atoms[seedId].atomicNumber)) return Result::NO_MATCH;
+
+        bool blocked = false;
+        for (const auto& variant : t.variants) {
+            Context ctx{ t, variant, variant.matchOrder[startNode], variant.matchParent[startNode],
+                         states, atoms, mapping, {}, {}, false };
+            mapping.assign(t.size(), -1);
+            bool ok = accepts(ctx, startNode, seedId);
+            if (ok) {
+                mapping[startNode] = seedId;
+                ctx.used.push_back(seedId);
+                ok = extend(ctx, 1);
+            }
+            if (ok) {
+                match.variant = &variant;
+                return Result::MATCHED;
+            }
+            blocked = blocked || ctx.shieldBlocked;
+        }
+        mapping.assign(t.size(), -1);
+        return blocked ? Result::BLOCKED : Result::NO_MATCH;
+    }
+
+    // Tries every template node that could sit on `seedId`
+    static Result matchAnchored(const StructureTemplate& t, int seedId,
+                                const std::vector<StateComponent>& states,
+                                const std::vector<AtomComponent>& atoms,
+                                Match& match) {
+        Result result = Result::NO_MATCH;
+        for (int node = 0; node < t.size(); node++) {
+            if (!StructureTemplate::labelMatches(t.labels[node], atoms[seedId].atomicNumber)) continue;
+            Result r = matchFrom(t, node, seedId, states, atoms, match);
+            if (r == Result::MATCHED) return r;
+            if (r == Result::BLOCKED) result = r;
+        }
+        return result;
+    }
+
+private:
+    struct Context {
+        const StructureTemplate& t;
+        const StructureTemplate::SpanningVariant& v;
+        const std::vector<int>& order;
+        const std::vector<int>& parent;
+        const std::vector<StateComponent>& states;
+        const std::vector<AtomComponent>& atoms;
+        std::vector<int>& mapping;
+        std::vector<int> used;       // Atoms already mapped (tiny: linear scan beats a set)
+        std::vector<int> neighbors;  // Scratch buffer
+        bool shieldBlocked;
+    };
+
+    static bool isUsed(const Context& ctx, int atomId) {
+        for (int u : ctx.used) if (u == atomId) return true;
+        return false;
+    }
+
+    // Node-level feasibility: label, degree, ring/cycle availability, shield state
+    static bool accepts(Context& ctx, int node, int atomId) {
+        const StateComponent& s = ctx.states[atomId];
+        if (!StructureTemplate::labelMatches(ctx.t.labels[node], ctx.atoms[atomId].atomicNumber)) return false;
+        if (ctx.v.isClosureEndpoint[node] && s.cycleBondId != -1) return false;
+        if (!ctx.t.allowRingAtoms && (s.isInRing || s.cycleBondId != -1)) return false;
+
+        int degree = (s.parentEntityId != -1 ? 1 : 0) + (int)s.childList.size() + (s.cycleBondId != -1 ? 1 : 0);
+        if (degree < (int)ctx.v.treeAdjacency[node].size()) return false;
+
+        if (s.isShielded) {
+            ctx.shieldBlocked = true;
+            return false;
+        }
+        return true;
+    }
+
+    // Edge-level feasibility against nodes mapped so far
+    static bool consistent(const Context& ctx, int node, int atomId) {
+        for (int v : ctx.v.treeAdjacency[node]) {
+            int mv = ctx.mapping[v];
+            if (mv != -1 && !areBonded(atomId, mv, ctx.states)) return false;
+        }
+        for (const auto& e : ctx.v.closureEdges) {
+            int other = (e.first == node) ? e.second : (e.second == node ? e.first : -1);
+            if (other == -1) continue;
+            int mo = ctx.mapping[other];
+            if (mo != -1 && areBonded(atomId, mo, ctx.states)) return false;  // Already closed
+        }
+        return true;
+    }
+
+    static bool extend(Context& ctx, size_t depth) {
+        if (depth == ctx.order.size()) return true;
+
+        int node = ctx.order[depth];
+        int anchorAtom = ctx.mapping[ctx.parent[node]];
+
+        getBondNeighbors(anchorAtom, ctx.states, ctx.neighbors);
+        std::vector<int> candidates = ctx.neighbors;  // extend() recursion reuses the scratch buffer
+        for (int c : candidates) {
+            if (isUsed(ctx, c)) continue;
+            if (!accepts(ctx, node, c) || !consistent(ctx, node, c)) continue;
+
+            ctx.mapping[node] = c;
+            ctx.used.push_back(c);
+            if (extend(ctx, depth + 1)) return true;
+            ctx.used.pop_back();
+            ctx.mapping[node] = -1;
+        }
+        return false;
+    }
+};
+
+#endif // STRUCTURE_MATCHER_HPP
@@ -0,0 +1,138 @@
+#ifndef STRUCTURE_TRACKER_HPP
+#define STRUCTURE_TRACKER_HPP
+
+#include <vector>
+#include <unordered_map>
+#include "raylib.h"
+#include "../ecs/components.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../core/SimulationState.hpp"
+
+// Phase 68: A frozen ring assembly (atoms with the same structureId and isFrozen)
+struct StructureInstance {
+    int id = -1;
+    std::vector<int> members;
+    std::vector<float> memberMass;  // Parallel to members (element atomic mass)
+    float mass = 0.0f;              // Sum of memberMass
+};
+
+/**
+ * StructureTracker (Phase 68)
+ * Owns structure ids and the member list of every frozen structure, so the
+ * tractor's structural (CTRL) drag costs O(structure size) instead of a scan
+ * of the whole world. The id counter itself stays in SimulationState, which
+ * snapshots persist.
+ *
+ * Membership only changes when a structure is created. Every lookup checks
+ * its members still carry the id (O(size)); a mismatch, or clear() after a
+ * compaction, load or replay, triggers one world scan that rebuilds the index.
+ */
+class StructureTracker {
+public:
+    static StructureTracker& getInstance() {
+        static StructureTracker instance;
+        return instance;
+    }
+
+    // Freezes `members` into a new structure and returns its id
+    int create(const std::vector<int>& members, std::vector<StateComponent>& states,
+               const std::vector<AtomComponent>& atoms) {
+        int id = SimulationState::getInstance().allocateStructureId();
+        StructureInstance& s = structures[id];
+        s.id = id;
+        for (int idx : members) {
+            if (idx < 0 || idx >= (int)states.size()) continue;
+            states[idx].structureId = id;
+            states[idx].isFrozen = true;
+            addMember(s, idx, atoms);
+        }
+        return id;
+    }
+
+    // nullptr when no live atom carries the id
+    const StructureInstance* find(int id, const std::vector<StateComponent>& states,
+                                  const std::vector<AtomComponent>& atoms) {
+        if (id < 0) return nullptr;
+        if (stale) rebuild(states, atoms);
+        auto it = structures.find(id);
+        if (it == structures.end() || !isCurrent(it->second, states)) {
+            // Atoms moved without a clear() (undo restore, chunk reload): re-index once
+            rebuild(states, atoms);
+            it = structures.find(id);
+            if (it == structures.end()) return nullptr;
+        }
+        return &it->second;
+    }
+
+    static Vector2 centreOfMass(const StructureInstance& s, const std::vector<TransformComponent>& transforms) {
+        if (s.mass <= 0.0f) return { 0.0f, 0.0f };
+        float x = 0.0f, y = 0.0f;
+        for (size_t k = 0; k < s.members.size(); k++) {
+            x += transforms[s.members[k]].x * s.memberMass[k];
+            y += transforms[s.members[k]].y * s.memberMass[k];
+        }
+        return { x / s.mass, y / s.mass };
+    }
+
+    // Momentum / mass: the velocity the assembly moves with as one rigid body
+    static Vector2 velocity(const StructureInstance& s, const std::vector<TransformComponent>& transforms) {
+        if (s.mass <= 0.0f) return { 0.0f, 0.0f };
+        float px = 0.0f, py = 0.0f;
+        for (size_t k = 0; k < s.members.size(); k++) {
+            px += transforms[s.members[k]].vx * s.memberMass[k];
+            py += transforms[s.members[k]].vy * s.memberMass[k];
+        }
+        return { px / s.mass, py / s.mass };
+    }
+
+    // Entity indices were remapped or the world was rebuilt
+    void clear() {
+        structures.clear();
+        stale = true;
+    }
+
+    int getRebuildCount() const { return rebuilds; }
+
+private:
+    StructureTracker() {}
+
+    std::unordered_map<int, StructureInstance> structures;
+    bool stale = true;   // Index must be rebuilt from the world before use
+    int rebuilds = 0;
+
+    static void addMember(StructureInstance& s, int idx, const std::vector<AtomComponent>& atoms) {
+        float m = 1.0f;
+        if (idx < (int)atoms.size()) {
+            float elementMass = ChemistryDatabase::getInstance().getElement(atoms[idx].atomicNumber).atomicMass;
+            if (elementMass > 0.0f) m = elementMass;
+        }
+        s.members.push_back(idx);
+        s.memberMass.push_back(m);
+        s.mass += m;
+    }
+
+    static bool isCurrent(const StructureInstance& s, const std::vector<StateComponent>& states) {
+        if (s.members.empty()) return false;
+        for (int idx : s.members) {
+            if (idx >= (int)states.size()) return false;
+            const StateComponent& st = states[idx];
+            if (!st.isAlive || !st.isFrozen || st.structureId != s.id) return false;
+        }
+        return true;
+    }
+
+    void rebuild(const std::vector<StateComponent>& states, const std::vector<AtomComponent>& atoms) {
+        structures.clear();
+        for (int i = 0; i < (int)states.size(); i++) {
+            const StateComponent& st = states[i];
+            if (!st.isAlive || !st.isFrozen || st.structureId < 0) continue;
+            StructureInstance& s = structures[st.structureId];
+            s.id = st.structureId;
+            addMember(s, i, atoms);
+        }
+        stale = false;
+        rebuilds++;
+    }
+};
+
+#endif // STRUCTURE_TRACKER_HPP
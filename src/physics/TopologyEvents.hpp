@@ -0,0 +1,87 @@
+#ifndef TOPOLOGY_EVENTS_HPP
+#define TOPOLOGY_EVENTS_HPP
+
+#include <vector>
+#include <cstdint>
+#include "../ecs/components.hpp"
+#include "../core/MetricsRegistry.hpp"
+
+/**
+ * TopologyEvents (Phase 47)
+ * Central clock for molecule topology changes. Every bond create/break stamps
+ * the affected atoms (and their molecule root) with a fresh topologyVersion,
+ * which acts as the molecule's dirty flag for cached analyses such as
+ * StructureDetector. Version 0 is reserved for "never stamped".
+ */
+class TopologyEvents {
+public:
+    static TopologyEvents& getInstance() {
+        static TopologyEvents instance;
+        return instance;
+    }
+
+    uint32_t nextVersion() {
+        if (++clock == 0) clock = 1;  // Skip the reserved "unknown" value on wrap
+        return clock;
+    }
+
+    // Stamps a whole connected cluster with one version (called after BFS propagation)
+    void stampMembers(const std::vector<int>& members, std::vector<StateComponent>& states) {
+        uint32_t v = nextVersion();
+        for (int id : members) states[id].topologyVersion = v;
+        if (recordTouched) touched.insert(touched.end(), members.begin(), members.end());
+    }
+
+    // Marks an edit that bypasses propagation (stress break, ring invalidation, reorganization)
+    void touch(int entityId, std::vector<StateComponent>& states) {
+        if (entityId < 0 || entityId >= (int)states.size()) return;
+        uint32_t v = nextVersion();
+        states[entityId].topologyVersion = v;
+        int root = states[entityId].moleculeId;
+        if (root >= 0 && root < (int)states.size()) states[root].topologyVersion = v;
+        if (recordTouched) {
+            touched.push_back(entityId);
+            if (root >= 0 && root < (int)states.size()) touched.push_back(root);
+        }
+    }
+
+    // Phase 50: Entities whose molecule changed since the last drain (only while a consumer is attached)
+    void setRecordTouched(bool enabled) {
+        recordTouched = enabled;
+        if (!enabled) touched.clear();
+    }
+    void drainTouched(std::vector<int>& out) {
+        out.clear();
+        out.swap(touched);
+    }
+
+    void onBondFormed() {
+        bondsFormed++;
+        MetricsRegistry::getInstance().bondsFormed.inc();  // Phase 66: not rewound by restore()
+    }
+    void onBondBroken() {
+        bondsBroken++;
+        MetricsRegistry::getInstance().bondsBroken.inc();
+    }
+
+    // Phase 53: Snapshot load (stored topologyVersions stay comparable with new stamps)
+    void restore(uint32_t savedClock, long long formed, long long broken) {
+        clock = savedClock;
+        bondsFormed = formed;
+        bondsBroken = broken;
+    }
+
+    uint32_t getClock() const { return clock; }
+    long long getBondsFormed() const { return bondsFormed; }
+    long long getBondsBroken() const { return bondsBroken; }
+
+private:
+    TopologyEvents() {}
+    uint32_t clock = 0;
+    long long bondsFormed = 0;
+    long long bondsBroken = 0;
+    bool recordTouched = false;
+    std::vector<int> touched;  // May contain duplicates; consumers dedupe
+};
+
+#endif // TOPOLOGY_EVENTS_HPP
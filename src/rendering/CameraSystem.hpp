@@ -57,6 +57,22 @@ public:
 
     Mode getMode() const { return currentMode; }
 
+    // Phase 58: World-space rectangle visible through the camera, grown by `margin` on every side
+    static Rectangle getViewRect(const Camera2D& camera, float margin) {
+        float w = (float)GetScreenWidth();
+        float h = (float)GetScreenHeight();
+        Vector2 corners[4] = {
+            GetScreenToWorld2D({0, 0}, camera), GetScreenToWorld2D({w, 0}, camera),
+            GetScreenToWorld2D({0, h}, camera), GetScreenToWorld2D({w, h}, camera)
+        };
+        float minX = corners[0].x, maxX = corners[0].x, minY = corners[0].y, maxY = corners[0].y;
+        for (const Vector2& c : corners) {  // Bounding box, so a rotated camera is covered too
+            minX = std::min(minX, c.x); maxX = std::max(maxX, c.x);
+            minY = std::min(minY, c.y); maxY = std::max(maxY, c.y);
+        }
+        return { minX - margin, minY - margin, (maxX - minX) + 2.0f * margin, (maxY - minY) + 2.0f * margin };
+    }
+
 private:
     Mode currentMode;
     float targetZoom; // Zoom hacia el que queremos ir
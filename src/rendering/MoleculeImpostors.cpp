@@ -0,0 +1,111 @@
+#include "MoleculeImpostors.hpp"
+#include "../physics/TopologyEvents.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../core/Config.hpp"
+#include <algorithm>
+#include <cmath>
+
+void MoleculeImpostors::update(const std::vector<TransformComponent>& transforms,
+                               const std::vector<AtomComponent>& atoms,
+                               const std::vector<StateComponent>& states) {
+    framesSinceRebuild++;
+    uint32_t clock = TopologyEvents::getInstance().getClock();
+    bool topologyMoved = clock != builtClock && framesSinceRebuild >= Config::LOD_IMPOSTOR_REFRESH_FRAMES;
+    if (!valid || states.size() != builtEntities || topologyMoved) {
+        rebuild(transforms, atoms, states);
+        return;
+    }
+
+    // Round-robin: every molecule is recentred once per LOD_IMPOSTOR_REFRESH_FRAMES frames
+    lastRecentredAtoms = 0;
+    if (impostors.empty()) return;
+    size_t slice = (impostors.size() + Config::LOD_IMPOSTOR_REFRESH_FRAMES - 1) / Config::LOD_IMPOSTOR_REFRESH_FRAMES;
+    for (size_t k = 0; k < slice; k++) {
+        if (cursor >= impostors.size()) cursor = 0;
+        recentre(impostors[cursor++], transforms, atoms);
+    }
+}
+
+void MoleculeImpostors::rebuild(const std::vector<TransformComponent>& transforms,
+                                const std::vector<AtomComponent>& atoms,
+                                const std::vector<StateComponent>& states) {
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    const int n = (int)std::min({ states.size(), atoms.size(), transforms.size() });
+
+    // 1. One impostor per molecule root, sized by a counting pass
+    impostors.clear();
+    slotOfRoot.assign(n, -1);
+    for (int i = 0; i < n; i++) {
+        if (!states[i].isAlive) continue;
+        int root = states[i].moleculeId;
+        if (root < 0 || root >= n) root = i;
+        if (slotOfRoot[root] == -1) {
+            slotOfRoot[root] = (int)impostors.size();
+            impostors.push_back({});
+            impostors.back().root = root;
+        }
+        impostors[slotOfRoot[root]].count++;
+    }
+    int offset = 0;
+    for (MoleculeImpostor& m : impostors) {
+        m.first = offset;
+        offset += m.count;
+        m.count = 0;
+    }
+    members.resize(offset);
+    for (int i = 0; i < n; i++) {
+        if (!states[i].isAlive) continue;
+        int root = states[i].moleculeId;
+        if (root < 0 || root >= n) root = i;
+        MoleculeImpostor& m = impostors[slotOfRoot[root]];
+        members[m.first + m.count++] = i;
+    }
+
+    // 2. Dominant element (topology only) and geometry
+    lastRecentredAtoms = 0;
+    for (MoleculeImpostor& m : impostors) {
+        int best = atoms[members[m.first]].atomicNumber;
+        int bestCount = 0;
+        for (int k = m.first; k < m.first + m.count; k++) {
+            int z = atoms[members[k]].atomicNumber;
+            if (z < 0) continue;
+            if (z >= (int)elementCounts.size()) elementCounts.resize(z + 1, 0);
+            int c = ++elementCounts[z];
+            if (c > bestCount || (c == bestCount && z > best)) { best = z; bestCount = c; }
+        }
+        for (int k = m.first; k < m.first + m.count; k++) {
+            int z = atoms[members[k]].atomicNumber;
+            if (z >= 0) elementCounts[z] = 0;
+        }
+        m.color = db.getElement(best).color;
+        recentre(m, transforms, atoms);
+    }
+
+    valid = true;
+    builtClock = TopologyEvents::getInstance().getClock();
+    builtEntities = states.size();
+    framesSinceRebuild = 0;
+    cursor = 0;
+    rebuilds++;
+}
+
+void MoleculeImpostors::recentre(MoleculeImpostor& m, const std::vector<TransformComponent>& transforms,
+                                 const std::vector<AtomComponent>& atoms) {
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    float sx = 0.0f, sy = 0.0f;
+    for (int k = m.first; k < m.first + m.count; k++) {
+        sx += transforms[members[k]].x;
+        sy += transforms[members[k]].y;
+    }
+    m.x = sx / m.count;
+    m.y = sy / m.count;
+
+    float radius = 0.0f;
+    for (int k = m.first; k < m.first + m.count; k++) {
+        const TransformComponent& tr = transforms[members[k]];
+        float edge = db.getElement(atoms[members[k]].atomicNumber).vdWRadius * Config::BASE_ATOM_RADIUS;
+        radius = std::max(radius, std::sqrt((tr.x - m.x) * (tr.x - m.x) + (tr.y - m.y) * (tr.y - m.y)) + edge);
+    }
+    m.radius = radius;
+    lastRecentredAtoms += m.count;
+}
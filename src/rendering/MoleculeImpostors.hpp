@@ -0,0 +1,65 @@
+#ifndef MOLECULE_IMPOSTORS_HPP
+#define MOLECULE_IMPOSTORS_HPP
+
+#include "raylib.h"
+#include "../ecs/components.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Phase 60: One molecule drawn as a single disc at low zoom
+struct MoleculeImpostor {
+    int root = -1;        // Molecule root (moleculeId), or the atom itself when free
+    int first = 0;        // Range in the member list
+    int count = 0;
+    float x = 0.0f;       // Centroid
+    float y = 0.0f;
+    float radius = 0.0f;  // Centroid to the farthest atom edge
+    Color color = WHITE;  // Colour of the most common element
+};
+
+/**
+ * MoleculeImpostors (Phase 60)
+ * Per-molecule centroid, bounding radius and dominant colour for the
+ * zoomed-out LOD. Membership (atoms grouped by molecule root) is rebuilt in
+ * one O(N) pass, at most every Config::LOD_IMPOSTOR_REFRESH_FRAMES frames
+ * while the topology clock moves, or at once if the entity count changes.
+ * Between rebuilds each update() recentres a 1/LOD_IMPOSTOR_REFRESH_FRAMES
+ * slice of the molecules, so a frame costs O(molecules) plus a fraction of
+ * the atoms, and an impostor lags its atoms by at most that many frames.
+ */
+class MoleculeImpostors {
+public:
+    // Call once per frame while the impostor level is drawn
+    void update(const std::vector<TransformComponent>& transforms,
+                const std::vector<AtomComponent>& atoms,
+                const std::vector<StateComponent>& states);
+
+    // Forces a rebuild on the next update (the LOD level was left)
+    void invalidate() { valid = false; }
+
+    const std::vector<MoleculeImpostor>& getImpostors() const { return impostors; }
+    long long getRebuilds() const { return rebuilds; }
+    int getLastRecentredAtoms() const { return lastRecentredAtoms; }
+
+private:
+    std::vector<MoleculeImpostor> impostors;
+    std::vector<int> members;        // Entity ids grouped by impostor
+    std::vector<int> slotOfRoot;     // Rebuild scratch: root entity -> impostor index
+    std::vector<int> elementCounts;  // Rebuild scratch: atomic number -> members
+    bool valid = false;
+    uint32_t builtClock = 0;
+    size_t builtEntities = 0;
+    int framesSinceRebuild = 0;
+    size_t cursor = 0;
+    long long rebuilds = 0;
+    int lastRecentredAtoms = 0;
+
+    void rebuild(const std::vector<TransformComponent>& transforms,
+                 const std::vector<AtomComponent>& atoms,
+                 const std::vector<StateComponent>& states);
+    void recentre(MoleculeImpostor& m, const std::vector<TransformComponent>& transforms,
+                  const std::vector<AtomComponent>& atoms);
+};
+
+#endif // MOLECULE_IMPOSTORS_HPP
@@ -0,0 +1,115 @@
+#include "QuadBatch.hpp"
+#include "rlgl.h"
+#include "raymath.h"
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+void QuadBatch::addSprite(float cx, float cy, float halfSize, const Rectangle& uv, Color color) {
+    float u0 = uv.x, v0 = uv.y, u1 = uv.x + uv.width, v1 = uv.y + uv.height;
+    push(cx - halfSize, cy - halfSize, u0, v0, color);
+    push(cx - halfSize, cy + halfSize, u0, v1, color);
+    push(cx + halfSize, cy + halfSize, u1, v1, color);
+    push(cx + halfSize, cy - halfSize, u1, v0, color);
+}
+
+void QuadBatch::addQuad(const Rectangle& dest, const Rectangle& uv, Color color) {
+    float u0 = uv.x, v0 = uv.y, u1 = uv.x + uv.width, v1 = uv.y + uv.height;
+    push(dest.x, dest.y, u0, v0, color);
+    push(dest.x, dest.y + dest.height, u0, v1, color);
+    push(dest.x + dest.width, dest.y + dest.height, u1, v1, color);
+    push(dest.x + dest.width, dest.y, u1, v0, color);
+}
+
+void QuadBatch::addLine(Vector2 start, Vector2 end, float thickness, const Rectangle& uv, Color color) {
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float len = std::sqrt(dx * dx + dy * dy);
+    if (len <= 0.0f || thickness <= 0.0f) return;
+    float scale = thickness / (2.0f * len);
+    float px = -dy * scale;
+    float py = dx * scale;
+    float u = uv.x + uv.width * 0.5f;
+    float v = uv.y + uv.height * 0.5f;
+    push(start.x - px, start.y - py, u, v, color);
+    push(start.x + px, start.y + py, u, v, color);
+    push(end.x + px, end.y + py, u, v, color);
+    push(end.x - px, end.y - py, u, v, color);
+}
+
+void QuadBatch::ensureBuffers() {
+    if (vaoId != 0 || vboId != 0) return;
+
+    std::vector<unsigned short> indices(MAX_QUADS_PER_DRAW * 6);
+    for (int q = 0; q < MAX_QUADS_PER_DRAW; q++) {
+        unsigned short base = (unsigned short)(q * 4);
+        unsigned short* idx = &indices[q * 6];
+        idx[0] = base;     idx[1] = base + 1; idx[2] = base + 2;
+        idx[3] = base;     idx[4] = base + 2; idx[5] = base + 3;
+    }
+
+    vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(vaoId);
+    vboId = rlLoadVertexBuffer(nullptr, MAX_QUADS_PER_DRAW * 4 * (int)sizeof(Vertex), true);
+    bindAttributes();
+    eboId = rlLoadVertexBufferElement(indices.data(), (int)(indices.size() * sizeof(unsigned short)), false);
+    rlDisableVertexArray();
+}
+
+void QuadBatch::bindAttributes() {
+    const int* locs = rlGetShaderLocsDefault();
+    const int stride = (int)sizeof(Vertex);
+    rlEnableVertexBuffer(vboId);
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, false, stride, (const void*)offsetof(Vertex, x));
+    rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, false, stride, (const void*)offsetof(Vertex, u));
+    rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, true, stride, (const void*)offsetof(Vertex, r));
+    rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+
+void QuadBatch::draw(unsigned int textureId) {
+    drawCalls = 0;
+    int quadCount = getQuadCount();
+    if (quadCount == 0) return;
+
+    ensureBuffers();
+    rlDrawRenderBatchActive();  // Anything raylib queued must land underneath
+
+    unsigned int shader = rlGetShaderIdDefault();
+    const int* locs = rlGetShaderLocsDefault();
+    rlEnableShader(shader);
+    rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+    int unit = 0;
+    rlSetUniform(locs[RL_SHADER_LOC_MAP_DIFFUSE], &unit, RL_SHADER_UNIFORM_INT, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(textureId);
+
+    for (int first = 0; first < quadCount; first += MAX_QUADS_PER_DRAW) {
+        int count = std::min(MAX_QUADS_PER_DRAW, quadCount - first);
+        rlUpdateVertexBuffer(vboId, &vertices[(size_t)first * 4], count * 4 * (int)sizeof(Vertex), 0);
+        if (!rlEnableVertexArray(vaoId)) {
+            bindAttributes();  // No VAO support: re-specify the layout per draw
+            rlEnableVertexBufferElement(eboId);
+        }
+        rlDrawVertexArrayElements(0, count * 6, 0);
+        drawCalls++;
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+void QuadBatch::unload() {
+    if (vaoId != 0) rlUnloadVertexArray(vaoId);
+    if (vboId != 0) rlUnloadVertexBuffer(vboId);
+    if (eboId != 0) rlUnloadVertexBuffer(eboId);
+    vaoId = vboId = eboId = 0;
+    vertices.clear();
+    vertices.shrink_to_fit();
+}
@@ -0,0 +1,58 @@
+#ifndef QUAD_BATCH_HPP
+#define QUAD_BATCH_HPP
+
+#include "raylib.h"
+#include <vector>
+
+/**
+ * QuadBatch (Phase 57)
+ * CPU-side vertex array of textured, vertex-coloured quads, uploaded to one
+ * dynamic VBO and submitted through rlgl with the default shader. Indices
+ * are 16-bit (rlgl's element draw), so a draw call covers at most
+ * MAX_QUADS_PER_DRAW quads; larger batches are split into several calls.
+ *
+ * Requires a live GL context: create lazily inside the draw loop and
+ * unload() before CloseWindow().
+ */
+class QuadBatch {
+public:
+    static constexpr int MAX_QUADS_PER_DRAW = 16384;  // 65536 vertices
+
+    void clear() { vertices.clear(); }
+    int getQuadCount() const { return (int)(vertices.size() / 4); }
+    int getDrawCalls() const { return drawCalls; }
+
+    // Axis-aligned square centred on (cx, cy), sampling the texture rect uv (normalised)
+    void addSprite(float cx, float cy, float halfSize, const Rectangle& uv, Color color);
+
+    // Phase 61: Axis-aligned rectangle (text glyphs)
+    void addQuad(const Rectangle& dest, const Rectangle& uv, Color color);
+
+    // Thick segment, same geometry as DrawLineEx(); uv should point at an opaque white texel area
+    void addLine(Vector2 start, Vector2 end, float thickness, const Rectangle& uv, Color color);
+
+    // Flushes raylib's own batch first so draw order is preserved
+    void draw(unsigned int textureId);
+    void unload();
+
+private:
+    struct Vertex {
+        float x, y;
+        float u, v;
+        unsigned char r, g, b, a;
+    };
+
+    std::vector<Vertex> vertices;
+    unsigned int vaoId = 0;
+    unsigned int vboId = 0;
+    unsigned int eboId = 0;
+    int drawCalls = 0;
+
+    void ensureBuffers();
+    void bindAttributes();
+    void push(float x, float y, float u, float v, Color c) {
+        vertices.push_back({ x, y, u, v, c.r, c.g, c.b, c.a });
+    }
+};
+
+#endif // QUAD_BATCH_HPP
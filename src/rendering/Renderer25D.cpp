@@ -1,15 +1,232 @@
 #include "Renderer25D.hpp"
+#include "QuadBatch.hpp"
+#include "MoleculeImpostors.hpp"
+#include "CameraSystem.hpp"
+#include "../physics/SpatialGrid.hpp"
 #include "../chemistry/ChemistryDatabase.hpp"
 #include "../core/Config.hpp"
 #include "../core/MathUtils.hpp"
 #include <algorithm>
 #include <cmath>
 
-void Renderer25D::drawAtoms(const std::vector<TransformComponent>& transforms, const std::vector<AtomComponent>& atoms, const std::vector<StateComponent>& states) {
+// Phase 57: Atoms and bonds go through two vertex batches instead of one raylib call per shape
+namespace {
+    // Atlas cells (CELL x CELL each): gradient disc | ring outline | solid white
+    constexpr int CELL = 64;
+    constexpr int ATLAS_W = CELL * 3;
+    constexpr float RING_INNER_RATIO = 0.82f;  // Outline band relative to the quad's half-size
+
+    QuadBatch bondBatch;
+    QuadBatch atomBatch;
+    Texture2D atlas = { 0 };
+    RenderStats lastStats;
+    int vibFrame = 0;  // Ring outline vibration clock, advanced once per drawn frame
+
+    // Phase 60: Zoomed-out levels
+    MoleculeImpostors impostors;
+    Texture2D heatTexture = { 0 };
+    std::vector<GridCellCount> heatCells;
+    std::vector<float> heatCounts;
+    std::vector<Color> heatPixels;
+
+    // Phase 58: Culled entity ids; Phase 59: atoms in draw order and the depth sort scratch
+    // (bucket starts, per-atom bucket, sorted ids)
+    std::vector<int> culledIds;
+    std::vector<int> drawOrder;
+    std::vector<int> depthStarts;
+    std::vector<int> depthKeys;
+    std::vector<int> depthSorted;
+
+    // Half-texel inset so bilinear filtering never reaches a neighbouring cell
+    Rectangle cellUV(int cell) {
+        const float texel = 1.0f / (float)ATLAS_W;
+        return { (float)(cell * CELL) / ATLAS_W + texel * 0.5f, 0.5f / CELL,
+                 (float)CELL / ATLAS_W - texel, 1.0f - 1.0f / CELL };
+    }
+
+    unsigned char coverage(float d, float edge) {
+        return (unsigned char)(std::clamp(edge - d + 0.5f, 0.0f, 1.0f) * 255.0f);
+    }
+
+    // White centre fading to black at the rim: tinted by the atom colour it reproduces
+    // DrawCircleGradient(colour -> BLACK)
+    void bakeAtlas() {
+        std::vector<Color> pixels((size_t)ATLAS_W * CELL, BLANK);
+        const float r = CELL * 0.5f - 0.5f;
+        for (int y = 0; y < CELL; y++) {
+            for (int x = 0; x < CELL; x++) {
+                float d = std::sqrt((x + 0.5f - CELL * 0.5f) * (x + 0.5f - CELL * 0.5f) +
+                                    (y + 0.5f - CELL * 0.5f) * (y + 0.5f - CELL * 0.5f));
+                unsigned char shade = (unsigned char)(255.0f * (1.0f - std::min(d / r, 1.0f)));
+                pixels[(size_t)y * ATLAS_W + x] = { shade, shade, shade, coverage(d, r) };
+
+                unsigned char band = std::min(coverage(d, r), coverage(r * RING_INNER_RATIO, d));
+                pixels[(size_t)y * ATLAS_W + CELL + x] = { 255, 255, 255, band };
+
+                pixels[(size_t)y * ATLAS_W + 2 * CELL + x] = WHITE;
+            }
+        }
+        Image image = { pixels.data(), ATLAS_W, CELL, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        atlas = LoadTextureFromImage(image);
+        SetTextureFilter(atlas, TEXTURE_FILTER_BILINEAR);
+    }
+
+    void addBond(Vector2 start, Vector2 end, float width, Color color) {
+        bondBatch.addLine(start, end, width, cellUV(2), color);
+    }
+
+    // Phase 59: Back-to-front order in ~O(N). A stable counting sort over about one bucket
+    // per atom (spanning the visible z range) leaves only a few atoms per bucket; an
+    // insertion pass then restores the exact order inside buckets.
+    void sortByDepth(std::vector<int>& ids, const std::vector<TransformComponent>& transforms) {
+        std::vector<int>& starts = depthStarts;
+        std::vector<int>& keys = depthKeys;
+        std::vector<int>& sorted = depthSorted;
+        if (ids.size() < 2) return;
+
+        float zMin = transforms[ids[0]].z, zMax = zMin;
+        for (int id : ids) {
+            zMin = std::min(zMin, transforms[id].z);
+            zMax = std::max(zMax, transforms[id].z);
+        }
+        const int buckets = (int)std::max<size_t>(ids.size() / Config::RENDER_DEPTH_BUCKET_ATOMS, 1);
+        const float scale = (zMax > zMin) ? (float)buckets / (zMax - zMin) : 0.0f;
+
+        starts.assign(buckets + 1, 0);
+        keys.resize(ids.size());
+        for (size_t k = 0; k < ids.size(); k++) {
+            int b = std::min((int)((transforms[ids[k]].z - zMin) * scale), buckets - 1);
+            keys[k] = b;
+            starts[b + 1]++;
+        }
+        for (int b = 0; b < buckets; b++) starts[b + 1] += starts[b];
+        sorted.resize(ids.size());
+        for (size_t k = 0; k < ids.size(); k++) sorted[starts[keys[k]]++] = ids[k];
+        ids.swap(sorted);
+
+        // A tight cluster plus a far outlier can crowd one bucket: cap the repair work
+        size_t budget = ids.size() * 8;
+        for (size_t i = 1; i < ids.size(); i++) {
+            int id = ids[i];
+            float z = transforms[id].z;
+            size_t j = i;
+            while (j > 0 && transforms[ids[j - 1]].z > z) {
+                ids[j] = ids[j - 1];
+                j--;
+            }
+            ids[j] = id;
+            budget -= std::min(budget, i - j);
+            if (budget == 0) {
+                std::stable_sort(ids.begin(), ids.end(), [&](int a, int b) { return transforms[a].z < transforms[b].z; });
+                return;
+            }
+        }
+    }
+
+    // Transparent -> deep blue -> cyan -> pale yellow
+    Color heatColor(float t) {
+        if (t <= 0.0f) return BLANK;
+        auto mix = [](Color a, Color b, float k) {
+            return Color{ (unsigned char)(a.r + (b.r - a.r) * k), (unsigned char)(a.g + (b.g - a.g) * k),
+                          (unsigned char)(a.b + (b.b - a.b) * k), 255 };
+        };
+        Color c = (t < 0.5f) ? mix({ 30, 60, 160, 255 }, { 60, 200, 255, 255 }, t * 2.0f)
+                             : mix({ 60, 200, 255, 255 }, { 255, 240, 170, 255 }, (t - 0.5f) * 2.0f);
+        c.a = (unsigned char)(70.0f + 170.0f * t);
+        return c;
+    }
+
+    // Phase 60: O(molecules). Impostors outside the view are skipped by their bounding circle
+    void drawImpostors(const std::vector<TransformComponent>& transforms, const std::vector<AtomComponent>& atoms,
+                       const std::vector<StateComponent>& states, const Camera2D& camera) {
+        impostors.update(transforms, atoms, states);
+        Rectangle view = CameraSystem::getViewRect(camera, Config::RENDER_CULL_MARGIN);
+        int drawn = 0;
+        for (const MoleculeImpostor& m : impostors.getImpostors()) {
+            if (m.x + m.radius < view.x || m.x - m.radius > view.x + view.width ||
+                m.y + m.radius < view.y || m.y - m.radius > view.y + view.height) continue;
+            atomBatch.addSprite(m.x, m.y, m.radius, cellUV(0), m.color);
+            drawn++;
+        }
+        atomBatch.draw(atlas.id);
+        lastStats.atomQuads = atomBatch.getQuadCount();
+        lastStats.drawCalls = atomBatch.getDrawCalls();
+        lastStats.impostors = drawn;
+    }
+
+    // Phase 60: O(occupied cells). Cell counts become texels of one streamed texture
+    // (cells are merged so the view fits LOD_HEAT_TEXTURE_SIZE), drawn with bilinear filtering
+    void drawDensity(const Camera2D& camera, const SpatialGrid& grid) {
+        const int size = Config::LOD_HEAT_TEXTURE_SIZE;
+        if (heatTexture.id == 0) {
+            Image blank = GenImageColor(size, size, BLANK);
+            heatTexture = LoadTextureFromImage(blank);
+            UnloadImage(blank);
+            SetTextureFilter(heatTexture, TEXTURE_FILTER_BILINEAR);
+            SetTextureWrap(heatTexture, TEXTURE_WRAP_CLAMP);
+        }
+
+        const float cellSize = grid.getCellSize();
+        Rectangle view = CameraSystem::getViewRect(camera, cellSize);
+        heatCells.clear();
+        grid.queryCellCounts(view, heatCells);
+
+        int minX = (int)std::floor(view.x / cellSize);
+        int minY = (int)std::floor(view.y / cellSize);
+        int spanX = (int)std::floor((view.x + view.width) / cellSize) - minX + 1;
+        int spanY = (int)std::floor((view.y + view.height) / cellSize) - minY + 1;
+        // One spare texel per side stays empty so filtering fades out at the edge
+        int merge = std::max((std::max(spanX, spanY) + size - 2) / (size - 1), 1);
+        int texW = (spanX + merge - 1) / merge;
+        int texH = (spanY + merge - 1) / merge;
+
+        heatCounts.assign((size_t)(texW + 1) * (texH + 1), 0.0f);
+        for (const GridCellCount& c : heatCells) {
+            int tx = (c.cx - minX) / merge;
+            int ty = (c.cy - minY) / merge;
+            if (tx < 0 || ty < 0 || tx >= texW || ty >= texH) continue;
+            heatCounts[(size_t)ty * (texW + 1) + tx] += (float)c.count;
+        }
+        const float full = Config::LOD_HEAT_FULL_ATOMS * merge * merge;
+        heatPixels.resize(heatCounts.size());
+        for (size_t k = 0; k < heatCounts.size(); k++) heatPixels[k] = heatColor(std::min(heatCounts[k] / full, 1.0f));
+
+        UpdateTextureRec(heatTexture, { 0, 0, (float)(texW + 1), (float)(texH + 1) }, heatPixels.data());
+        Rectangle dest = { minX * cellSize, minY * cellSize, texW * merge * cellSize, texH * merge * cellSize };
+        DrawTexturePro(heatTexture, { 0, 0, (float)texW, (float)texH }, dest, { 0, 0 }, 0.0f, WHITE);
+        lastStats.heatCells = (int)heatCells.size();
+        lastStats.drawCalls = 1;
+    }
+}
+
+void Renderer25D::drawAtoms(const std::vector<TransformComponent>& transforms, const std::vector<AtomComponent>& atoms,
+                            const std::vector<StateComponent>& states, const Camera2D& camera, const SpatialGrid& grid) {
     ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    if (atlas.id == 0) bakeAtlas();
+    bondBatch.clear();
+    atomBatch.clear();
+    lastStats = RenderStats{};
+
+    // Phase 60: Zoomed out, draw per molecule or per grid cell instead of per atom
+    LodLevel level = getLodLevel(camera.zoom);
+    lastStats.lodLevel = (int)level;
+    if (level != LodLevel::MOLECULES) impostors.invalidate();
+    if (level == LodLevel::MOLECULES) {
+        drawImpostors(transforms, atoms, states, camera);
+        return;
+    }
+    if (level == LodLevel::DENSITY) {
+        drawDensity(camera, grid);
+        return;
+    }
+
+    // Phase 58: Only grid cells overlapping the view. The margin covers a bond whose
+    // far end is off screen (both ends then lie within MAX_BOND_RENDER_DIST of the view)
+    const std::vector<int>& visible = getVisibleEntities(camera, grid, Config::MAX_BOND_RENDER_DIST);
     
     // 1. DRAW BONDS FIRST (Rendered behind atoms)
-    for (int i = 0; i < (int)states.size(); i++) {
+    for (int i : visible) {
+        if (i >= (int)states.size()) continue;  // Grid lags a spawn/compaction by one step
         const StateComponent& state = states[i];
         if (state.isClustered && state.parentEntityId != -1) {
             int pId = state.parentEntityId;
@@ -53,8 +270,8 @@ void Renderer25D::drawAtoms(const std::vector<TransformComponent>& transforms, c
             }
             
             float thickness = isRingBond ? 2.0f : 1.0f; 
-            DrawLineEx(start, end, Config::RENDER_BOND_THICKNESS_BG * scale * thickness, BLACK);
-            DrawLineEx(start, end, Config::RENDER_BOND_THICKNESS_FG * scale * thickness, bondColor);
+            addBond(start, end, Config::RENDER_BOND_THICKNESS_BG * scale * thickness, BLACK);
+            addBond(start, end, Config::RENDER_BOND_THICKNESS_FG * scale * thickness, bondColor);
         }
 
         // --- PHASE 41: DRAW CYCLE BONDS (Closing the loop) ---
@@ -100,23 +317,23 @@ void Renderer25D::drawAtoms(const std::vector<TransformComponent>& transforms, c
                 };
             }
 
-            DrawLineEx(start, end, Config::RENDER_BOND_THICKNESS_BG * scale * thicknessMult, BLACK);
-            DrawLineEx(start, end, Config::RENDER_BOND_THICKNESS_FG * scale * thicknessMult, bondColor);
+            addBond(start, end, Config::RENDER_BOND_THICKNESS_BG * scale * thicknessMult, BLACK);
+            addBond(start, end, Config::RENDER_BOND_THICKNESS_FG * scale * thicknessMult, bondColor);
         }
     }
 
     // 2. DRAW ATOMS (rendered on top of bonds)
-    static std::vector<int> indices;
-    if (indices.size() != transforms.size()) {
-        indices.resize(transforms.size());
-        for (int i = 0; i < (int)indices.size(); i++) indices[i] = i;
+    std::vector<int>& indices = drawOrder;
+    indices.clear();
+    for (int i : visible) {
+        if (i < (int)states.size()) indices.push_back(i);
     }
 
-    std::sort(indices.begin(), indices.end(), [&](int a, int b) {
-        return transforms[a].z < transforms[b].z;
-    });
+    sortByDepth(indices, transforms);
+    vibFrame++;
 
     for (int idx : indices) {
+        if (!states[idx].isAlive) continue;
         const TransformComponent& tr = transforms[idx];
         const Element& element = db.getElement(atoms[idx].atomicNumber);
         
@@ -136,20 +353,54 @@ void Renderer25D::drawAtoms(const std::vector<TransformComponent>& transforms, c
             255 
         };
 
-        DrawCircleGradient((int)tr.x, (int)tr.y, radius, finalColor, BLACK);
+        atomBatch.addSprite(std::floor(tr.x), std::floor(tr.y), radius, cellUV(0), finalColor);
         
         // --- PHASE 41: PERIMETER HIGHLIGHTING with VISUAL VIBRATION ---
         if (states[idx].isInRing) {
             // Add subtle visual vibration (render-only, doesn't affect physics)
-            static int vibFrame = 0;
-            vibFrame++;
             float vibX = std::sin(vibFrame * 0.08f + idx * 1.5f) * 0.6f;  // Slow + subtle
             float vibY = std::cos(vibFrame * 0.06f + idx * 1.7f) * 0.6f;
             
-            DrawCircleLines((int)(tr.x + vibX), (int)(tr.y + vibY), radius + 1.0f, SKYBLUE);
-            DrawCircleLines((int)(tr.x + vibX), (int)(tr.y + vibY), radius + 2.0f, SKYBLUE);
+            // Outline band covering the old radius+1 / radius+2 circle pair
+            atomBatch.addSprite(std::floor(tr.x + vibX), std::floor(tr.y + vibY), radius + 2.5f, cellUV(1), SKYBLUE);
         }
     }
+
+    bondBatch.draw(atlas.id);
+    atomBatch.draw(atlas.id);
+    lastStats.bondQuads = bondBatch.getQuadCount();
+    lastStats.atomQuads = atomBatch.getQuadCount();
+    lastStats.drawCalls = bondBatch.getDrawCalls() + atomBatch.getDrawCalls();
+    lastStats.visibleEntities = (int)indices.size();
+}
+
+const std::vector<int>& Renderer25D::getVisibleEntities(const Camera2D& camera, const SpatialGrid& grid, float margin) {
+    culledIds.clear();
+    grid.queryRect(CameraSystem::getViewRect(camera, margin + Config::RENDER_CULL_MARGIN), culledIds);
+    return culledIds;
+}
+
+LodLevel Renderer25D::getLodLevel(float zoom) {
+    if (zoom < Config::LOD_DENSITY_ZOOM) return LodLevel::DENSITY;
+    if (zoom < Config::LOD_MOLECULE_ZOOM) return LodLevel::MOLECULES;
+    return LodLevel::ATOMS;
+}
+
+const MoleculeImpostors& Renderer25D::getImpostors() {
+    return impostors;
+}
+
+const RenderStats& Renderer25D::getStats() {
+    return lastStats;
+}
+
+void Renderer25D::shutdown() {
+    bondBatch.unload();
+    atomBatch.unload();
+    if (atlas.id != 0) UnloadTexture(atlas);
+    atlas = { 0 };
+    if (heatTexture.id != 0) UnloadTexture(heatTexture);
+    heatTexture = { 0 };
 }
 
 void Renderer25D::drawDebugSlots(int atomId, 
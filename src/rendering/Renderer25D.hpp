@@ -5,20 +5,65 @@
 #include "ecs/components.hpp"
 #include <vector>
 
+// Phase 57: Last frame's batch sizes
+struct RenderStats {
+    int atomQuads = 0;
+    int bondQuads = 0;
+    int drawCalls = 0;
+    int visibleEntities = 0;  // Phase 58: after camera culling
+    int lodLevel = 0;         // Phase 60: LodLevel drawn last frame
+    int impostors = 0;        // Phase 60: molecule impostors drawn
+    int heatCells = 0;        // Phase 60: grid cells folded into the density texture
+};
+
+// Phase 60: What the world is drawn as, chosen from the camera zoom
+enum class LodLevel {
+    ATOMS = 0,      // Every atom and bond
+    MOLECULES = 1,  // One impostor per molecule
+    DENSITY = 2     // Heat texture accumulated from grid cells
+};
+
+class SpatialGrid;
+class MoleculeImpostors;
+
 /**
  * Renderer optimizado para 2.5D.
  * Implementación desacoplada en Renderer25D.cpp.
+ *
+ * Phase 57: Átomos y enlaces se acumulan como quads texturizados (atlas de
+ * sprites pre-horneado) y se envían por rlgl en unas pocas llamadas.
+ *
+ * Phase 60: Con zoom bajo se dibuja una impostora por molécula y, más lejos,
+ * una textura de densidad construida desde las celdas de la grilla.
  */
 class Renderer25D {
 public:
+    // Phase 58: Only atoms in grid cells overlapping the camera view are visited
     static void drawAtoms(const std::vector<TransformComponent>& transforms, 
                          const std::vector<AtomComponent>& atoms,
-                         const std::vector<StateComponent>& states);
+                         const std::vector<StateComponent>& states,
+                         const Camera2D& camera,
+                         const SpatialGrid& grid);
+
+    // Phase 60: ATOMS above LOD_MOLECULE_ZOOM, DENSITY below LOD_DENSITY_ZOOM
+    static LodLevel getLodLevel(float zoom);
+
+    // Impostor cache behind the MOLECULES level (current while that level is drawn)
+    static const MoleculeImpostors& getImpostors();
+
+    // Entities in grid cells overlapping the view grown by `margin` (+ RENDER_CULL_MARGIN).
+    // The returned buffer is reused by the next call.
+    static const std::vector<int>& getVisibleEntities(const Camera2D& camera, const SpatialGrid& grid, float margin);
 
     // DEBUG: Visualize bonding slots for an atom
     static void drawDebugSlots(int atomId, 
                              const std::vector<TransformComponent>& transforms, 
                              const std::vector<AtomComponent>& atoms);
+
+    static const RenderStats& getStats();
+
+    // Releases the sprite atlas and GPU buffers (call before CloseWindow)
+    static void shutdown();
 };
 
 #endif
@@ -0,0 +1,169 @@
+/**
+ * test_async_logger.cpp
+ *
+ * Phase 65: Asynchronous logging backend.
+ * Records formatted later on the writer thread must read exactly like
+ * printf, concurrent producers must not lose or reorder their lines, each
+ * "[TAG]" must be held to its own per-second budget (errors exempt) with the
+ * drop reported, and SIM_LOG below the compiled level must not even evaluate its
+ * arguments.
+ *
+ * Usage: ./test_async_logger.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdarg>
+
+#include "../core/AsyncLogger.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+namespace fs = std::filesystem;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+static std::vector<std::string> readLines(const std::string& path) {
+    std::vector<std::string> lines;
+    std::ifstream in(path);
+    for (std::string line; std::getline(in, line); ) lines.push_back(line);
+    return lines;
+}
+
+// Logs through the ring and returns what printf makes of the same call
+static std::string logAndExpect(const char* format, ...) {
+    char expected[1024];
+    va_list args;
+    va_start(args, format);
+    va_list copy;
+    va_copy(copy, args);
+    vsnprintf(expected, sizeof(expected), format, copy);
+    va_end(copy);
+    AsyncLogger::getInstance().logv(LOG_INFO, format, args);
+    va_end(args);
+    return std::string("[INFO] ") + expected;
+}
+
+int main() {
+    std::cout << "=== ASYNC LOGGER TESTS ===" << std::endl << std::endl;
+    AsyncLogger& logger = AsyncLogger::getInstance();
+    const std::string path = (fs::temp_directory_path() / "lifesim_async_logger_test.log").string();
+
+    TEST(Deferred_Formatting_Matches_Printf) {
+        logger.start(path, false);
+        std::string dynamic = "chunk_12_-3.bin";
+        std::vector<std::string> expected = {
+            logAndExpect("[FMT] %d atoms, %s, %.2f ms", 42, "hexagon", 3.14159),
+            logAndExpect("[FMT] |%5.1f|%-4d|%x|%c|%+i|", -2.25, 7, 255u, 'Z', 9),
+            logAndExpect("[FMT] %lld %llu %zu %ld", -9000000000LL, 18000000000ULL, (size_t)123456, -77L),
+            logAndExpect("[FMT] %*d|%.*s|%-*s|", 6, 12, 3, "abcdef", 5, "xy"),
+            logAndExpect("[FMT] 100%% of %u in %e / %g", 5u, 0.000125, 1e10),
+            logAndExpect("[FMT] path=%s (%d KB)", dynamic.c_str(), 17),
+            logAndExpect("[FMT] no arguments at all"),
+            logAndExpect("[FMT] %hhd %hd %05.1f", 65, 300, 2.5)
+        };
+        dynamic.assign(dynamic.size(), '#');  // The record must hold its own copy
+        logger.stop();
+        std::vector<std::string> lines = readLines(path);
+        bool ok = lines.size() == expected.size() + 1 && lines[0] == "=== LIFE SIMULATOR SESSION LOG ===";
+        std::string bad;
+        for (size_t i = 0; ok && i < expected.size(); i++) {
+            if (lines[i + 1] != expected[i]) { ok = false; bad = lines[i + 1] + " != " + expected[i]; }
+        }
+        if (ok) { PASS } else { FAIL(bad << " (" << lines.size() << " lines)") }
+    }
+
+    TEST(Concurrent_Producers_Keep_Every_Line_In_Order) {
+        logger.start(path, false);
+        const int threads = 4, perThread = 40;
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; t++) {
+            producers.emplace_back([&, t]() {
+                static const char* formats[] = { "[T0] line %d of %s", "[T1] line %d of %s", "[T2] line %d of %s", "[T3] line %d of %s" };
+                for (int k = 0; k < perThread; k++) logger.log(LOG_INFO, formats[t], k, "producer");
+            });
+        }
+        for (auto& p : producers) p.join();
+        logger.stop();
+        std::vector<int> next(threads, 0);
+        bool ordered = true;
+        for (const std::string& line : readLines(path)) {
+            int t = -1, k = -1;
+            if (sscanf(line.c_str(), "[INFO] [T%d] line %d of producer", &t, &k) != 2 || t < 0 || t >= threads) continue;
+            if (k != next[t]) ordered = false;
+            next[t]++;
+        }
+        bool ok = ordered;
+        for (int t = 0; t < threads; t++) ok = ok && next[t] == perThread;
+        if (ok) { PASS } else { FAIL("ordered=" << ordered << " T0=" << next[0] << " T3=" << next[3]) }
+    }
+
+    TEST(Tag_Budget_Limits_Spam_But_Not_Errors) {
+        logger.start(path, false);
+        long long limitedBefore = logger.getStats().rateLimited;
+        for (int k = 0; k < 500; k++) logger.log(LOG_INFO, "[SPAM] hot loop %d", k);
+        for (int k = 0; k < 10; k++) logger.log(LOG_INFO, "[QUIET] event %d", k);
+        for (int k = 0; k < 60; k++) logger.log(LOG_ERROR, "[SPAM] error %d", k);
+        long long limited = logger.getStats().rateLimited - limitedBefore;
+        logger.stop();
+        int spam = 0, quiet = 0, errors = 0, notices = 0;
+        for (const std::string& line : readLines(path)) {
+            if (line.rfind("[INFO] [SPAM]", 0) == 0) spam++;
+            if (line.rfind("[INFO] [QUIET]", 0) == 0) quiet++;
+            if (line.rfind("[ERROR] [SPAM]", 0) == 0) errors++;
+            if (line.find("[LOG] Rate limit") != std::string::npos && line.find("'[SPAM]'") != std::string::npos) notices++;
+        }
+        // A second boundary inside the loop can grant one more budget
+        bool ok = spam >= Config::LOG_CATEGORY_RATE && spam <= 2 * Config::LOG_CATEGORY_RATE &&
+                  quiet == 10 && errors == 60 && notices >= 1 && limited == 500 - spam;
+        if (ok) { PASS } else { FAIL("spam=" << spam << " quiet=" << quiet << " errors=" << errors << " notices=" << notices) }
+    }
+
+    TEST(Distinct_Tags_Do_Not_Share_A_Budget) {
+        // 60 tags (and two untagged formats) at exactly one budget each: hashing them into
+        // shared buckets would drop lines, owning a bucket per tag drops none
+        static std::vector<std::string> formats;  // Formats must outlive the writer
+        for (int t = 0; t < 60; t++) formats.push_back("[CAT" + std::to_string(t) + "] line %d");
+        logger.start(path, false);
+        long long limitedBefore = logger.getStats().rateLimited;
+        for (const std::string& format : formats) {
+            for (int k = 0; k < Config::LOG_CATEGORY_RATE; k++) logger.log(LOG_INFO, format.c_str(), k);
+        }
+        for (int k = 0; k < Config::LOG_CATEGORY_RATE; k++) logger.log(LOG_INFO, "untagged first %d", k);
+        for (int k = 0; k < Config::LOG_CATEGORY_RATE; k++) logger.log(LOG_INFO, "untagged second %d", k);
+        long long limited = logger.getStats().rateLimited - limitedBefore;
+        logger.stop();
+        int lines = 0;
+        for (const std::string& line : readLines(path)) {
+            if (line.rfind("[INFO] [CAT", 0) == 0 || line.rfind("[INFO] untagged", 0) == 0) lines++;
+        }
+        int expected = 62 * Config::LOG_CATEGORY_RATE;  // Fits the ring, so none overflow
+        if (limited == 0 && lines == expected) { PASS }
+        else { FAIL("limited=" << limited << " lines=" << lines << " expected=" << expected) }
+    }
+
+    TEST(Sim_Log_Below_Compiled_Level_Is_Not_Evaluated) {
+        int evaluated = 0;
+        SIM_LOG(LOG_DEBUG, "[FILTER] dropped %d", ++evaluated);
+        SIM_LOG(LOG_TRACE, "[FILTER] dropped %d", ++evaluated);
+        bool dropped = evaluated == 0;
+        SIM_LOG(LOG_WARNING, "[FILTER] kept %d", ++evaluated);
+        bool ok = dropped && evaluated == 1 && LOG_DEBUG < Config::LOG_COMPILED_MIN_LEVEL;
+        if (ok) { PASS } else { FAIL("evaluated=" << evaluated) }
+    }
+
+    fs::remove(path);
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
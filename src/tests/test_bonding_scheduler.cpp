@@ -0,0 +1,152 @@
+/**
+ * test_bonding_scheduler.cpp
+ *
+ * Phase 46: Staggered bonding scheduler.
+ * Runs the same dense soup with different bucket counts (K) and reports how
+ * bonding latency and throughput change. Also verifies the per-tick structure
+ * detection budget is honoured.
+ *
+ * Usage: ./test_bonding_scheduler.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <iomanip>
+#include <cmath>
+#include <memory>
+
+#include "../ecs/components.hpp"
+#include "../physics/PhysicsEngine.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../physics/BondingScheduler.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+#include "../world/zones/ClayZone.hpp"
+#include "../core/Config.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+// Dense soup on a jittered lattice (deterministic layout, H/C/O mix)
+void setupSoup(std::vector<TransformComponent>& transforms,
+               std::vector<AtomComponent>& atoms,
+               std::vector<StateComponent>& states,
+               int side) {
+    transforms.clear(); atoms.clear(); states.clear();
+
+    // Player far away so it never interferes
+    transforms.push_back({4000.0f, 4000.0f, 0, 0, 0, 0, 0});
+    atoms.push_back({1, 0.0f});
+    states.push_back(StateComponent{});
+
+    const int elements[] = {1, 6, 8, 1};
+    float spacing = Config::BOND_AUTO_RANGE * 0.8f;
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            int n = (int)atoms.size();
+            float ox = std::sin(n * 12.9898f) * 6.0f;
+            float oy = std::cos(n * 78.233f) * 6.0f;
+            transforms.push_back({x * spacing + ox, y * spacing + oy, 0, 0, 0, 0, 0});
+            atoms.push_back({elements[n % 4], 0.0f});
+            StateComponent s{};
+            s.releaseTimer = 5.0f;  // Outside the tractor grace period
+            states.push_back(s);
+        }
+    }
+}
+
+struct RunResult {
+    BondingSchedulerStats stats;
+    int finalBonds;
+};
+
+// inClay puts the soup inside a ring-forming zone so structure detection actually runs
+RunResult runSoup(int bucketCount, int ticks, bool inClay = false, int structureBudget = Config::BONDING_STRUCTURE_BUDGET) {
+    std::vector<TransformComponent> transforms;
+    std::vector<AtomComponent> atoms;
+    std::vector<StateComponent> states;
+    setupSoup(transforms, atoms, states, 12);
+
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    PhysicsEngine physics;
+    physics.getBondingScheduler().setBucketCount(bucketCount);
+    physics.getBondingScheduler().setStructureBudget(structureBudget);
+    if (inClay) {
+        float extent = 12 * Config::BOND_AUTO_RANGE;
+        physics.getEnvironment().addZone(std::make_shared<ClayZone>(Rectangle{ -extent, -extent, extent * 3.0f, extent * 3.0f }));
+    }
+
+    for (int t = 0; t < ticks; t++) {
+        physics.step(Config::FIXED_DELTA_TIME, transforms, atoms, states, db, -1);
+        BondingSystem::updateHierarchy(transforms, states, atoms);
+    }
+
+    int bonds = 0;
+    for (size_t i = 1; i < states.size(); i++) {
+        if (states[i].parentEntityId != -1) bonds++;
+    }
+    return { physics.getBondingScheduler().getStats(), bonds };
+}
+
+int main() {
+    std::cout << "=== BONDING SCHEDULER TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+    StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+
+    const int TICKS = 240;
+    std::vector<RunResult> results;
+    for (int k = 1; k <= 4; k++) {
+        results.push_back(runSoup(k, TICKS));
+    }
+
+    std::cout << std::left << std::setw(4) << "K"
+              << std::setw(14) << "atoms/tick" << std::setw(14) << "bonds/tick"
+              << std::setw(16) << "latency(mean)" << std::setw(14) << "latency(max)"
+              << std::setw(10) << "bonds" << std::endl;
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(4) << r.stats.bucketCount
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(14) << r.stats.atomsPerTick()
+                  << std::setw(14) << r.stats.bondsPerTick()
+                  << std::setw(16) << r.stats.meanLatencyTicks()
+                  << std::setw(14) << r.stats.maxLatencyTicks
+                  << std::setw(10) << r.finalBonds << std::endl;
+    }
+    std::cout << std::endl;
+
+    TEST(Every_K_Forms_Bonds) {
+        bool ok = true;
+        for (const auto& r : results) ok = ok && r.finalBonds > 0;
+        if (ok) { PASS } else { FAIL("A bucket count produced no bonds") }
+    }
+
+    TEST(Evaluations_Scale_With_K) {
+        // Fewer atoms evaluated per tick as K grows
+        double k1 = results[0].stats.atomsPerTick();
+        double k4 = results[3].stats.atomsPerTick();
+        if (k4 < k1 * 0.5) { PASS } else { FAIL("K=4 did not reduce per-tick evaluations") }
+    }
+
+    TEST(Structure_Budget_Respected) {
+        // Inside clay every same-molecule contact asks for detection; a budget of 1 must defer the rest
+        const int budget = 1;
+        RunResult clay = runSoup(1, TICKS, true, budget);
+        const BondingSchedulerStats& s = clay.stats;
+        std::cout << "(attempts " << s.structureAttempts << ", deferred " << s.structureAttemptsDeferred << ") ";
+        bool ran = s.structureAttempts > 0;
+        bool capped = s.structureAttempts <= s.ticks * budget;
+        bool deferred = s.structureAttemptsDeferred > 0;
+        if (ran && capped && deferred) { PASS }
+        else { FAIL("ran=" << ran << " capped=" << capped << " deferred=" << deferred) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+/**
+ * test_data_pack.cpp
+ *
+ * Phase 63: Precompiled data pack.
+ * A pack built from data/ must decode to exactly what JsonLoader returns for
+ * every language, carry every UI string of every lang file, relocalize decoded
+ * records in place (mission progress kept), and be refused
+ * (JSON fallback) when it is truncated or a source JSON changed after the build.
+ *
+ * Usage: ./test_data_pack.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "../core/DataPack.hpp"
+#include "../core/JsonLoader.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+namespace fs = std::filesystem;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+static bool sameColor(Color a, Color b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; }
+
+static bool sameElements(const std::vector<Element>& a, const std::vector<Element>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        const Element& x = a[i];
+        const Element& y = b[i];
+        if (x.atomicNumber != y.atomicNumber || x.symbol != y.symbol || x.name != y.name ||
+            x.atomicMass != y.atomicMass || x.vdWRadius != y.vdWRadius || !sameColor(x.color, y.color) ||
+            !sameColor(x.backgroundColor, y.backgroundColor) || x.category != y.category ||
+            x.description != y.description || x.origin != y.origin || x.discoveryHint != y.discoveryHint ||
+            x.maxBonds != y.maxBonds || x.electronegativity != y.electronegativity ||
+            x.bondingSlots.size() != y.bondingSlots.size()) return false;
+        for (size_t s = 0; s < x.bondingSlots.size(); s++) {
+            if (x.bondingSlots[s].x != y.bondingSlots[s].x || x.bondingSlots[s].y != y.bondingSlots[s].y ||
+                x.bondingSlots[s].z != y.bondingSlots[s].z) return false;
+        }
+    }
+    return true;
+}
+
+static bool sameMolecules(const std::vector<Molecule>& a, const std::vector<Molecule>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].id != b[i].id || a[i].name != b[i].name || a[i].formula != b[i].formula ||
+            a[i].category != b[i].category || a[i].description != b[i].description ||
+            a[i].biologicalSignificance != b[i].biologicalSignificance || a[i].origin != b[i].origin ||
+            !sameColor(a[i].color, b[i].color) || a[i].composition != b[i].composition) return false;
+    }
+    return true;
+}
+
+static bool sameMissions(const std::vector<Mission>& a, const std::vector<Mission>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].id != b[i].id || a[i].title != b[i].title || a[i].description != b[i].description ||
+            a[i].scientificContext != b[i].scientificContext || a[i].reward != b[i].reward ||
+            a[i].tier != b[i].tier || a[i].status != b[i].status) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== DATA PACK TESTS ===" << std::endl << std::endl;
+
+    // Work on a copy so the staleness test can touch the sources
+    fs::path dir = fs::temp_directory_path() / "lifesim_pack_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    for (const auto& entry : fs::directory_iterator("data")) {
+        if (entry.path().extension() == ".json") fs::copy_file(entry.path(), dir / entry.path().filename());
+    }
+    const std::string dataDir = dir.string();
+    const std::string packPath = (dir / "game.pack").string();
+
+    std::string error;
+    bool built = DataPack::build(dataDir, packPath, error);
+    DataPack pack;
+    bool opened = built && pack.open(packPath, dataDir);
+
+    TEST(Pack_Matches_JsonLoader_For_Every_Language) {
+        bool ok = opened && pack.hasLanguage("en") && pack.hasLanguage("es") && !pack.hasLanguage("xx");
+        for (const char* lang : { "en", "es" }) {
+            if (!ok) break;
+            ok = sameElements(pack.loadElements(lang), JsonLoader::loadElements(dataDir + "/elements.json", lang)) &&
+                 sameMolecules(pack.loadMolecules(lang), JsonLoader::loadMolecules(dataDir + "/molecules.json", lang)) &&
+                 sameMissions(pack.loadMissions(lang), JsonLoader::loadMissions(dataDir + "/missions.json", lang));
+        }
+        if (ok) {
+            std::vector<StructureDefinition> a = pack.loadStructures();
+            std::vector<StructureDefinition> b = JsonLoader::loadStructures(dataDir + "/structures.json");
+            ok = a.size() == b.size();
+            for (size_t i = 0; ok && i < a.size(); i++) {
+                ok = a[i].name == b[i].name && a[i].atomCount == b[i].atomCount && a[i].graph.valid &&
+                     a[i].graph.labels == b[i].graph.labels && a[i].graph.edges == b[i].graph.edges &&
+                     a[i].graph.canonicalHash == b[i].graph.canonicalHash && a[i].targetAngle == b[i].targetAngle;
+            }
+        }
+        if (ok) { PASS } else { FAIL("built=" << built << " opened=" << opened << " " << error) }
+    }
+
+    TEST(Ui_Strings_Match_Lang_Files) {
+        bool ok = opened;
+        for (const char* lang : { "en", "es" }) {
+            if (!ok) break;
+            std::ifstream in(dataDir + "/lang_" + lang + ".json");
+            nlohmann::json file;
+            in >> file;
+            std::unordered_map<std::string, std::string> strings;
+            ok = pack.loadStrings(lang, strings) && strings.size() >= file.size();
+            for (auto it = file.begin(); ok && it != file.end(); ++it) {
+                auto found = strings.find(it.key());
+                ok = found != strings.end() && found->second == it.value().get<std::string>();
+            }
+        }
+        std::unordered_map<std::string, std::string> en, es;
+        ok = ok && pack.loadStrings("en", en) && pack.loadStrings("es", es) &&
+             en["ui.label.complex_cluster"] != es["ui.label.complex_cluster"];
+        if (ok) { PASS } else { FAIL("A UI string differs from its lang file") }
+    }
+
+    TEST(Relocalize_Matches_Fresh_Decode_And_Keeps_Progress) {
+        bool ok = opened;
+        if (ok) {
+            std::vector<Element> slots(120);
+            for (const Element& el : pack.loadElements("en")) slots[el.atomicNumber] = el;
+            std::vector<Molecule> molecules = pack.loadMolecules("en");
+            std::vector<Mission> missions = pack.loadMissions("en");
+            if (!missions.empty()) missions[0].status = MissionStatus::COMPLETED;
+            ok = pack.relocalize(slots, "es") && pack.relocalize(molecules, "es") && pack.relocalize(missions, "es") &&
+                 !pack.relocalize(molecules, "xx");
+
+            std::vector<Element> relocalized;
+            for (const Element& el : pack.loadElements("es")) relocalized.push_back(slots[el.atomicNumber]);
+            std::vector<Mission> expected = pack.loadMissions("es");
+            if (!expected.empty()) expected[0].status = MissionStatus::COMPLETED;
+            ok = ok && sameElements(relocalized, pack.loadElements("es")) &&
+                 sameMolecules(molecules, pack.loadMolecules("es")) && sameMissions(missions, expected);
+        }
+        if (ok) { PASS } else { FAIL("Relocalized records differ from a fresh decode") }
+    }
+
+    TEST(Truncated_Pack_Is_Rejected) {
+        std::string truncated = (dir / "truncated.pack").string();
+        fs::copy_file(packPath, truncated);
+        fs::resize_file(truncated, fs::file_size(truncated) - 16);
+        DataPack broken;
+        bool ok = !broken.open(truncated, dataDir) && !broken.isOpen() && !broken.hasLanguage("en") &&
+                  broken.loadElements("en").empty();
+        if (ok) { PASS } else { FAIL("Truncated pack was accepted") }
+    }
+
+    TEST(Stale_Pack_Falls_Back_To_Json) {
+        pack.close();
+        {
+            std::ofstream touch(dataDir + "/missions.json", std::ios::app);
+            touch << "\n";
+        }
+        DataPack stale;
+        bool rejected = !stale.open(packPath, dataDir);
+        bool rebuilt = DataPack::build(dataDir, packPath, error) && stale.open(packPath, dataDir);
+        bool ok = rejected && rebuilt && stale.covers(dataDir + "/structures.json") && !stale.covers("other/structures.json");
+        if (ok) { PASS } else { FAIL("rejected=" << rejected << " rebuilt=" << rebuilt) }
+    }
+
+    fs::remove_all(dir);
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
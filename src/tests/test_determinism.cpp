@@ -0,0 +1,128 @@
+/**
+ * test_determinism.cpp
+ *
+ * Phase 55: Deterministic mode and per-tick state hashing.
+ * Two seeded runs of the full world (with bonds forced early, so topology
+ * versions are hashed) must produce identical hash sequences;
+ * a one-ulp nudge must be caught on the tick it happens and traced to the
+ * nudged atom; the cached (incremental) digest must equal a full recompute.
+ *
+ * Usage: ./test_determinism.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+#include "../ecs/World.hpp"
+#include "../ecs/StateHasher.hpp"
+#include "../core/SimulationState.hpp"
+#include "../physics/PhysicsEngine.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+const int TICKS = 120;
+const int NUDGE_TICK = 60;
+const int NUDGE_ENTITY = 17;
+const int BOND_TICK = 5;
+
+// One seeded run; optionally nudges an atom by one ulp just before hashing NUDGE_TICK
+std::vector<StateHash> run(bool nudge, const char* logPath, World* finalWorld = nullptr) {
+    SimulationState::getInstance().seed(1234);
+    World world;
+    world.initialize();
+    PhysicsEngine physics;
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    StateHasher hasher;
+    if (logPath) hasher.openLog(logPath);
+
+    std::vector<StateHash> hashes;
+    for (int t = 0; t < TICKS; t++) {
+        physics.step(Config::FIXED_DELTA_TIME, world.transforms, world.atoms, world.states, db, -1);
+        BondingSystem::updateHierarchy(world.transforms, world.states, world.atoms);
+        if (t == BOND_TICK) {
+            // Advances the topology clock; runs in one process must still hash alike
+            for (int i = 1; i + 1 < 12; i += 2) {
+                BondingSystem::tryBond(i, i + 1, world.states, world.atoms, world.transforms, true);
+            }
+        }
+        if (nudge && t == NUDGE_TICK) {
+            float& x = world.transforms[NUDGE_ENTITY].x;
+            x = std::nextafter(x, x + 1.0f);
+        }
+        hashes.push_back(hasher.update(world));
+        if (finalWorld && t == NUDGE_TICK) *finalWorld = world;
+    }
+    hasher.close();
+    return hashes;
+}
+
+int main() {
+    std::cout << "=== DETERMINISM TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+    StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+
+    World worldA, worldB;
+    std::vector<StateHash> a = run(false, "test_hash_a.bin", &worldA);
+    std::vector<StateHash> b = run(false, "test_hash_b.bin");
+    std::vector<StateHash> c = run(true, "test_hash_c.bin", &worldB);
+
+    TEST(Seeded_Runs_Are_Identical) {
+        bool same = a.size() == b.size();
+        for (size_t i = 0; same && i < a.size(); i++) same = a[i] == b[i];
+        bool logsAgree = StateHasher::compareLogs("test_hash_a.bin", "test_hash_b.bin") == -1;
+        if (same && logsAgree) { PASS } else { FAIL("Two runs with the same seed diverged") }
+    }
+
+    TEST(Divergence_Found_At_Nudged_Tick) {
+        long long tick = StateHasher::compareLogs("test_hash_a.bin", "test_hash_c.bin");
+        bool onlyTransforms = c[NUDGE_TICK].transforms != a[NUDGE_TICK].transforms &&
+                              c[NUDGE_TICK].atoms == a[NUDGE_TICK].atoms && c[NUDGE_TICK].states == a[NUDGE_TICK].states;
+        int entity = StateHasher::findFirstDifference(worldA, worldB);
+        if (tick == NUDGE_TICK && onlyTransforms && entity == NUDGE_ENTITY) { PASS }
+        else { FAIL("Expected tick " << NUDGE_TICK << "/entity " << NUDGE_ENTITY << ", got tick " << tick << "/entity " << entity) }
+    }
+
+    TEST(Reference_Check_Reports_Divergence) {
+        SimulationState::getInstance().seed(1234);
+        World world;
+        world.initialize();
+        StateHasher hasher;
+        hasher.loadReference("test_hash_a.bin");
+        hasher.update(world);  // Tick 0 without the physics step: must not match
+        bool caught = hasher.getDivergenceTick() == 0;
+        if (caught) { PASS } else { FAIL("Live comparison missed a mismatch") }
+    }
+
+    TEST(Cached_Digest_Matches_Full_Recompute) {
+        SimulationState::getInstance().seed(99);
+        World world;
+        world.initialize();
+        StateHasher hasher;
+        bool ok = true;
+        for (int i = 1; i + 1 < 40; i += 2) {
+            BondingSystem::tryBond(i, i + 1, world.states, world.atoms, world.transforms, true);
+            if (hasher.update(world) != StateHasher::compute(world)) ok = false;
+        }
+        if (ok) { PASS } else { FAIL("Cached child-list hashes went stale") }
+    }
+
+    std::remove("test_hash_a.bin");
+    std::remove("test_hash_b.bin");
+    std::remove("test_hash_c.bin");
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
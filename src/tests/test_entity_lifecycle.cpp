@@ -0,0 +1,97 @@
+/**
+ * test_entity_lifecycle.cpp
+ *
+ * Phase 51: Spawn/despawn with generational handles and compaction.
+ * Verifies slot reuse through the free-list, stale-handle detection, and that
+ * compaction keeps bonds, molecule ids and handles pointing at the same atoms.
+ *
+ * Usage: ./test_entity_lifecycle.exe
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "../ecs/World.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+TransformComponent at(float x) { return {x, 0, 0, 0, 0, 0, 0}; }
+
+int main() {
+    std::cout << "=== ENTITY LIFECYCLE TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+
+    TEST(Despawn_Reuses_Slot_And_Invalidates_Handle) {
+        World world;
+        world.spawn(at(0), 1);  // Player
+        EntityHandle a = world.spawn(at(200), 6);
+        EntityHandle b = world.spawn(at(400), 8);
+        int slotA = world.resolve(a);
+        world.despawn(a);
+        EntityHandle c = world.spawn(at(600), 7);
+        bool reused = world.resolve(c) == slotA && world.getEntityCount() == 3;
+        bool stale = world.resolve(a) == -1 && world.resolve(b) == 2;
+        if (reused && stale) { PASS } else { FAIL("Slot not reused or stale handle still resolves") }
+    }
+
+    TEST(Player_Cannot_Be_Despawned) {
+        World world;
+        EntityHandle player = world.spawn(at(0), 1);
+        bool refused = !world.despawn(player) && world.resolve(player) == 0;
+        if (refused) { PASS } else { FAIL("Player slot was released") }
+    }
+
+    TEST(Despawn_Detaches_From_Molecule) {
+        World world;
+        world.spawn(at(0), 1);
+        EntityHandle o = world.spawn(at(200), 8);
+        EntityHandle h = world.spawn(at(220), 1);
+        BondingSystem::tryBond(world.resolve(h), world.resolve(o), world.states, world.atoms, world.transforms, true);
+        bool bonded = world.states[world.resolve(h)].parentEntityId == world.resolve(o);
+        int oId = world.resolve(o);
+        world.despawn(h);
+        bool detached = world.states[oId].childList.empty() && !world.states[oId].isClustered;
+        if (bonded && detached) { PASS } else { FAIL("Despawned atom left a dangling bond") }
+    }
+
+    TEST(Compaction_Remaps_Links_And_Handles) {
+        World world;
+        world.spawn(at(0), 1);
+        std::vector<EntityHandle> handles;
+        for (int i = 0; i < 40; i++) handles.push_back(world.spawn(at(200.0f + i * 200.0f), (i % 2) ? 1 : 8));
+
+        // Bond pairs (H onto O) at the end of the array, then kill every slot in the first half
+        for (int i = 21; i < 40; i += 2) {
+            BondingSystem::tryBond(world.resolve(handles[i]), world.resolve(handles[i - 1]), world.states, world.atoms, world.transforms, true);
+        }
+        for (int i = 0; i < 20; i++) world.despawn(handles[i]);
+
+        std::vector<int> remap = world.compact();
+        bool sized = world.getEntityCount() == 21 && world.getDeadCount() == 0 && remap.size() == 41;
+
+        bool linksOk = true;
+        for (int i = 21; i < 40; i += 2) {
+            int h = world.resolve(handles[i]);
+            int o = world.resolve(handles[i - 1]);
+            if (h < 0 || o < 0 || world.states[h].parentEntityId != o) linksOk = false;
+            if (o >= 0 && (world.states[o].childList.size() != 1 || world.states[o].childList[0] != h)) linksOk = false;
+            if (h >= 0 && o >= 0 && world.states[h].moleculeId != world.states[o].moleculeId) linksOk = false;
+            if (h >= 0 && world.atoms[h].atomicNumber != 1) linksOk = false;
+        }
+        bool deadGone = world.resolve(handles[0]) == -1 && remapEntityIndex(remap, 0) == 0;
+        if (sized && linksOk && deadGone) { PASS } else { FAIL("Compaction broke links or handles") }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+/**
+ * test_hierarchy_index.cpp
+ *
+ * Phase 70: Binary-lifting LCA and distance queries.
+ * Distances on a 1,000-atom chain must be exact (the old walk capped depth at
+ * 100), ring closure at the far end of a long polymer must succeed, queries
+ * must agree with a naive parent-chain walk after random bond churn, and a
+ * restored (older) state vector must be detected and re-indexed.
+ *
+ * Usage: ./test_hierarchy_index.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "../ecs/components.hpp"
+#include "../ecs/HierarchyIndex.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+#include "../core/MathUtils.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+std::vector<TransformComponent> transforms;
+std::vector<AtomComponent> atoms;
+std::vector<StateComponent> states;
+
+// Free atoms on a line, spaced beyond bonding range
+void setupAtoms(int count, int element) {
+    transforms.clear(); atoms.clear(); states.clear();
+    for (int i = 0; i < count; i++) {
+        transforms.push_back({(float)i * 200.0f, 0, 0, 0, 0, 0, 0});
+        atoms.push_back({element, 0.0f});
+        StateComponent s;
+        s.moleculeId = i;
+        states.push_back(s);
+    }
+}
+
+// Carbon chain 0 <- 1 <- ... <- count-1 (tryBond picks the nearest host, the previous atom)
+void buildChain(int count) {
+    setupAtoms(count, 6);
+    for (int k = 1; k < count; k++) BondingSystem::tryBond(k, k - 1, states, atoms, transforms, true);
+}
+
+// Reference: first shared atom of the two parent chains
+int naiveDistance(int i, int j) {
+    std::vector<int> chainI;
+    for (int c = i; c != -1; c = states[c].parentEntityId) chainI.push_back(c);
+    int stepsJ = 0;
+    for (int c = j; c != -1; c = states[c].parentEntityId, stepsJ++) {
+        for (int k = 0; k < (int)chainI.size(); k++) {
+            if (chainI[k] == c) return k + stepsJ;
+        }
+    }
+    return -1;
+}
+
+int main() {
+    std::cout << "=== HIERARCHY INDEX TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+    StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+    HierarchyIndex& index = HierarchyIndex::getInstance();
+
+    TEST(Deep_Chain_Has_No_Depth_Cap) {
+        buildChain(1000);
+        int ends = MathUtils::getHierarchyDistance(0, 999, states);
+        int mid = MathUtils::getHierarchyDistance(999, 500, states);
+        int lca = index.lca(999, 500, states);
+        int depth = index.getDepth(999, states);
+        if (ends == 999 && mid == 499 && lca == 500 && depth == 999) { PASS }
+        else { FAIL("ends=" << ends << " mid=" << mid << " lca=" << lca << " depth=" << depth) }
+    }
+
+    TEST(Ring_Closes_On_Long_Polymer) {
+        buildChain(1000);
+        int before = index.getRebuildCount();
+        BondError result = BondingSystem::tryCycleBond(994, 999, states, atoms, transforms);
+        bool ring = states[999].isInRing && states[994].ringSize == 6 && states[999].cycleBondId == 994;
+        // The table was current from the last attach: the closure query did not rebuild it
+        bool noRebuild = index.getRebuildCount() == before + 1;  // +1: propagation after linking
+        if (result == BondError::SUCCESS && ring && noRebuild) { PASS }
+        else { FAIL("result=" << (int)result << " ring=" << ring << " rebuilds=" << index.getRebuildCount() - before) }
+    }
+
+    TEST(Matches_Naive_Walk_After_Churn) {
+        std::srand(70);
+        setupAtoms(120, 6);
+        bool ok = true;
+        for (int round = 0; round < 400 && ok; round++) {
+            int a = std::rand() % (int)states.size();
+            int b = std::rand() % (int)states.size();
+            if (std::rand() % 3 == 0) BondingSystem::breakBond(a, states, atoms);
+            else if (a != b && states[a].parentEntityId == -1 && states[a].childList.empty())
+                BondingSystem::tryBond(a, b, states, atoms, transforms, true);
+            int x = std::rand() % (int)states.size();
+            int y = std::rand() % (int)states.size();
+            ok = MathUtils::getHierarchyDistance(x, y, states) == naiveDistance(x, y);
+        }
+        if (ok) { PASS } else { FAIL("Distance disagrees with the parent-chain walk") }
+    }
+
+    TEST(Restored_States_Are_Reindexed) {
+        buildChain(50);
+        std::vector<StateComponent> saved = states;  // Like an undo checkpoint
+        BondingSystem::breakBond(25, states, atoms);
+        BondingSystem::tryBond(25, 10, states, atoms, transforms, true);
+        int moved = MathUtils::getHierarchyDistance(0, 49, states);
+        states = saved;
+        int restored = MathUtils::getHierarchyDistance(0, 49, states);
+        if (moved == naiveDistance(0, 49) && restored == 49) { PASS }
+        else { FAIL("moved=" << moved << " restored=" << restored) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+/**
+ * test_hierarchy_ops.cpp
+ *
+ * Phase 69: Hierarchy operations on the childList adjacency.
+ * Leaf search and last-child must follow bond order without scanning the
+ * world, isolation must leave parentEntityId and childList agreeing, and a
+ * stress break or a re-dock must unlink the child from its old parent's list and slots.
+ *
+ * Usage: ./test_hierarchy_ops.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "../ecs/components.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../physics/MolecularHierarchy.hpp"
+#include "../physics/PhysicsEngine.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+#include "../core/Config.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+std::vector<TransformComponent> transforms;
+std::vector<AtomComponent> atoms;
+std::vector<StateComponent> states;
+
+// Free atoms on a line, spaced beyond bonding range
+void setupAtoms(const std::vector<int>& elements) {
+    transforms.clear(); atoms.clear(); states.clear();
+    for (size_t i = 0; i < elements.size(); i++) {
+        transforms.push_back({(float)i * 200.0f, 0, 0, 0, 0, 0, 0});
+        atoms.push_back({elements[i], 0.0f});
+        StateComponent s;
+        s.moleculeId = (int)i;
+        states.push_back(s);
+    }
+}
+
+int main() {
+    std::cout << "=== HIERARCHY OPERATION TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    db.reload();
+    StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+
+    TEST(Leaf_Search_Follows_Bond_Order) {
+        // 0 = C root; 2 then 1 then 3 bond to it; 4 bonds under 3
+        setupAtoms({6, 1, 6, 6, 1});
+        // tryBond picks the nearest host in the molecule, so lay the atoms out around 0
+        transforms[1].x = 0.0f;   transforms[1].y = -300.0f;
+        transforms[2].x = 0.0f;   transforms[2].y = 300.0f;
+        transforms[3].x = 300.0f;
+        transforms[4].x = 600.0f;
+        BondingSystem::tryBond(2, 0, states, atoms, transforms, true);
+        BondingSystem::tryBond(1, 0, states, atoms, transforms, true);
+        BondingSystem::tryBond(3, 0, states, atoms, transforms, true);
+        BondingSystem::tryBond(4, 3, states, atoms, transforms, true);
+        int last = BondingSystem::findLastChild(0, states);
+        int leaf = BondingSystem::findPrunableLeaf(0, states);  // 3 has a child, so 1 is the newest leaf
+        int none = BondingSystem::findPrunableLeaf(4, states);
+        if (last == 3 && leaf == 1 && none == -1) { PASS }
+        else { FAIL("last=" << last << " leaf=" << leaf << " none=" << none) }
+    }
+
+    TEST(Isolation_Keeps_Adjacency_Consistent) {
+        // Random trees, then isolate random atoms; the links must agree after every step
+        std::srand(69);
+        std::vector<int> elements(40);
+        for (int& e : elements) e = (std::rand() % 2) ? 6 : 1;
+        setupAtoms(elements);
+        for (int k = 1; k < (int)states.size(); k++) {
+            int target = std::rand() % k;
+            if (states[k].parentEntityId == -1) BondingSystem::tryBond(k, target, states, atoms, transforms, true);
+        }
+        bool ok = MolecularHierarchy::verifyAdjacency(states);
+        int isolated = 0;
+        for (int step = 0; ok && step < 20; step++) {
+            int idx = std::rand() % (int)states.size();
+            std::vector<int> neighbours = states[idx].childList;
+            if (states[idx].parentEntityId != -1) neighbours.push_back(states[idx].parentEntityId);
+            BondingSystem::breakAllBonds(idx, states, atoms);
+            for (int n : neighbours) {
+                if (states[n].isClustered) BondingSystem::propagateMoleculeId(n, states);
+            }
+            ok = MolecularHierarchy::verifyAdjacency(states) && states[idx].childList.empty() &&
+                 states[idx].parentEntityId == -1 && states[idx].moleculeId == idx;
+            isolated++;
+        }
+        if (ok) { PASS } else { FAIL("Adjacency broken after " << isolated << " isolations") }
+    }
+
+    TEST(Stress_Break_Unlinks_Parent) {
+        // Index 0 is the player, whose molecule is exempt from stress breaks
+        setupAtoms({1, 6, 1});
+        BondingSystem::tryBond(2, 1, states, atoms, transforms, true);
+        transforms[2].x = transforms[1].x + Config::BOND_BREAK_STRESS * 4.0f;
+        PhysicsEngine physics;
+        physics.step(Config::FIXED_DELTA_TIME, transforms, atoms, states, db, -1);
+        bool unlinked = states[2].parentEntityId == -1 && states[1].childList.empty() &&
+                        states[1].childCount == 0 && states[1].occupiedSlots == 0;
+        if (unlinked && MolecularHierarchy::verifyAdjacency(states) && states[2].moleculeId == 2) { PASS }
+        else { FAIL("parent=" << states[2].parentEntityId << " children=" << states[1].childList.size()
+                    << " slots=" << states[1].occupiedSlots) }
+    }
+
+    TEST(Redock_Unlinks_Old_Parent) {
+        // 1 docks under 0, then (still docking) bonds to 2: 0 must lose it entirely
+        setupAtoms({6, 1, 6});
+        BondingSystem::tryBond(1, 0, states, atoms, transforms, true);
+        BondingSystem::tryBond(1, 2, states, atoms, transforms, true);
+        bool unlinked = states[1].parentEntityId == 2 && states[0].childList.empty() &&
+                        states[0].childCount == 0 && states[0].occupiedSlots == 0;
+        bool split = states[0].moleculeId == 0 && states[1].moleculeId == 1 && states[2].moleculeId == 1;
+        if (unlinked && split && MolecularHierarchy::verifyAdjacency(states)) { PASS }
+        else { FAIL("parent=" << states[1].parentEntityId << " oldChildren=" << states[0].childList.size()
+                    << " mol0=" << states[0].moleculeId << " mol2=" << states[2].moleculeId) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
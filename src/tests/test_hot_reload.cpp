@@ -0,0 +1,157 @@
+/**
+ * test_hot_reload.cpp
+ *
+ * Phase 64: Data hot-reload.
+ * Only changed files are parsed, nothing reaches the databases before
+ * applyPending() (the tick boundary), edits land in place (element slots and
+ * structure offsets refreshed, no rebuild), broken files keep the old data,
+ * and the watch thread picks edits up on its own.
+ *
+ * Usage: ./test_hot_reload.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <chrono>
+
+#include "../core/HotReloader.hpp"
+#include "../core/JsonLoader.hpp"
+#include "../core/LocalizationManager.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+namespace fs = std::filesystem;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+static nlohmann::json readJson(const std::string& path) {
+    std::ifstream in(path);
+    nlohmann::json j;
+    in >> j;
+    return j;
+}
+
+// Different indentation each time, so the size changes even if the clock is coarse
+static void writeJson(const std::string& path, const nlohmann::json& j, int indent) {
+    std::ofstream out(path, std::ios::trunc);
+    out << j.dump(indent);
+}
+
+static const StructureDefinition* findStructure(const std::string& name) {
+    for (const auto& s : StructureRegistry::getInstance().getAllStructures()) {
+        if (s.name == name) return &s;
+    }
+    return nullptr;
+}
+
+int main() {
+    std::cout << "=== HOT RELOAD TESTS ===" << std::endl << std::endl;
+
+    fs::path dir = fs::temp_directory_path() / "lifesim_hot_reload_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    for (const auto& entry : fs::directory_iterator("data")) {
+        if (entry.path().extension() == ".json") fs::copy_file(entry.path(), dir / entry.path().filename());
+    }
+    const std::string structuresPath = (dir / "structures.json").string();
+    const std::string elementsPath = (dir / "elements.json").string();
+    const std::string moleculesPath = (dir / "molecules.json").string();
+
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    StructureRegistry& registry = StructureRegistry::getInstance();
+    registry.loadFromDisk("data/structures.json");
+
+    HotReloader reloader;
+    reloader.watch(dir.string());
+
+    TEST(Unchanged_Files_Are_Not_Parsed) {
+        reloader.poll();
+        bool ok = reloader.applyPending() == 0 && reloader.getStats().filesParsed == 0;
+        if (ok) { PASS } else { FAIL("A file was parsed without changing") }
+    }
+
+    TEST(Structure_Edit_Applies_At_Tick_Boundary) {
+        nlohmann::json j = readJson(structuresPath);
+        j["structures"][0]["damping"] = 0.33;
+        j["structures"][0]["rotationOffset"] = 0.0;
+        writeJson(structuresPath, j, 2);
+        int generation = registry.getGeneration();
+        reloader.poll();
+        const StructureDefinition* before = findStructure("carbon_hexagon");
+        bool untouched = before && before->damping != 0.33f && registry.getGeneration() == generation;
+        uint32_t applied = reloader.applyPending();
+        const StructureDefinition* after = findStructure("carbon_hexagon");
+        bool ok = untouched && applied == HotReloader::STRUCTURES && after && after->damping == 0.33f &&
+                  registry.getGeneration() == generation + 1 && after->idealOffsets.size() == 6 &&
+                  after->idealOffsets[0].y == 0.0f && after->idealOffsets[0].x > 0.0f;
+        if (ok) { PASS } else { FAIL("untouched=" << untouched << " applied=" << applied) }
+    }
+
+    TEST(Element_Slots_Refresh_In_Place) {
+        const Element* carbon = &db.getElement(6);
+        nlohmann::json j = readJson(elementsPath);
+        for (auto& el : j["elements"]) {
+            if (el["atomicNumber"] == 6) {
+                el["electronegativity"] = 2.75;
+                el["bondingSlots"][0] = { { "x", 1 }, { "y", 0 }, { "z", 0.3 } };
+            }
+        }
+        writeJson(elementsPath, j, 3);
+        reloader.poll();
+        std::vector<Element> expected = JsonLoader::loadElements(elementsPath, LocalizationManager::getInstance().getLanguageCode());
+        Vector3 slot{};
+        for (const Element& el : expected) if (el.atomicNumber == 6) slot = el.bondingSlots[0];
+        uint32_t applied = reloader.applyPending();
+        const Element& now = db.getElement(6);
+        bool ok = applied == HotReloader::ELEMENTS && &now == carbon && now.electronegativity == 2.75f &&
+                  now.bondingSlots[0].x == slot.x && now.bondingSlots[0].z == slot.z && db.getElement("C").atomicNumber == 6;
+        if (ok) { PASS } else { FAIL("applied=" << applied << " en=" << now.electronegativity) }
+    }
+
+    TEST(Broken_File_Keeps_Old_Data) {
+        size_t molecules = db.getAllMolecules().size();
+        {
+            std::ofstream out(moleculesPath, std::ios::trunc);
+            out << "{ \"molecules\": [ { \"id\": ";  // Caught mid-save
+        }
+        reloader.poll();
+        HotReloadStats stats = reloader.getStats();
+        bool ok = reloader.applyPending() == 0 && stats.parseFailures == 1 && db.getAllMolecules().size() == molecules;
+        fs::copy_file("data/molecules.json", moleculesPath, fs::copy_options::overwrite_existing);
+        reloader.poll();
+        ok = ok && reloader.applyPending() == HotReloader::MOLECULES && db.getAllMolecules().size() == molecules;
+        if (ok) { PASS } else { FAIL("parseFailures=" << stats.parseFailures) }
+    }
+
+    TEST(Watch_Thread_Picks_Up_Edits) {
+        reloader.start(dir.string());
+        nlohmann::json j = readJson(structuresPath);
+        j["structures"][0]["formationSpeed"] = 1.25;
+        writeJson(structuresPath, j, 4);
+        uint32_t applied = 0;
+        for (int i = 0; i < 100 && !applied; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            applied = reloader.applyPending();  // What the fixed-step loop does
+        }
+        reloader.stop();
+        const StructureDefinition* s = findStructure("carbon_hexagon");
+        bool ok = applied == HotReloader::STRUCTURES && s && s->formationSpeed == 1.25f;
+        if (ok) { PASS } else { FAIL("No update within 5 s") }
+    }
+
+    fs::remove_all(dir);
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+/**
+ * test_localization.cpp
+ *
+ * Phase 62: Interned, lock-free string table.
+ * LocIds must be stable across language swaps, lookups must translate
+ * through the active table, views handed out before a swap must stay valid,
+ * keys missing from every file must translate to themselves, switching back
+ * to a language must reuse its table, and readers
+ * running during swaps must always see a complete table.
+ *
+ * Usage: ./test_localization.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include "../core/LocalizationManager.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+int main() {
+    std::cout << "=== LOCALIZATION TESTS ===" << std::endl << std::endl;
+    LocalizationManager& lm = LocalizationManager::getInstance();
+    lm.setLanguage("en");
+
+    TEST(Interned_Ids_Translate_And_Stay_Stable) {
+        LocId id = lm.intern("ui.label.complex_cluster");
+        std::string en(lm.view(id));
+        lm.setLanguage("es");
+        std::string es(lm.view(id));
+        bool ok = lm.intern("ui.label.complex_cluster") == id && LOC_ID("ui.label.complex_cluster") == id &&
+                  en == "Complex Cluster" && es != en && es == lm.get("ui.label.complex_cluster");
+        lm.setLanguage("en");
+        if (ok) { PASS } else { FAIL("en='" << en << "' es='" << es << "'") }
+    }
+
+    TEST(Views_Survive_Language_Swap) {
+        const char* before = LOC("ui.label.complex_cluster");
+        std::string copy = before;
+        lm.setLanguage("es");
+        bool ok = copy == before && std::string(LOC("ui.label.complex_cluster")) != copy;
+        lm.setLanguage("en");
+        if (ok) { PASS } else { FAIL("Earlier C string changed or was freed") }
+    }
+
+    TEST(Unknown_Key_Falls_Back_To_Key) {
+        LocId id = lm.intern("ui.test.not_in_any_file");
+        bool ok = lm.view(id) == "ui.test.not_in_any_file" && lm.get("ui.test.other_missing") == "ui.test.other_missing";
+        lm.setLanguage("es");
+        ok = ok && lm.view(id) == "ui.test.not_in_any_file";
+        lm.setLanguage("en");
+        if (ok) { PASS } else { FAIL("Missing key did not translate to itself") }
+    }
+
+    TEST(Revisited_Language_Reuses_Its_Table) {
+        LocId id = lm.intern("ui.label.complex_cluster");
+        lm.setLanguage("es");
+        lm.setLanguage("en");
+        const char* first = lm.text(id);
+        lm.setLanguage("es");
+        lm.setLanguage("en");
+        bool ok = lm.text(id) == first;  // Same table, not a rebuilt copy
+        LocId fresh = lm.intern("ui.test.interned_while_english");
+        lm.setLanguage("es");
+        ok = ok && lm.view(fresh) == "ui.test.interned_while_english" && lm.text(id) != first &&
+             std::string(lm.text(id)) != std::string(first);
+        lm.setLanguage("en");
+        ok = ok && std::string(lm.text(id)) == first;
+        if (ok) { PASS } else { FAIL("Switching back rebuilt the table or mixed languages") }
+    }
+
+    TEST(Readers_See_Complete_Tables_During_Swaps) {
+        LocId id = lm.intern("ui.label.complex_cluster");
+        std::string en(lm.view(id));
+        lm.setLanguage("es");
+        std::string es(lm.view(id));
+        std::atomic<bool> stop{false};
+        std::atomic<long long> bad{0}, reads{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; t++) {
+            readers.emplace_back([&]() {
+                while (!stop.load()) {
+                    std::string_view v = lm.view(id);
+                    if (v != en && v != es) bad++;
+                    reads++;
+                }
+            });
+        }
+        while (reads.load() < 1000) std::this_thread::yield();  // Swap only while readers are running
+        for (int k = 0; k < 40; k++) lm.setLanguage(k % 2 ? "es" : "en");
+        stop = true;
+        for (auto& r : readers) r.join();
+        lm.setLanguage("en");
+        if (bad == 0 && reads > 0) { PASS } else { FAIL(bad << " torn reads of " << reads) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/**
+ * test_lod_impostors.cpp
+ *
+ * Phase 60: Zoomed-out level of detail.
+ * Impostors must cover every atom of their molecule and take the colour of
+ * its most common element; between rebuilds a frame may only recentre a
+ * 1/LOD_IMPOSTOR_REFRESH_FRAMES slice of the molecules, yet every impostor
+ * catches up within that many frames. The density overview must account for
+ * every entity through per-cell counts.
+ *
+ * Usage: ./test_lod_impostors.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include "../rendering/MoleculeImpostors.hpp"
+#include "../physics/SpatialGrid.hpp"
+#include "../physics/TopologyEvents.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../core/Config.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+struct Scene {
+    std::vector<TransformComponent> transforms;
+    std::vector<AtomComponent> atoms;
+    std::vector<StateComponent> states;
+
+    // Molecule of `size` atoms around (x, y): one carbon root, the rest hydrogen
+    void addMolecule(float x, float y, int size) {
+        int root = (int)states.size();
+        for (int k = 0; k < size; k++) {
+            transforms.push_back({ x + 12.0f * k, y + 5.0f * (k % 2), 0, 0, 0, 0, 0 });
+            atoms.push_back({ k == 0 ? 6 : 1, 0.0f });
+            StateComponent st;
+            st.moleculeId = (size > 1) ? root : -1;
+            states.push_back(st);
+        }
+    }
+};
+
+bool sameColor(Color a, Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+bool coversMembers(const MoleculeImpostor& m, const Scene& scene) {
+    for (int i = 0; i < (int)scene.states.size(); i++) {
+        int root = scene.states[i].moleculeId >= 0 ? scene.states[i].moleculeId : i;
+        if (root != m.root) continue;
+        float d = std::sqrt((scene.transforms[i].x - m.x) * (scene.transforms[i].x - m.x) +
+                            (scene.transforms[i].y - m.y) * (scene.transforms[i].y - m.y));
+        if (d > m.radius) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== LOD IMPOSTOR TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    db.reload();
+
+    TEST(One_Impostor_Per_Molecule) {
+        Scene scene;
+        scene.addMolecule(0, 0, 4);      // C + 3 H
+        scene.addMolecule(500, 0, 1);    // Free atom
+        scene.addMolecule(0, 500, 6);
+        MoleculeImpostors cache;
+        cache.update(scene.transforms, scene.atoms, scene.states);
+        const auto& list = cache.getImpostors();
+        bool ok = list.size() == 3;
+        for (const MoleculeImpostor& m : list) ok = ok && coversMembers(m, scene);
+        ok = ok && list[0].count == 4 && sameColor(list[0].color, db.getElement(1).color) &&
+             sameColor(list[1].color, db.getElement(6).color);
+        if (ok) { PASS } else { FAIL(list.size() << " impostors, or a member/colour is wrong") }
+    }
+
+    TEST(Recentre_Is_Amortised_Across_Frames) {
+        Scene scene;
+        for (int k = 0; k < 2000; k++) scene.addMolecule((k % 50) * 200.0f, (k / 50) * 200.0f, 5);
+        MoleculeImpostors cache;
+        cache.update(scene.transforms, scene.atoms, scene.states);
+        long long rebuilds = cache.getRebuilds();
+
+        for (auto& tr : scene.transforms) tr.x += 300.0f;
+        int maxAtoms = 0;
+        for (int f = 0; f < Config::LOD_IMPOSTOR_REFRESH_FRAMES; f++) {
+            cache.update(scene.transforms, scene.atoms, scene.states);
+            maxAtoms = std::max(maxAtoms, cache.getLastRecentredAtoms());
+        }
+        bool caughtUp = true;
+        for (const MoleculeImpostor& m : cache.getImpostors()) caughtUp = caughtUp && coversMembers(m, scene);
+        int slice = (2000 + Config::LOD_IMPOSTOR_REFRESH_FRAMES - 1) / Config::LOD_IMPOSTOR_REFRESH_FRAMES;
+        if (cache.getRebuilds() == rebuilds && maxAtoms <= slice * 5 && caughtUp) { PASS }
+        else { FAIL("rebuilds=" << cache.getRebuilds() - rebuilds << " maxAtoms=" << maxAtoms << " caughtUp=" << caughtUp) }
+    }
+
+    TEST(Topology_Change_Rebuilds_Within_Refresh_Window) {
+        Scene scene;
+        for (int k = 0; k < 100; k++) scene.addMolecule(k * 100.0f, 0, 3);
+        MoleculeImpostors cache;
+        cache.update(scene.transforms, scene.atoms, scene.states);
+
+        // Split molecule 0: its last atom becomes free
+        scene.states[2].moleculeId = -1;
+        TopologyEvents::getInstance().nextVersion();
+        int framesToRebuild = 0;
+        while (cache.getImpostors().size() != 101 && framesToRebuild <= Config::LOD_IMPOSTOR_REFRESH_FRAMES) {
+            cache.update(scene.transforms, scene.atoms, scene.states);
+            framesToRebuild++;
+        }
+        if (cache.getImpostors().size() == 101 && cache.getRebuilds() == 2) { PASS }
+        else { FAIL("Split not picked up after " << framesToRebuild << " frames") }
+    }
+
+    TEST(Density_Cells_Account_For_Every_Entity) {
+        std::vector<TransformComponent> transforms;
+        for (int y = 0; y < 150; y++) {
+            for (int x = 0; x < 150; x++) transforms.push_back({ x * 23.0f - 1700.0f, y * 23.0f - 1700.0f, 0, 0, 0, 0, 0 });
+        }
+        SpatialGrid grid(Config::GRID_CELL_SIZE);
+        grid.update(transforms);
+
+        std::vector<GridCellCount> cells;
+        grid.queryCellCounts({ -1.0e6f, -1.0e6f, 2.0e6f, 2.0e6f }, cells);
+        long long total = 0;
+        for (const GridCellCount& c : cells) total += c.count;
+
+        Rectangle view = { -300.0f, -200.0f, 640.0f, 360.0f };
+        std::vector<GridCellCount> viewCells;
+        std::vector<int> viewEntities;
+        grid.queryCellCounts(view, viewCells);
+        grid.queryRect(view, viewEntities);
+        long long inView = 0;
+        for (const GridCellCount& c : viewCells) inView += c.count;
+
+        bool ok = total == (long long)transforms.size() && cells.size() < transforms.size() / 10 &&
+                  inView == (long long)viewEntities.size();
+        if (ok) { PASS } else { FAIL("total=" << total << " cells=" << cells.size() << " inView=" << inView) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/**
+ * test_metrics.cpp
+ *
+ * Phase 66: Simulation metrics registry.
+ * Counters must not lose increments under concurrent writers, histogram
+ * quantiles must land in the right bucket, shards must merge to the same
+ * totals as direct observation, the hot-path hooks must count real events,
+ * and the exported file must be complete OpenMetrics-style text.
+ *
+ * Usage: ./test_metrics.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "../core/MetricsRegistry.hpp"
+#include "../physics/SpatialGrid.hpp"
+#include "../physics/TopologyEvents.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+namespace fs = std::filesystem;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+void testConcurrentCounters() {
+    TEST(ConcurrentCounters);
+    MetricsRegistry& metrics = MetricsRegistry::getInstance();
+    metrics.reset();
+    MetricCounter& custom = metrics.counter("test_events", "Test counter");
+
+    const int threads = 4;
+    const int perThread = 100000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < perThread; i++) custom.inc();
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    MetricCounter& again = metrics.counter("test_events", "Test counter");
+    if (custom.get() != (long long)threads * perThread) {
+        FAIL("expected " << threads * perThread << " got " << custom.get());
+    } else if (&again != &custom) {
+        FAIL("re-registering a name returned a different counter");
+    } else {
+        PASS;
+    }
+}
+
+void testHistogramQuantiles() {
+    TEST(HistogramQuantiles);
+    MetricHistogram h({1, 2, 4, 8});
+    for (int i = 0; i < 90; i++) h.observe(0.5);   // Bucket le=1
+    for (int i = 0; i < 9; i++) h.observe(3.0);    // Bucket le=4
+    h.observe(100.0);                              // +Inf
+
+    double p50 = h.quantile(0.5);
+    double p95 = h.quantile(0.95);
+    double p99 = h.quantile(0.99);
+    if (h.getCount() != 100 || h.getBucket(4) != 1) {
+        FAIL("count " << h.getCount() << " +Inf bucket " << h.getBucket(4));
+    } else if (p50 > 1.0 || p95 <= 2.0 || p95 > 4.0 || p99 <= 2.0 || p99 > 4.0) {
+        FAIL("p50=" << p50 << " p95=" << p95 << " p99=" << p99);
+    } else if (h.quantile(1.0) != 8.0) {
+        FAIL("+Inf observations should clamp to the last edge, got " << h.quantile(1.0));
+    } else {
+        PASS;
+    }
+}
+
+void testShardMerge() {
+    TEST(ShardMerge);
+    MetricHistogram direct({1, 10, 100});
+    MetricHistogram merged({1, 10, 100});
+    HistogramShard shard(merged);
+    for (int i = 0; i < 500; i++) {
+        double v = (double)(i % 150);
+        direct.observe(v);
+        shard.observe(v);
+    }
+    shard.merge(merged);
+    shard.merge(merged);  // Merging an empty shard adds nothing
+
+    bool same = direct.getCount() == merged.getCount() && direct.getSum() == merged.getSum();
+    for (size_t i = 0; i <= 3; i++) same = same && direct.getBucket(i) == merged.getBucket(i);
+    if (same) { PASS; } else { FAIL("sharded totals differ from direct observation"); }
+}
+
+void testHotPathHooks() {
+    TEST(HotPathHooks);
+    MetricsRegistry& metrics = MetricsRegistry::getInstance();
+    metrics.reset();
+
+    // 3 atoms in one cell, 1 in another
+    std::vector<TransformComponent> transforms(4);
+    transforms[0].x = 10;  transforms[0].y = 10;
+    transforms[1].x = 20;  transforms[1].y = 20;
+    transforms[2].x = 30;  transforms[2].y = 30;
+    transforms[3].x = 510; transforms[3].y = 510;
+    SpatialGrid grid(100.0f);
+    grid.update(transforms);
+    std::vector<int> near = grid.getNearby({10, 10}, 5.0f);
+
+    TopologyEvents::getInstance().onBondFormed();
+    TopologyEvents::getInstance().onBondFormed();
+    TopologyEvents::getInstance().onBondBroken();
+
+    if (metrics.occupiedCells.get() != 2.0 || metrics.cellOccupancy.getCount() != 2 ||
+        metrics.cellOccupancy.getSum() != 4.0) {
+        FAIL("occupancy: cells=" << metrics.occupiedCells.get() << " observed=" << metrics.cellOccupancy.getCount());
+    } else if (metrics.neighboursPerQuery.getCount() != 1 || metrics.neighboursPerQuery.getSum() != (double)near.size()) {
+        FAIL("neighbour query not recorded");
+    } else if (metrics.bondsFormed.get() != 2 || metrics.bondsBroken.get() != 1) {
+        FAIL("bonds formed " << metrics.bondsFormed.get() << " broken " << metrics.bondsBroken.get());
+    } else {
+        PASS;
+    }
+}
+
+void testSnapshotFile() {
+    TEST(SnapshotFile);
+    MetricsRegistry& metrics = MetricsRegistry::getInstance();
+    metrics.reset();
+    metrics.stressBreaks.inc(7);
+    metrics.tickDurationMs.observe(3.0);
+
+    std::string path = "test_metrics.prom";
+    bool ok = metrics.writeSnapshot(path);
+    std::ifstream in(path);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string text = ss.str();
+    in.close();
+    fs::remove(path);
+
+    if (!ok) {
+        FAIL("writeSnapshot failed");
+    } else if (text.find("# TYPE sim_stress_breaks counter") == std::string::npos ||
+               text.find("sim_stress_breaks_total 7") == std::string::npos) {
+        FAIL("counter family missing");
+    } else if (text.find("sim_tick_duration_ms_bucket{le=\"4\"} 1") == std::string::npos ||
+               text.find("sim_tick_duration_ms_bucket{le=\"+Inf\"} 1") == std::string::npos ||
+               text.find("sim_tick_duration_ms_quantile{quantile=\"0.99\"}") == std::string::npos) {
+        FAIL("histogram family missing");
+    } else if (text.size() < 6 || text.compare(text.size() - 6, 6, "# EOF\n") != 0) {
+        FAIL("snapshot not terminated by # EOF");
+    } else if (fs::exists(path + ".tmp")) {
+        FAIL("temporary file left behind");
+    } else {
+        PASS;
+    }
+}
+
+int main() {
+    std::cout << "=== Metrics Registry Tests (Phase 66) ===" << std::endl;
+
+    testConcurrentCounters();
+    testHistogramQuantiles();
+    testShardMerge();
+    testHotPathHooks();
+    testSnapshotFile();
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/**
+ * test_molecule_census.cpp
+ *
+ * Phase 50: Incremental molecule census.
+ * Verifies that counts follow bond events (including stress breaks) without
+ * rescanning, that the incremental totals agree with a full recount after
+ * random churn, and that samples reach the CSV/binary time series.
+ *
+ * Usage: ./test_molecule_census.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+
+#include "../ecs/components.hpp"
+#include "../physics/MoleculeCensus.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../physics/PhysicsEngine.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+#include "../core/Config.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+std::vector<TransformComponent> transforms;
+std::vector<AtomComponent> atoms;
+std::vector<StateComponent> states;
+
+const char* CSV_PATH = "test_census.csv";
+const char* BIN_PATH = "test_census.bin";
+
+// Free atoms on a line, spaced beyond bonding range
+void setupAtoms(const std::vector<int>& elements) {
+    transforms.clear(); atoms.clear(); states.clear();
+    for (size_t i = 0; i < elements.size(); i++) {
+        transforms.push_back({(float)i * 200.0f, 0, 0, 0, 0, 0, 0});
+        atoms.push_back({elements[i], 0.0f});
+        states.push_back(StateComponent{});
+    }
+}
+
+void tick(int n = 1) {
+    for (int i = 0; i < n; i++) MoleculeCensus::getInstance().update(states, atoms);
+}
+
+int main() {
+    std::cout << "=== MOLECULE CENSUS TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+    StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+    MoleculeCensus& census = MoleculeCensus::getInstance();
+
+    TEST(Bond_Events_Update_Counts) {
+        setupAtoms({8, 1, 1, 1});
+        census.initialize(states, atoms, CSV_PATH, BIN_PATH);
+        int freeBefore = census.getFreeAtomCount();
+        BondingSystem::tryBond(1, 0, states, atoms, transforms, true);
+        BondingSystem::tryBond(2, 0, states, atoms, transforms, true);
+        tick();
+        bool formed = census.getMoleculeCount("H2O") == 1 && census.getFreeAtomCount() == 1;
+        BondingSystem::breakBond(2, states, atoms);
+        tick();
+        bool broken = census.getMoleculeCount("H2O") == 0 && census.getFreeAtomCount() == 2;
+        if (freeBefore == 4 && formed && broken) { PASS }
+        else { FAIL("H2O count did not follow bond/break events") }
+    }
+
+    TEST(Stress_Break_Recounts_Both_Halves) {
+        // Index 0 stands in for the player, whose molecule is exempt from stress breaks
+        setupAtoms({1, 8, 1, 1});
+        BondingSystem::tryBond(2, 1, states, atoms, transforms, true);
+        BondingSystem::tryBond(3, 1, states, atoms, transforms, true);
+        census.initialize(states, atoms, CSV_PATH, BIN_PATH);
+        bool formed = census.getMoleculeCount("H2O") == 1;
+        transforms[3].x = transforms[1].x + Config::BOND_BREAK_STRESS * 4.0f;
+        PhysicsEngine physics;
+        physics.step(Config::FIXED_DELTA_TIME, transforms, atoms, states, ChemistryDatabase::getInstance(), -1);
+        tick();
+        bool split = census.getMoleculeCount("H2O") == 0 && census.getFreeAtomCount() == 2;
+        if (formed && split) { PASS }
+        else { FAIL("H2O=" << census.getMoleculeCount("H2O") << " free=" << census.getFreeAtomCount()) }
+    }
+
+    TEST(Incremental_Matches_Full_Recount) {
+        std::vector<int> elements;
+        for (int i = 0; i < 300; i++) elements.push_back((i % 3 == 0) ? 8 : ((i % 3 == 1) ? 1 : 6));
+        setupAtoms(elements);
+        census.initialize(states, atoms, CSV_PATH, BIN_PATH);
+
+        uint32_t seed = 12345;
+        auto next = [&]() { seed = seed * 1664525u + 1013904223u; return (int)(seed >> 8); };
+        for (int step = 0; step < 2000; step++) {
+            int a = next() % (int)states.size();
+            int b = next() % (int)states.size();
+            bool sameMolecule = a == b || (states[a].moleculeId != -1 && states[a].moleculeId == states[b].moleculeId);
+            if (next() % 2 == 0) BondingSystem::breakBond(a, states, atoms);
+            else if (states[a].parentEntityId == -1 && !sameMolecule) BondingSystem::tryBond(a, b, states, atoms, transforms, true);
+            if (step % 7 == 0) tick();
+        }
+        tick();
+
+        int water = census.getMoleculeCount("H2O");
+        int unknown = census.getUnknownCount();
+        int free = census.getFreeAtomCount();
+        census.initialize(states, atoms, CSV_PATH, BIN_PATH);  // Full recount
+        bool same = water == census.getMoleculeCount("H2O") && unknown == census.getUnknownCount() && free == census.getFreeAtomCount();
+        std::cout << "(H2O=" << water << " unknown=" << unknown << " free=" << free << ") ";
+        if (same) { PASS } else { FAIL("Incremental totals drifted from a full recount") }
+    }
+
+    TEST(Time_Series_Written) {
+        setupAtoms({8, 1, 1});
+        census.initialize(states, atoms, CSV_PATH, BIN_PATH);
+        BondingSystem::tryBond(1, 0, states, atoms, transforms, true);
+        BondingSystem::tryBond(2, 0, states, atoms, transforms, true);
+        tick(Config::CENSUS_SAMPLE_TICKS * 3);
+        census.shutdown();
+
+        std::ifstream csv(CSV_PATH);
+        std::string header, line;
+        std::getline(csv, header);
+        int rows = 0;
+        while (std::getline(csv, line)) rows++;
+
+        std::ifstream bin(BIN_PATH, std::ios::binary);
+        char magic[4] = {0};
+        uint32_t version = 0, columnCount = 0;
+        bin.read(magic, 4);
+        bin.read(reinterpret_cast<char*>(&version), 4);
+        bin.read(reinterpret_cast<char*>(&columnCount), 4);
+
+        bool csvOk = header.rfind("tick,bonds_formed", 0) == 0 && header.find("mol:H2O") != std::string::npos && rows == 3;
+        bool binOk = std::memcmp(magic, "LSCN", 4) == 0 && version == (uint32_t)Config::CENSUS_FORMAT_VERSION && columnCount > 7;
+        if (csvOk && binOk) { PASS } else { FAIL("Census files missing header or samples") }
+    }
+
+    std::remove(CSV_PATH);
+    std::remove(BIN_PATH);
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
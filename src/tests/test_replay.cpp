@@ -0,0 +1,155 @@
+/**
+ * test_replay.cpp
+ *
+ * Phase 54: Delta-compressed recording and replay.
+ * Records a scripted run (motion, bonding, spawn/despawn, compaction) and
+ * checks that seeking reproduces every tick within half a quantum, that
+ * bonds and child lists replay exactly, that backward seeks match forward
+ * playback, and that coasting atoms cost (almost) nothing per tick.
+ *
+ * Usage: ./test_replay.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+#include "../ecs/World.hpp"
+#include "../ecs/SimulationRecorder.hpp"
+#include "../ecs/ReplayPlayer.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+const char* REC_PATH = "test_replay.rec";
+
+struct Expected {
+    std::vector<TransformComponent> transforms;
+    std::vector<StateComponent> states;
+};
+
+TransformComponent at(float x, float y, float vx, float vy) { return {x, y, 0, vx, vy, 0, 0}; }
+
+// Simple kinematics so motion is smooth but not trivially constant
+void advance(World& world, int tick) {
+    for (size_t i = 0; i < world.transforms.size(); i++) {
+        if (!world.states[i].isAlive) continue;
+        TransformComponent& tr = world.transforms[i];
+        tr.vx += 0.3f * std::sin(0.05f * (float)(tick + i));
+        tr.x += tr.vx / 60.0f;
+        tr.y += tr.vy / 60.0f;
+    }
+}
+
+bool matches(const World& world, const Expected& e, float posTol, float velTol) {
+    if (world.transforms.size() != e.transforms.size()) return false;
+    for (size_t i = 0; i < e.transforms.size(); i++) {
+        if (!e.states[i].isAlive) {
+            if (world.states[i].isAlive) return false;
+            continue;
+        }
+        const TransformComponent& a = world.transforms[i];
+        const TransformComponent& b = e.transforms[i];
+        if (std::fabs(a.x - b.x) > posTol || std::fabs(a.y - b.y) > posTol || std::fabs(a.vx - b.vx) > velTol) return false;
+        const StateComponent& s = world.states[i];
+        const StateComponent& t = e.states[i];
+        if (s.parentEntityId != t.parentEntityId || s.moleculeId != t.moleculeId || s.childList != t.childList ||
+            s.isAlive != t.isAlive || s.topologyVersion != t.topologyVersion) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== REPLAY TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+
+    // Scripted run recorded once, shared by the tests below
+    World world;
+    world.spawn(at(0, 0, 0, 0), 1);
+    std::vector<EntityHandle> handles;
+    for (int i = 0; i < 30; i++) handles.push_back(world.spawn(at(100.0f * i, 50.0f, (float)(i % 7) * 3.0f, -2.0f), (i % 2) ? 1 : 8));
+
+    SimulationRecorder recorder;
+    recorder.start(REC_PATH);
+    std::vector<Expected> expected;
+    const int ticks = 1500;  // Spans several keyframes
+    for (int t = 0; t < ticks; t++) {
+        advance(world, t);
+        if (t == 100) BondingSystem::tryBond(world.resolve(handles[1]), world.resolve(handles[0]), world.states, world.atoms, world.transforms, true);
+        if (t == 300) world.despawn(handles[5]);
+        if (t == 400) handles.push_back(world.spawn(at(-500, -500, 10, 10), 6));
+        if (t == 700) { world.compact(); recorder.requestKeyframe(); }
+        recorder.recordTick(world, RecordedInput{});
+        expected.push_back({ world.transforms, world.states });
+    }
+    recorder.stop();
+
+    const float posTol = Config::RECORD_POSITION_QUANTUM * 0.5f + 1e-3f;
+    const float velTol = Config::RECORD_VELOCITY_QUANTUM * 0.5f + 1e-3f;
+
+    TEST(Forward_Playback_Matches_Every_Tick) {
+        World view;
+        ReplayPlayer replay;
+        bool ok = replay.open(REC_PATH) && replay.getFrameCount() == ticks;
+        for (int f = 0; ok && f < ticks; f++) {
+            ok = replay.seek(f, view) && matches(view, expected[f], posTol, velTol);
+            if (!ok) std::cout << "(diverged at frame " << f << ") ";
+        }
+        if (ok) { PASS } else { FAIL("Replay drifted from the recorded run") }
+    }
+
+    TEST(Backward_Seek_Matches_Forward) {
+        World view;
+        ReplayPlayer replay;
+        replay.open(REC_PATH);
+        bool ok = true;
+        const int targets[] = { 1499, 20, 650, 120, 701, 699, 0, 1234 };
+        for (int f : targets) {
+            if (!replay.seek(f, view) || !matches(view, expected[f], posTol, velTol)) ok = false;
+        }
+        if (ok) { PASS } else { FAIL("Scrubbing backwards gave a different state") }
+    }
+
+    TEST(Bond_Counters_Follow_The_Recording) {
+        World view;
+        ReplayPlayer replay;
+        replay.open(REC_PATH);
+        replay.seek(99, view);
+        long long before = replay.getBondsFormed();
+        replay.seek(101, view);
+        bool ok = replay.getBondsFormed() == before + 1;
+        if (ok) { PASS } else { FAIL("Bond event not reflected in the replayed counters") }
+    }
+
+    TEST(Coasting_Atoms_Are_Nearly_Free) {
+        World still;
+        still.spawn(at(0, 0, 0, 0), 1);
+        for (int i = 0; i < 200; i++) still.spawn(at(40.0f * i, 0, 60.0f, 0), 6);  // Constant velocity
+        SimulationRecorder rec;
+        rec.start(REC_PATH);
+        for (int t = 0; t < 300; t++) {
+            for (auto& tr : still.transforms) tr.x += tr.vx / 60.0f;
+            rec.recordTick(still, RecordedInput{});
+        }
+        rec.stop();
+        // One keyframe plus ~20 bytes per delta frame for 200 moving atoms
+        long long keyframeBytes = (long long)(still.getEntityCount() * (sizeof(TransformComponent) + sizeof(AtomComponent) + 96));
+        bool small = rec.getStats().bytesWritten < keyframeBytes + 300 * 64;
+        if (small) { PASS } else { FAIL("Predictable motion is not compressed (" << rec.getStats().bytesWritten << " bytes)") }
+    }
+
+    std::remove(REC_PATH);
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/**
+ * test_structure_events.cpp
+ *
+ * Phase 47: Event-driven StructureDetector.
+ * Verifies that a rejected molecule is cached by topologyVersion, that bond
+ * events invalidate the cache, that transient blocks (shielded atoms)
+ * are never cached, and that a registry reload re-checks the rejections of every
+ * world, not just the first one examined.
+ *
+ * Usage: ./test_structure_events.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include "../ecs/components.hpp"
+#include "../physics/StructureDetector.hpp"
+#include "../physics/MolecularHierarchy.hpp"
+#include "../physics/TopologyEvents.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include "../chemistry/StructureRegistry.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+std::vector<TransformComponent> transforms;
+std::vector<AtomComponent> atoms;
+std::vector<StateComponent> states;
+
+// Carbon chain 1→2→…→count laid out on hexagon vertices
+void setupCarbonChain(int count) {
+    transforms.clear(); atoms.clear(); states.clear();
+
+    transforms.push_back({0, 0, 0, 0, 0, 0, 0});
+    atoms.push_back({1, 0.0f});
+    states.push_back(StateComponent{});
+
+    for (int i = 0; i < count; i++) {
+        float angle = i * (2.0f * 3.14159f / 6.0f);
+        transforms.push_back({100 + std::cos(angle) * 42.0f, 100 + std::sin(angle) * 42.0f, 0, 0, 0, 0, 0});
+        atoms.push_back({6, 0.0f});
+        StateComponent st{};
+        st.releaseTimer = 10.0f;
+        states.push_back(st);
+    }
+    for (int i = 2; i <= count; i++) {
+        states[i].parentEntityId = i - 1;
+        states[i].isClustered = true;
+        states[i - 1].childCount++;
+        states[i - 1].childList.push_back(i);
+    }
+    MolecularHierarchy::propagateMoleculeId(1, states);
+}
+
+int main() {
+    std::cout << "=== STRUCTURE EVENT TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+    StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+
+    TEST(Propagation_Stamps_Version) {
+        setupCarbonChain(3);
+        uint32_t v = states[1].topologyVersion;
+        bool same = states[2].topologyVersion == v && states[3].topologyVersion == v;
+        if (v != 0 && same) { PASS } else { FAIL("Members not stamped with one version") }
+    }
+
+    TEST(Rejection_Is_Cached) {
+        setupCarbonChain(3);
+        bool formed = StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        if (!formed && states[1].structureCheckedVersion == states[1].topologyVersion) { PASS }
+        else { FAIL("Small molecule rejection was not cached") }
+    }
+
+    TEST(Bond_Event_Invalidates_Cache) {
+        setupCarbonChain(3);
+        StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        uint32_t before = states[1].topologyVersion;
+
+        // Attach a fourth carbon through the hierarchy
+        transforms.push_back({150, 100, 0, 0, 0, 0, 0});
+        atoms.push_back({6, 0.0f});
+        states.push_back(StateComponent{});
+        states[4].parentEntityId = 3;
+        states[3].childList.push_back(4);
+        states[3].childCount++;
+        MolecularHierarchy::propagateMoleculeId(4, states);
+
+        if (states[1].topologyVersion != before &&
+            states[1].structureCheckedVersion != states[1].topologyVersion) { PASS }
+        else { FAIL("Bond event left the molecule marked as checked") }
+    }
+
+    TEST(Shielded_Block_Not_Cached) {
+        setupCarbonChain(6);
+        states[3].isShielded = true;
+        bool formed = StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        if (!formed && states[1].structureCheckedVersion != states[1].topologyVersion) { PASS }
+        else { FAIL("Transient shield rejection was cached") }
+    }
+
+    TEST(Unshielded_Chain_Forms_After_Retry) {
+        setupCarbonChain(6);
+        states[3].isShielded = true;
+        StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        states[3].isShielded = false;
+        bool formed = StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        if (formed && states[1].isInRing) { PASS } else { FAIL("Ring did not form once unshielded") }
+    }
+
+    TEST(Registry_Reload_Rechecks_Every_World) {
+        // Two worlds rejected under the old definitions: the first one re-checked after
+        // the reload must not use up the invalidation for the second
+        setupCarbonChain(3);
+        StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        std::vector<StateComponent> otherWorld = states;
+        int before = states[1].structureCheckedGeneration;
+
+        StructureRegistry::getInstance().loadFromDisk("data/structures.json");
+        int after = StructureRegistry::getInstance().getGeneration();
+        StructureDetector::tryFormStructure(1, states, atoms, transforms);
+        StructureDetector::tryFormStructure(1, otherWorld, atoms, transforms);
+        bool ok = before != after && states[1].structureCheckedGeneration == after &&
+                  otherWorld[1].structureCheckedGeneration == after;
+        if (ok) { PASS }
+        else { FAIL("before=" << before << " after=" << after << " other=" << otherWorld[1].structureCheckedGeneration) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/**
+ * test_structure_tracker.cpp
+ *
+ * Phase 68: Structure membership index.
+ * Creating a structure must freeze and index exactly its members with their
+ * aggregate mass, lookups must not scan the world while the index is
+ * current, the index must follow World::compact() and despawns, and the
+ * rigid-body velocity must be the momentum-weighted mean.
+ *
+ * Usage: ./test_structure_tracker.exe (from the repository root)
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "../ecs/World.hpp"
+#include "../physics/StructureTracker.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+TransformComponent at(float x) { return {x, 0, 0, 0, 0, 0, 0}; }
+
+int main() {
+    std::cout << "=== STRUCTURE TRACKER TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase& db = ChemistryDatabase::getInstance();
+    db.reload();
+    StructureTracker& tracker = StructureTracker::getInstance();
+
+    TEST(Create_Freezes_And_Indexes_Members) {
+        World world;
+        world.spawn(at(0), 1);  // Player
+        std::vector<int> ring;
+        for (int k = 0; k < 6; k++) ring.push_back(world.resolve(world.spawn(at(200.0f + k * 10.0f), 6)));
+        world.spawn(at(800), 8);  // Bystander
+        tracker.clear();
+
+        int id = tracker.create(ring, world.states, world.atoms);
+        const StructureInstance* s = tracker.find(id, world.states, world.atoms);
+        float expectedMass = 6.0f * db.getElement(6).atomicMass;
+        bool frozen = true;
+        for (int idx : ring) frozen = frozen && world.states[idx].isFrozen && world.states[idx].structureId == id;
+        if (s && s->members.size() == 6 && frozen && std::fabs(s->mass - expectedMass) < 1e-3f) { PASS }
+        else { FAIL("Members or mass not indexed") }
+    }
+
+    TEST(Lookups_Do_Not_Rescan_World) {
+        World world;
+        world.spawn(at(0), 1);
+        std::vector<int> members = { world.resolve(world.spawn(at(100), 6)), world.resolve(world.spawn(at(120), 6)) };
+        for (int k = 0; k < 500; k++) world.spawn(at(1000.0f + k), 1);
+        tracker.clear();
+        int id = tracker.create(members, world.states, world.atoms);
+        tracker.find(id, world.states, world.atoms);  // First lookup after clear() indexes the world once
+        int before = tracker.getRebuildCount();
+        for (int k = 0; k < 100; k++) tracker.find(id, world.states, world.atoms);
+        if (tracker.getRebuildCount() == before) { PASS } else { FAIL("Lookup rebuilt the index") }
+    }
+
+    TEST(Index_Follows_Compaction_And_Despawn) {
+        World world;
+        world.spawn(at(0), 1);
+        EntityHandle gap = world.spawn(at(50), 1);
+        std::vector<EntityHandle> handles;
+        std::vector<int> members;
+        for (int k = 0; k < 4; k++) {
+            handles.push_back(world.spawn(at(300.0f + k * 10.0f), 6));
+            members.push_back(world.resolve(handles.back()));
+        }
+        tracker.clear();
+        int id = tracker.create(members, world.states, world.atoms);
+
+        world.despawn(gap);
+        world.compact();
+        tracker.clear();  // As main.cpp does after compaction
+        const StructureInstance* s = tracker.find(id, world.states, world.atoms);
+        bool remapped = s && s->members.size() == 4;
+        for (size_t k = 0; remapped && k < handles.size(); k++) {
+            int now = world.resolve(handles[k]);
+            remapped = std::find(s->members.begin(), s->members.end(), now) != s->members.end();
+        }
+
+        // A despawned member is noticed on the next lookup without a clear()
+        world.despawn(handles[0]);
+        s = tracker.find(id, world.states, world.atoms);
+        bool shrunk = s && s->members.size() == 3;
+        if (remapped && shrunk) { PASS } else { FAIL("Index did not follow the world (remapped=" << remapped << ")") }
+    }
+
+    TEST(Velocity_Is_Momentum_Weighted) {
+        World world;
+        world.spawn(at(0), 1);
+        int c = world.resolve(world.spawn(at(100), 6));
+        int h = world.resolve(world.spawn(at(110), 1));
+        world.transforms[c].vx = 10.0f;
+        world.transforms[h].vx = -10.0f;
+        tracker.clear();
+        int id = tracker.create({ c, h }, world.states, world.atoms);
+        const StructureInstance* s = tracker.find(id, world.states, world.atoms);
+        float mc = db.getElement(6).atomicMass, mh = db.getElement(1).atomicMass;
+        float expectedV = (mc * 10.0f - mh * 10.0f) / (mc + mh);
+        float expectedX = (mc * 100.0f + mh * 110.0f) / (mc + mh);
+        Vector2 v = StructureTracker::velocity(*s, world.transforms);
+        Vector2 com = StructureTracker::centreOfMass(*s, world.transforms);
+        if (std::fabs(v.x - expectedV) < 1e-3f && std::fabs(com.x - expectedX) < 1e-3f) { PASS }
+        else { FAIL("v=" << v.x << " expected " << expectedV << ", com=" << com.x << " expected " << expectedX) }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+/**
+ * test_undo_checkpoints.cpp
+ *
+ * Phase 56: Copy-on-write checkpoints behind UndoManager.
+ * Undo must bring back positions, bonds and rings broken by a tractor
+ * isolation; successive undos walk back one interaction each; unchanged
+ * pages are shared between checkpoints, restores touch only changed pages
+ * and a long history stays within the configured limits.
+ *
+ * Usage: ./test_undo_checkpoints.exe
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "../ecs/World.hpp"
+#include "../ecs/CheckpointStore.hpp"
+#include "../ecs/StateHasher.hpp"
+#include "../gameplay/UndoManager.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+// Line of alternating C/H atoms; pairs (1,2), (3,4)... bonded
+void buildWorld(World& world, int count) {
+    world.transforms.clear();
+    world.atoms.clear();
+    world.states.clear();
+    world.transforms.push_back({0, 0, 0, 0, 0, 0, 0});
+    world.atoms.push_back({1, 0.0f});
+    world.states.push_back(StateComponent{});
+    for (int i = 1; i < count; i++) {
+        world.transforms.push_back({30.0f * i, 500.0f, 0, 1.0f, 0, 0, 0});
+        world.atoms.push_back({(i % 2) ? 6 : 1, 0.0f});
+        world.states.push_back(StateComponent{});
+    }
+    world.rebuildEntityTable();
+    for (int i = 1; i + 1 < count; i += 2) {
+        BondingSystem::tryBond(i + 1, i, world.states, world.atoms, world.transforms, true);
+    }
+}
+
+void drift(World& world) {
+    for (auto& tr : world.transforms) tr.x += tr.vx;
+}
+
+// Everything but topologyVersion (undo re-stamps restored atoms)
+bool sameLayout(const World& a, const World& b) {
+    if (a.states.size() != b.states.size()) return false;
+    for (size_t i = 0; i < a.states.size(); i++) {
+        if (a.transforms[i].x != b.transforms[i].x || a.transforms[i].y != b.transforms[i].y) return false;
+        const StateComponent& s = a.states[i];
+        const StateComponent& t = b.states[i];
+        if (s.parentEntityId != t.parentEntityId || s.moleculeId != t.moleculeId || s.childList != t.childList ||
+            s.isClustered != t.isClustered || s.occupiedSlots != t.occupiedSlots) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== UNDO CHECKPOINT TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+
+    TEST(Undo_Reverts_Tractor_Isolation) {
+        World world;
+        buildWorld(world, 200);
+        UndoManager undo;
+        World before = world;
+        undo.checkpoint(world.transforms, world.atoms, world.states);
+
+        // What a tractor capture does: isolate the atom, then drag it
+        BondingSystem::breakAllBonds(7, world.states, world.atoms);
+        world.transforms[7].x += 400.0f;
+        for (int t = 0; t < 10; t++) drift(world);
+
+        bool undone = undo.undoLast(0, world.transforms, world.states, world.atoms) && undo.restoredCheckpoint();
+        if (undone && sameLayout(world, before) && world.states[7].parentEntityId == before.states[7].parentEntityId) { PASS }
+        else { FAIL("World not restored to the pre-capture state") }
+    }
+
+    TEST(Each_Undo_Steps_Back_One_Interaction) {
+        World world;
+        buildWorld(world, 200);
+        UndoManager undo;
+        std::vector<World> snapshots;
+        for (int step = 0; step < 3; step++) {
+            snapshots.push_back(world);
+            undo.checkpoint(world.transforms, world.atoms, world.states);
+            BondingSystem::breakAllBonds(11 + 20 * step, world.states, world.atoms);
+            drift(world);
+        }
+        bool ok = true;
+        for (int step = 2; step >= 0; step--) {
+            ok = ok && undo.undoLast(0, world.transforms, world.states, world.atoms) && sameLayout(world, snapshots[step]);
+        }
+        ok = ok && undo.getCheckpoints().empty();
+        if (ok) { PASS } else { FAIL("Undo order does not match checkpoint order") }
+    }
+
+    TEST(Unchanged_Pages_Are_Shared_And_Restores_Are_Local) {
+        World world;
+        buildWorld(world, 1000);
+        CheckpointStore store;
+        store.take(world.transforms, world.atoms, world.states);
+        size_t first = store.getMemoryBytes();
+        long long copied = store.getStats().pagesCopied;
+
+        world.atoms[500].partialCharge = 0.25f;  // One page of one array
+        store.take(world.transforms, world.atoms, world.states);
+        bool shared = store.getStats().pagesCopied == copied + 1 &&
+                      store.getMemoryBytes() - first == Config::CHECKPOINT_PAGE_ENTITIES * sizeof(AtomComponent);
+
+        StateHash expected = StateHasher::compute(world);
+        world.atoms[900].partialCharge = -1.0f;
+        world.transforms[3].y = 0.0f;
+        std::vector<int> changed;
+        bool restored = store.restoreLatest(world.transforms, world.atoms, world.states, changed);
+        bool local = restored && store.getStats().pagesRestored == 2 && changed.empty() && StateHasher::compute(world) == expected;
+        if (shared && local) { PASS }
+        else { FAIL("shared=" << shared << " pagesRestored=" << store.getStats().pagesRestored << " changed=" << changed.size()) }
+    }
+
+    TEST(Long_History_Stays_Bounded) {
+        World world;
+        buildWorld(world, 4000);
+        CheckpointStore store;
+        for (int step = 0; step < 300; step++) {
+            drift(world);  // Every transform page changes between checkpoints
+            store.take(world.transforms, world.atoms, world.states);
+        }
+        // Transforms per checkpoint, plus one shared copy of atoms/states (and their child lists)
+        size_t perCheckpoint = world.transforms.size() * sizeof(TransformComponent);
+        size_t sharedOnce = world.states.size() * (sizeof(StateComponent) + sizeof(AtomComponent) + sizeof(int));
+        bool bounded = store.size() == Config::UNDO_HISTORY_LIMIT &&
+                       store.getMemoryBytes() <= (size_t)Config::UNDO_MEMORY_BUDGET_KB * 1024 &&
+                       store.getMemoryBytes() <= perCheckpoint * Config::UNDO_HISTORY_LIMIT + sharedOnce;
+        if (bounded) { PASS }
+        else { FAIL(store.size() << " checkpoints, " << store.getMemoryBytes() << " bytes") }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/**
+ * test_view_culling.cpp
+ *
+ * Phase 58: Camera culling through SpatialGrid::queryRect().
+ * The query must return every entity inside the rectangle (and nothing
+ * farther than one cell outside it), on both the dense cell walk and the
+ * sparse zoomed-out path, and a bond margin must keep every bond that
+ * crosses the view.
+ *
+ * Usage: ./test_view_culling.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "../physics/SpatialGrid.hpp"
+#include "../core/Config.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+bool inside(const TransformComponent& tr, Rectangle r, float grow) {
+    return tr.x >= r.x - grow && tr.x <= r.x + r.width + grow && tr.y >= r.y - grow && tr.y <= r.y + r.height + grow;
+}
+
+// Every entity in the rect is returned; none lies more than a cell outside it; no duplicates
+bool queryIsExact(const SpatialGrid& grid, const std::vector<TransformComponent>& transforms, Rectangle view) {
+    std::vector<int> got;
+    grid.queryRect(view, got);
+    std::vector<int> sorted = got;
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) return false;
+    for (int i = 0; i < (int)transforms.size(); i++) {
+        bool returned = std::binary_search(sorted.begin(), sorted.end(), i);
+        if (inside(transforms[i], view, 0.0f) && !returned) return false;
+        if (returned && !inside(transforms[i], view, Config::GRID_CELL_SIZE)) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== VIEW CULLING TESTS ===" << std::endl << std::endl;
+
+    // 200 x 200 lattice, 37 units apart (~7400 x 7400 world)
+    std::vector<TransformComponent> transforms;
+    for (int y = 0; y < 200; y++) {
+        for (int x = 0; x < 200; x++) transforms.push_back({ x * 37.0f - 3700.0f, y * 37.0f - 3700.0f, 0, 0, 0, 0, 0 });
+    }
+    SpatialGrid grid(Config::GRID_CELL_SIZE);
+    grid.update(transforms);
+
+    TEST(Zoomed_In_Query_Is_Exact) {
+        Rectangle view = { -412.5f, 130.0f, 640.0f, 360.0f };
+        std::vector<int> got;
+        grid.queryRect(view, got);
+        bool small = got.size() < transforms.size() / 50;  // Cost follows the view, not the world
+        if (queryIsExact(grid, transforms, view) && small) { PASS } else { FAIL("Query missed or over-fetched (" << got.size() << ")") }
+    }
+
+    TEST(Zoomed_Out_Query_Uses_Occupied_Cells) {
+        Rectangle view = { -1.0e6f, -1.0e6f, 2.0e6f, 2.0e6f };  // Far more cells than are occupied
+        std::vector<int> got;
+        grid.queryRect(view, got);
+        if (queryIsExact(grid, transforms, view) && got.size() == transforms.size()) { PASS }
+        else { FAIL("Sparse path returned " << got.size() << " of " << transforms.size()) }
+    }
+
+    TEST(Bond_Margin_Keeps_Crossing_Bonds) {
+        // Pairs straddling the view's left edge at up to MAX_BOND_RENDER_DIST apart
+        std::vector<TransformComponent> pairs;
+        for (int k = 0; k < 50; k++) {
+            float len = Config::MAX_BOND_RENDER_DIST * (0.2f + 0.016f * k);
+            pairs.push_back({ -len * 0.1f, k * 10.0f, 0, 0, 0, 0, 0 });   // Just inside
+            pairs.push_back({ -len * 1.05f, k * 10.0f, 0, 0, 0, 0, 0 });  // Off screen
+        }
+        SpatialGrid g(Config::GRID_CELL_SIZE);
+        g.update(pairs);
+        Rectangle view = { 0.0f, 0.0f, 800.0f, 600.0f };
+        Rectangle grown = { view.x - Config::MAX_BOND_RENDER_DIST, view.y - Config::MAX_BOND_RENDER_DIST,
+                            view.width + 2 * Config::MAX_BOND_RENDER_DIST, view.height + 2 * Config::MAX_BOND_RENDER_DIST };
+        std::vector<int> got;
+        g.queryRect(grown, got);
+        std::sort(got.begin(), got.end());
+        bool ok = true;
+        for (int i = 0; i < (int)pairs.size(); i++) ok = ok && std::binary_search(got.begin(), got.end(), i);
+        if (ok) { PASS } else { FAIL("An off-screen bond endpoint was culled") }
+    }
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+/**
+ * test_world_snapshot.cpp
+ *
+ * Phase 53: Binary world snapshots.
+ * Verifies that a save/load round trip restores components, bonds and
+ * childList order, dead slots, the id counters and the jitter RNG stream,
+ * that damaged files, empty worlds or dangling entity links are rejected
+ * without touching the world, and that a failed save keeps the old file.
+ *
+ * Usage: ./test_world_snapshot.exe
+ */
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <filesystem>
+
+#include "../ecs/World.hpp"
+#include "../ecs/WorldSnapshot.hpp"
+#include "../core/SimulationState.hpp"
+#include "../physics/BondingSystem.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+
+#define TEST(name) std::cout << "[TEST] " << #name << "... "; testsRun++;
+#define PASS std::cout << "PASS" << std::endl; testsPassed++;
+#define FAIL(msg) std::cout << "FAIL: " << msg << std::endl;
+
+int testsRun = 0;
+int testsPassed = 0;
+
+const char* SNAP_PATH = "test_world_snapshot.snap";
+
+TransformComponent at(float x, float y) { return {x, y, 1.5f, 0.25f, -0.5f, 0, 0.1f}; }
+
+// Player, a water-like O(H)(H) molecule, a dead slot and a free carbon
+void buildWorld(World& world) {
+    world.spawn(at(0, 0), 1);
+    EntityHandle o = world.spawn(at(200, 0), 8);
+    EntityHandle h1 = world.spawn(at(220, 0), 1);
+    EntityHandle h2 = world.spawn(at(180, 0), 1);
+    EntityHandle gone = world.spawn(at(900, 0), 7);
+    world.spawn(at(-300, 50), 6);
+    BondingSystem::tryBond(world.resolve(h1), world.resolve(o), world.states, world.atoms, world.transforms, true);
+    BondingSystem::tryBond(world.resolve(h2), world.resolve(o), world.states, world.atoms, world.transforms, true);
+    world.despawn(gone);
+}
+
+bool sameState(const StateComponent& a, const StateComponent& b) {
+    return a.moleculeId == b.moleculeId && a.parentEntityId == b.parentEntityId &&
+           a.parentSlotIndex == b.parentSlotIndex && a.childList == b.childList &&
+           a.occupiedSlots == b.occupiedSlots && a.isClustered == b.isClustered &&
+           a.cycleBondId == b.cycleBondId && a.ringInstanceId == b.ringInstanceId &&
+           a.topologyVersion == b.topologyVersion && a.isAlive == b.isAlive;
+}
+
+int main() {
+    std::cout << "=== WORLD SNAPSHOT TESTS ===" << std::endl << std::endl;
+    ChemistryDatabase::getInstance().reload();
+
+    TEST(Round_Trip_Restores_Components_And_Bonds) {
+        World original;
+        buildWorld(original);
+        bool saved = WorldSnapshot::save(original, SNAP_PATH);
+
+        World loaded;
+        loaded.spawn(at(5, 5), 1);  // Existing contents must be replaced
+        bool ok = saved && WorldSnapshot::load(loaded, SNAP_PATH);
+        ok = ok && loaded.getEntityCount() == original.getEntityCount() && loaded.states[1].childList.size() == 2;
+        for (size_t i = 0; ok && i < original.getEntityCount(); i++) {
+            const TransformComponent& a = original.transforms[i];
+            const TransformComponent& b = loaded.transforms[i];
+            if (a.x != b.x || a.y != b.y || a.z != b.z || a.vx != b.vx || a.rotation != b.rotation) ok = false;
+            if (original.atoms[i].atomicNumber != loaded.atoms[i].atomicNumber) ok = false;
+            if (!sameState(original.states[i], loaded.states[i])) ok = false;
+        }
+        if (ok) { PASS } else { FAIL("Loaded world differs from the saved one") }
+    }
+
+    TEST(Load_Rebuilds_Free_List_And_Handles) {
+        World original;
+        buildWorld(original);
+        WorldSnapshot::save(original, SNAP_PATH);
+
+        World loaded;
+        bool ok = WorldSnapshot::load(loaded, SNAP_PATH);
+        ok = ok && loaded.getDeadCount() == 1 && loaded.getAliveCount() == 5;
+        int reused = loaded.resolve(loaded.spawn(at(0, 0), 6));
+        ok = ok && reused == 4 && loaded.resolve(loaded.getHandle(1)) == 1;
+        if (ok) { PASS } else { FAIL("Dead slot not reusable after load") }
+    }
+
+    TEST(Counters_And_Rng_Continue_After_Load) {
+        World world;
+        buildWorld(world);
+        SimulationState& sim = SimulationState::getInstance();
+        sim.allocateRingId();
+        sim.allocateStructureId();
+        WorldSnapshot::save(world, SNAP_PATH);
+
+        int ringAfterSave = sim.allocateRingId();
+        int structAfterSave = sim.allocateStructureId();
+        std::vector<unsigned int> draws;
+        for (int i = 0; i < 8; i++) draws.push_back(sim.getJitterRng()());
+
+        WorldSnapshot::load(world, SNAP_PATH);
+        bool ok = sim.allocateRingId() == ringAfterSave && sim.allocateStructureId() == structAfterSave;
+        for (int i = 0; i < 8; i++) if (sim.getJitterRng()() != draws[i]) ok = false;
+        if (ok) { PASS } else { FAIL("Id counters or RNG stream diverged after load") }
+    }
+
+    TEST(Damaged_File_Is_Rejected) {
+        World original;
+        buildWorld(original);
+        WorldSnapshot::save(original, SNAP_PATH);
+
+        // Truncate: the header's recorded size no longer matches
+        std::vector<char> bytes;
+        {
+            std::ifstream in(SNAP_PATH, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        {
+            std::ofstream out(SNAP_PATH, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), (std::streamsize)(bytes.size() / 2));
+        }
+
+        World target;
+        target.spawn(at(0, 0), 1);
+        bool rejected = !WorldSnapshot::load(target, SNAP_PATH) && target.getEntityCount() == 1;
+        bool missing = !WorldSnapshot::load(target, "does_not_exist.snap");
+        if (rejected && missing) { PASS } else { FAIL("Truncated or missing snapshot was accepted") }
+    }
+
+    TEST(Out_Of_Range_Links_Are_Rejected) {
+        // Each corruption is well-formed on disk but names an entity that does not exist
+        const int count = 6;
+        bool ok = true;
+        for (int variant = 0; variant < 4 && ok; variant++) {
+            World original;
+            buildWorld(original);
+            StateComponent& s = original.states[5];
+            if (variant == 0) s.parentEntityId = count;
+            if (variant == 1) original.states[1].childList.push_back(count + 40);
+            if (variant == 2) s.cycleBondId = -7;
+            if (variant == 3) s.moleculeId = 1000;
+            WorldSnapshot::save(original, SNAP_PATH);
+
+            World target;
+            target.spawn(at(0, 0), 1);
+            ok = !WorldSnapshot::load(target, SNAP_PATH) && target.getEntityCount() == 1 &&
+                 target.states[0].isAlive;
+        }
+        if (ok) { PASS } else { FAIL("Snapshot with a dangling entity index was adopted") }
+    }
+
+    TEST(Empty_World_Is_Rejected) {
+        World empty;
+        bool saved = WorldSnapshot::save(empty, SNAP_PATH);
+        World target;
+        target.spawn(at(0, 0), 1);
+        bool ok = saved && !WorldSnapshot::load(target, SNAP_PATH) && target.getEntityCount() == 1;
+        if (ok) { PASS } else { FAIL("Snapshot without a player entity was adopted") }
+    }
+
+    TEST(Failed_Save_Keeps_Previous_Snapshot) {
+        World original;
+        buildWorld(original);
+        WorldSnapshot::save(original, SNAP_PATH);
+
+        // A directory where the temporary file would go makes the write fail
+        std::string temp = std::string(SNAP_PATH) + ".tmp";
+        std::filesystem::create_directory(temp);
+        World other;
+        other.spawn(at(0, 0), 1);
+        bool failed = !WorldSnapshot::save(other, SNAP_PATH);
+        std::filesystem::remove(temp);
+
+        World loaded;
+        bool ok = failed && WorldSnapshot::load(loaded, SNAP_PATH) && loaded.getEntityCount() == original.getEntityCount();
+        if (ok) { PASS } else { FAIL("Failed save damaged the previous snapshot") }
+    }
+
+    std::remove(SNAP_PATH);
+
+    std::cout << std::endl << "=== RESULTS ===" << std::endl;
+    std::cout << "Passed: " << testsPassed << std::endl;
+    std::cout << "Failed: " << (testsRun - testsPassed) << std::endl;
+
+    return (testsPassed == testsRun) ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+/**
+ * pack_builder.cpp
+ *
+ * Phase 63: Builds the precompiled data pack (see DataPack.hpp) from the
+ * JSON in the data directory. Every element, molecule, mission and structure
+ * goes through the same JsonLoader validation the game uses, once, here.
+ *
+ * Usage: ./pack_builder.exe [dataDir] [outPath]   (defaults: data data/game.pack)
+ */
+
+#include <iostream>
+#include <string>
+
+#include "../core/DataPack.hpp"
+#include "../core/Config.hpp"
+#include "raylib.h"
+
+int main(int argc, char** argv) {
+    std::string dataDir = argc > 1 ? argv[1] : Config::DATA_DIRECTORY;
+    std::string outPath = argc > 2 ? argv[2] : Config::DATA_PACK_PATH;
+
+    SetTraceLogLevel(LOG_WARNING);
+    std::string error;
+    if (!DataPack::build(dataDir, outPath, error)) {
+        std::cerr << "[PACK BUILDER] " << error << std::endl;
+        return 1;
+    }
+
+    DataPack pack;
+    if (!pack.open(outPath, dataDir)) {
+        std::cerr << "[PACK BUILDER] " << outPath << " was written but does not reopen" << std::endl;
+        return 1;
+    }
+    std::cout << "[PACK BUILDER] Wrote " << outPath << std::endl;
+    return 0;
+}
@@ -86,19 +86,18 @@ void Inspector::draw(const Element& element, int entityID, InputHandler& input,
     curY += UIConfig::SPACING_SMALL;
 
     // 4. Technical Data (Automatically update curY)
-    auto& lm = LocalizationManager::getInstance();
-    UIWidgets::drawValueLabel(lm.get("ui.inspector.electronegativity_short").c_str(), TextFormat("%.2f", element.electronegativity), curX, curY, innerWidth);
-    UIWidgets::drawValueLabel(lm.get("ui.inspector.vdw_radius_short").c_str(), TextFormat("%d pm", (int)element.vdWRadius), curX, curY, innerWidth);
-    UIWidgets::drawValueLabel(lm.get("ui.inspector.atomic_mass_short").c_str(), TextFormat("%.1f u", element.atomicMass), curX, curY, innerWidth);
-    UIWidgets::drawValueLabel(lm.get("ui.inspector.max_bonds_short").c_str(), TextFormat("%d", element.maxBonds), curX, curY, innerWidth);
+    UIWidgets::drawValueLabel(LOC("ui.inspector.electronegativity_short"), TextFormat("%.2f", element.electronegativity), curX, curY, innerWidth);
+    UIWidgets::drawValueLabel(LOC("ui.inspector.vdw_radius_short"), TextFormat("%d pm", (int)element.vdWRadius), curX, curY, innerWidth);
+    UIWidgets::drawValueLabel(LOC("ui.inspector.atomic_mass_short"), TextFormat("%.1f u", element.atomicMass), curX, curY, innerWidth);
+    UIWidgets::drawValueLabel(LOC("ui.inspector.max_bonds_short"), TextFormat("%d", element.maxBonds), curX, curY, innerWidth);
     
     // ORIGIN uses drawTextWrapped to prevent overlap
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.origin").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, Config::THEME_TEXT_SECONDARY);
+    DrawText(LOC("ui.inspector.origin"), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, Config::THEME_TEXT_SECONDARY);
     curY += UIConfig::SPACING_MEDIUM;
     UIWidgets::drawTextWrapped(element.origin.c_str(), curX, curY, innerWidth, UIConfig::FONT_SIZE_LABEL, ColorAlpha(SKYBLUE, 0.8f));
 
     curY += UIConfig::SPACING_SMALL - 2.0f;
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.lore").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, SKYBLUE);
+    DrawText(LOC("ui.inspector.lore"), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, SKYBLUE);
     curY += UIConfig::SPACING_LARGE - 1.0f;
     
     // Description with curY update
@@ -117,7 +116,7 @@ void Inspector::drawMoleculeOverlay(Rectangle rect, InputHandler& input) {
     float innerWidth = rect.width - (UIConfig::INNER_PADDING * 2.0f);
 
     // Formula and ID
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.structural_analysis").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_LABEL, GOLD);
+    DrawText(LOC("ui.inspector.structural_analysis"), (int)curX, (int)curY, UIConfig::FONT_SIZE_LABEL, GOLD);
     curY += 15.0f;
     UIWidgets::drawSeparator(curX, curY, innerWidth);
     curY += 8.0f;
@@ -133,12 +132,12 @@ void Inspector::drawMoleculeOverlay(Rectangle rect, InputHandler& input) {
     UIWidgets::drawSeparator(curX, curY, innerWidth);
     curY += 8.0f;
 
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.biological").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, Fade(currentMolecule->color, 0.8f));
+    DrawText(LOC("ui.inspector.biological"), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, Fade(currentMolecule->color, 0.8f));
     curY += 12.0f;
     UIWidgets::drawTextWrapped(currentMolecule->biologicalSignificance.c_str(), curX, curY, innerWidth, UIConfig::FONT_SIZE_LABEL, WHITE);
 
     curY += 10.0f;
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.synthesis").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, SKYBLUE);
+    DrawText(LOC("ui.inspector.synthesis"), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, SKYBLUE);
     curY += 14.0f;
     UIWidgets::drawTextWrapped(currentMolecule->description.c_str(), curX, curY, innerWidth, UIConfig::FONT_SIZE_LABEL, Fade(WHITE, 0.9f));
 }
@@ -148,12 +147,12 @@ void Inspector::drawTransitoryMoleculeOverlay(Rectangle rect, InputHandler& inpu
     float curY = rect.y + UIConfig::HEADER_HEIGHT + 4.0f;
     float innerWidth = rect.width - (UIConfig::INNER_PADDING * 2.0f);
 
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.transitory_status").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_LABEL, SKYBLUE);
+    DrawText(LOC("ui.inspector.transitory_status"), (int)curX, (int)curY, UIConfig::FONT_SIZE_LABEL, SKYBLUE);
     curY += 15.0f;
     UIWidgets::drawSeparator(curX, curY, innerWidth);
     curY += 8.0f;
 
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.composition").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, GRAY);
+    DrawText(LOC("ui.inspector.composition"), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, GRAY);
     curY += 15.0f;
 
     for (auto const& [atomicNum, count] : currentComposition) {
@@ -166,9 +165,9 @@ void Inspector::drawTransitoryMoleculeOverlay(Rectangle rect, InputHandler& inpu
     UIWidgets::drawSeparator(curX, curY, innerWidth);
     curY += 10.0f;
 
-    DrawText(LocalizationManager::getInstance().get("ui.inspector.primordial_analysis").c_str(), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, GOLD);
+    DrawText(LOC("ui.inspector.primordial_analysis"), (int)curX, (int)curY, UIConfig::FONT_SIZE_SMALL, GOLD);
     curY += 12.0f;
-    UIWidgets::drawTextWrapped(LocalizationManager::getInstance().get("ui.inspector.unknown_desc").c_str(), 
+    UIWidgets::drawTextWrapped(LOC("ui.inspector.unknown_desc"), 
                                curX, curY, innerWidth, UIConfig::FONT_SIZE_LABEL, Fade(WHITE, 0.8f));
 
     curY = rect.y + rect.height - 30;
@@ -0,0 +1,99 @@
+#include "LabelCache.hpp"
+#include "../core/LocalizationManager.hpp"
+#include "../chemistry/ChemistryDatabase.hpp"
+#include <algorithm>
+
+namespace {
+    constexpr int DEFAULT_FONT_SIZE = 10;  // DrawText() never goes below the default font's height
+}
+
+void LabelCache::begin() {
+    int language = LocalizationManager::getInstance().getGeneration();
+    int catalog = ChemistryDatabase::getInstance().getGeneration();
+    if (language != languageGeneration || catalog != catalogGeneration) {
+        symbols.clear();
+        localizedLabels.clear();
+        languageGeneration = language;
+        catalogGeneration = catalog;
+    }
+    batch.clear();
+    labelCount = 0;
+}
+
+const LabelCache::Label& LabelCache::symbol(int atomicNumber, int fontSize) {
+    static const Label empty;
+    if (atomicNumber < 0 || fontSize < 0) return empty;
+    if (fontSize >= (int)symbols.size()) symbols.resize(fontSize + 1);
+    std::vector<Label>& bySize = symbols[fontSize];
+    if (atomicNumber >= (int)bySize.size()) bySize.resize(atomicNumber + 1);
+    Label& label = bySize[atomicNumber];
+    if (label.text.empty()) {
+        label = layout(ChemistryDatabase::getInstance().getElement(atomicNumber).symbol, fontSize);
+    }
+    return label;
+}
+
+const LabelCache::Label& LabelCache::localized(const std::string& key, int fontSize) {
+    std::string cacheKey = std::to_string(fontSize) + ":" + key;
+    auto it = localizedLabels.find(cacheKey);
+    if (it == localizedLabels.end()) {
+        it = localizedLabels.emplace(cacheKey, layout(LocalizationManager::getInstance().get(key), fontSize)).first;
+    }
+    return it->second;
+}
+
+// Same placement as DrawTextEx()/DrawTextCodepoint() for one line of the default font
+LabelCache::Label LabelCache::layout(const std::string& text, int fontSize) {
+    layouts++;
+    Label label;
+    label.text = text;
+    label.width = MeasureText(text.c_str(), fontSize);
+
+    Font font = GetFontDefault();
+    if (font.texture.id == 0 || font.glyphCount == 0) return label;
+    float size = (float)std::max(fontSize, DEFAULT_FONT_SIZE);
+    float spacing = (float)((int)size / DEFAULT_FONT_SIZE);
+    float scale = size / (float)font.baseSize;
+    float pad = (float)font.glyphPadding;
+    float texW = (float)font.texture.width;
+    float texH = (float)font.texture.height;
+
+    float penX = 0.0f;
+    const char* p = text.c_str();
+    while (*p) {
+        int bytes = 0;
+        int codepoint = GetCodepointNext(p, &bytes);
+        p += std::max(bytes, 1);
+        int index = GetGlyphIndex(font, codepoint);
+        const Rectangle& rec = font.recs[index];
+        const GlyphInfo& info = font.glyphs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            Glyph g;
+            g.dest = { penX + info.offsetX * scale - pad * scale, info.offsetY * scale - pad * scale,
+                       (rec.width + 2.0f * pad) * scale, (rec.height + 2.0f * pad) * scale };
+            g.uv = { (rec.x - pad) / texW, (rec.y - pad) / texH, (rec.width + 2.0f * pad) / texW, (rec.height + 2.0f * pad) / texH };
+            label.glyphs.push_back(g);
+        }
+        penX += (info.advanceX == 0 ? rec.width * scale : info.advanceX * scale) + spacing;
+    }
+    return label;
+}
+
+void LabelCache::add(const Label& label, int x, int y, Color color) {
+    for (const Glyph& g : label.glyphs) {
+        batch.addQuad({ x + g.dest.x, y + g.dest.y, g.dest.width, g.dest.height }, g.uv, color);
+    }
+    labelCount++;
+}
+
+void LabelCache::draw() {
+    if (batch.getQuadCount() == 0) return;
+    batch.draw(GetFontDefault().texture.id);
+}
+
+void LabelCache::unload() {
+    batch.unload();
+    symbols.clear();
+    localizedLabels.clear();
+}
@@ -0,0 +1,63 @@
+#ifndef LABEL_CACHE_HPP
+#define LABEL_CACHE_HPP
+
+#include "raylib.h"
+#include "../rendering/QuadBatch.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * LabelCache (Phase 61)
+ * World-space labels without per-frame text work. Element symbols (per
+ * atomic number and font size) and localised strings (per key and font size)
+ * are measured and laid out into glyph quads once, using the same metrics as
+ * DrawText()/MeasureText() with the default font. Each frame only offsets
+ * those quads into one QuadBatch drawn with the font texture.
+ *
+ * Layouts are dropped when the language or the element catalog changes
+ * (LocalizationManager / ChemistryDatabase generations).
+ *
+ * Requires the default font (after InitWindow); unload() before CloseWindow().
+ */
+class LabelCache {
+public:
+    struct Glyph {
+        Rectangle dest;  // Relative to the label's top-left corner
+        Rectangle uv;    // Normalised font-atlas rect
+    };
+
+    struct Label {
+        std::string text;
+        int width = 0;  // == MeasureText(text, fontSize)
+        std::vector<Glyph> glyphs;
+    };
+
+    // Drops stale layouts and clears last frame's quads
+    void begin();
+
+    const Label& symbol(int atomicNumber, int fontSize);
+    const Label& localized(const std::string& key, int fontSize);
+
+    // Top-left corner at (x, y), snapped to whole pixels like DrawText()
+    void add(const Label& label, int x, int y, Color color);
+
+    void draw();
+    void unload();
+
+    int getLabelCount() const { return labelCount; }
+    int getLayoutCount() const { return layouts; }
+
+private:
+    QuadBatch batch;
+    std::vector<std::vector<Label>> symbols;               // [fontSize][atomicNumber]
+    std::unordered_map<std::string, Label> localizedLabels; // "<fontSize>:<key>"
+    int languageGeneration = -1;
+    int catalogGeneration = -1;
+    int labelCount = 0;
+    int layouts = 0;  // Labels laid out since startup (cache misses)
+
+    Label layout(const std::string& text, int fontSize);
+};
+
+#endif // LABEL_CACHE_HPP
@@ -1,46 +1,78 @@
 #include "LabelSystem.hpp"
-#include "../chemistry/ChemistryDatabase.hpp"
+#include "LabelCache.hpp"
 #include "../core/Config.hpp"
-#include "../core/LocalizationManager.hpp"
+#include "../physics/SpatialGrid.hpp"
+#include "../rendering/CameraSystem.hpp"
+#include "../rendering/Renderer25D.hpp"
+#include "../rendering/MoleculeImpostors.hpp"
 #include <algorithm>
 
+// Phase 61: Pre-measured layouts, emitted as one glyph batch per frame
+namespace {
+    LabelCache cache;
+}
+
 void LabelSystem::draw(const Camera2D& camera, 
                        const std::vector<TransformComponent>& transforms, 
-                       const std::vector<AtomComponent>& atoms) {
+                       const std::vector<AtomComponent>& atoms,
+                       const std::vector<StateComponent>& states,
+                       const SpatialGrid& grid) {
     
-    ChemistryDatabase& db = ChemistryDatabase::getInstance();
     float zoom = camera.zoom;
     const float ATOM_THRESHOLD = Config::LABEL_ATOM_THRESHOLD;
+
+    // Phase 60: Far out the density texture carries no labels; at impostor level
+    // each large molecule is labelled once at its centroid
+    LodLevel level = Renderer25D::getLodLevel(zoom);
+    if (level == LodLevel::DENSITY) return;
+    cache.begin();
+    float clusterAlpha = std::clamp((ATOM_THRESHOLD - zoom) * Config::LABEL_FADE_SPEED, 0.0f, 0.8f);
+    const int clusterFontSize = Config::LABEL_FONT_SIZE + 2;
+    const LabelCache::Label& clusterName = cache.localized("ui.label.complex_cluster", clusterFontSize);
+
+    // Phase 58: Measure and draw text only for atoms near the view
+    Rectangle view = CameraSystem::getViewRect(camera, Config::RENDER_CULL_MARGIN);
+    if (level == LodLevel::MOLECULES) {
+        if (clusterAlpha <= 0.05f) return;
+        for (const MoleculeImpostor& m : Renderer25D::getImpostors().getImpostors()) {
+            if (m.count < Config::LOD_LABEL_MIN_ATOMS) continue;
+            if (!CheckCollisionPointRec({ m.x, m.y }, view)) continue;
+            cache.add(clusterName, (int)m.x - clusterName.width / 2, (int)m.y - clusterFontSize / 2, Fade(SKYBLUE, clusterAlpha));
+        }
+        cache.draw();
+        return;
+    }
+
+    static std::vector<int> visible;
+    visible.clear();
+    grid.queryRect(view, visible);
+
+    float symbolAlpha = std::clamp((zoom - ATOM_THRESHOLD) * Config::LABEL_FADE_SPEED, 0.0f, 1.0f);
+    Color symbolColor = Fade(WHITE, symbolAlpha);
+    const int fontSize = Config::LABEL_FONT_SIZE;
     
-    for (size_t i = 0; i < transforms.size(); i++) {
+    for (int i : visible) {
+        if (i >= (int)states.size() || !states[i].isAlive) continue;
         const TransformComponent& tr = transforms[i];
-        const AtomComponent& atom = atoms[i];
         
         if (zoom >= ATOM_THRESHOLD) {
-            const Element& element = db.getElement(atom.atomicNumber);
-            
-            float alpha = std::clamp((zoom - ATOM_THRESHOLD) * Config::LABEL_FADE_SPEED, 0.0f, 1.0f);
-            if (alpha <= 0.05f) continue;
-
-            Color textColor = Fade(WHITE, alpha);
-            int fontSize = Config::LABEL_FONT_SIZE;
-            int textX = (int)tr.x - (MeasureText(element.symbol.c_str(), fontSize) / 2);
-            int textY = (int)tr.y - (fontSize / 2);
+            if (symbolAlpha <= 0.05f) break;
 
-            DrawText(element.symbol.c_str(), textX, textY, fontSize, textColor);
+            const LabelCache::Label& symbol = cache.symbol(atoms[i].atomicNumber, fontSize);
+            cache.add(symbol, (int)tr.x - symbol.width / 2, (int)tr.y - fontSize / 2, symbolColor);
         }
         else {
-            if (i % 15 == 0) { 
-                float alpha = std::clamp((ATOM_THRESHOLD - zoom) * Config::LABEL_FADE_SPEED, 0.0f, 0.8f);
-                if (alpha <= 0.05f) continue;
+            // Phase 60: One label per bonded molecule, on its root (was every 15th atom)
+            if (states[i].moleculeId == i && !states[i].childList.empty()) {
+                if (clusterAlpha <= 0.05f) break;
 
-                std::string molName = LocalizationManager::getInstance().get("ui.label.complex_cluster");
-                int fontSize = Config::LABEL_FONT_SIZE + 2;
-                int textX = (int)tr.x - (MeasureText(molName.c_str(), fontSize) / 2);
-                int textY = (int)tr.y - (fontSize / 2);
-
-                DrawText(molName.c_str(), textX, textY, fontSize, Fade(SKYBLUE, alpha));
+                cache.add(clusterName, (int)tr.x - clusterName.width / 2, (int)tr.y - clusterFontSize / 2, Fade(SKYBLUE, clusterAlpha));
             }
         }
     }
+    cache.draw();
+}
+
+void LabelSystem::shutdown() {
+    cache.unload();
 }
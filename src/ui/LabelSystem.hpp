@@ -5,14 +5,22 @@
 #include "../ecs/components.hpp"
 #include <vector>
 
+class SpatialGrid;
+
 /**
  * SISTEMA DE ETIQUETAS (LABELS)
+ * Phase 61: Textos pre-medidos en LabelCache, dibujados en un solo lote de glifos.
  */
 class LabelSystem {
 public:
     static void draw(const Camera2D& camera, 
                      const std::vector<TransformComponent>& transforms, 
-                     const std::vector<AtomComponent>& atoms);
+                     const std::vector<AtomComponent>& atoms,
+                     const std::vector<StateComponent>& states,
+                     const SpatialGrid& grid);
+
+    // Phase 61: Releases the label glyph batch (call before CloseWindow)
+    static void shutdown();
 };
 
 #endif
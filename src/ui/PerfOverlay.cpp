@@ -0,0 +1,211 @@
+#include "PerfOverlay.hpp"
+#include "../core/Config.hpp"
+#include "../physics/PhysicsEngine.hpp"
+#include "../rendering/CameraSystem.hpp"
+#include "../rendering/Renderer25D.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const Color SIM_COLOR = SKYBLUE;
+    const Color RENDER_COLOR = LIME;
+    const Color UI_COLOR = GOLD;
+    const Color OTHER_COLOR = { 90, 90, 100, 255 };  // Present/vsync and untimed work
+
+    constexpr float PANEL_WIDTH = 340.0f;
+    constexpr float PADDING = 8.0f;
+    constexpr int FONT = 10;
+    constexpr int LINE = 13;
+
+    // Cold (few atoms) to hot (PERF_HEATMAP_FULL_ATOMS and more)
+    Color heatColor(float t) {
+        t = std::clamp(t, 0.0f, 1.0f);
+        unsigned char r = (unsigned char)(40 + 215 * t);
+        unsigned char g = (unsigned char)(120 * (1.0f - std::abs(t - 0.5f) * 2.0f) + 40 * (1.0f - t));
+        unsigned char b = (unsigned char)(200 * (1.0f - t));
+        return { r, g, b, (unsigned char)(60 + 100 * t) };
+    }
+
+    const char* formatBytes(size_t bytes) {
+        if (bytes >= 1024 * 1024) return TextFormat("%.2f MB", bytes / (1024.0 * 1024.0));
+        return TextFormat("%.1f KB", bytes / 1024.0);
+    }
+}
+
+PerfOverlay::PerfOverlay() : history(Config::PERF_HISTORY_FRAMES) {}
+
+void PerfOverlay::recordFrame(const FrameTiming& timing) {
+    history[head] = timing;
+    head = (head + 1) % (int)history.size();
+}
+
+void PerfOverlay::refreshCounts(const std::vector<TransformComponent>& transforms,
+                                const std::vector<AtomComponent>& atoms,
+                                const std::vector<StateComponent>& states) {
+    WorldCounts c;
+    c.entities = (int)states.size();
+    std::vector<char> seenRing;
+    for (int i = 0; i < (int)states.size(); i++) {
+        const StateComponent& s = states[i];
+        c.childListBytes += s.childList.capacity() * sizeof(int);
+        if (!s.isAlive) continue;
+        c.alive++;
+        if (s.parentEntityId != -1) c.bonds++;
+        if (s.cycleBondId > i) c.bonds++;  // Each cycle bond is stored on both ends
+        if (s.isInRing && s.ringInstanceId > 0) {
+            if (s.ringInstanceId >= (int)seenRing.size()) seenRing.resize(s.ringInstanceId + 1, 0);
+            if (!seenRing[s.ringInstanceId]) {
+                seenRing[s.ringInstanceId] = 1;
+                c.rings++;
+            }
+        }
+        if (s.parentEntityId == -1 && (!s.childList.empty() || s.cycleBondId != -1)) c.molecules++;
+    }
+    c.transformBytes = transforms.capacity() * sizeof(TransformComponent);
+    c.atomBytes = atoms.capacity() * sizeof(AtomComponent);
+    c.stateBytes = states.capacity() * sizeof(StateComponent);
+    counts = c;
+}
+
+void PerfOverlay::drawHeatmap(const Camera2D& camera, const SpatialGrid& grid) {
+    if (!visible) return;
+    const float cellSize = grid.getCellSize();
+    heatCells.clear();
+    grid.queryCellCounts(CameraSystem::getViewRect(camera, 0.0f), heatCells);
+
+    bool showCounts = cellSize * camera.zoom >= 40.0f;  // Enough room on screen for a number
+    for (const GridCellCount& cell : heatCells) {
+        float t = (float)cell.count / (float)Config::PERF_HEATMAP_FULL_ATOMS;
+        Rectangle r = { cell.cx * cellSize, cell.cy * cellSize, cellSize, cellSize };
+        DrawRectangleRec(r, heatColor(t));
+        DrawRectangleLinesEx(r, 1.0f / camera.zoom, Fade(WHITE, 0.08f));
+        if (showCounts) {
+            DrawText(TextFormat("%d", cell.count), (int)(r.x + 4), (int)(r.y + 4), (int)(12 / camera.zoom) + 1, Fade(WHITE, 0.7f));
+        }
+    }
+}
+
+void PerfOverlay::drawFrameGraph(Rectangle area) {
+    DrawRectangleRec(area, Fade(BLACK, 0.5f));
+    // Vertical scale: twice the frame budget, so a frame at budget sits in the middle
+    const float scaleMs = Config::PERF_FRAME_BUDGET_MS * 2.0f;
+    const int n = (int)history.size();
+    const float barW = area.width / (float)n;
+
+    for (int k = 0; k < n; k++) {
+        const FrameTiming& f = history[(head + k) % n];  // Oldest first
+        float x = area.x + k * barW;
+        float y = area.y + area.height;
+        auto segment = [&](float ms, Color color) {
+            float h = std::min(ms / scaleMs, 1.0f) * area.height;
+            h = std::min(h, y - area.y);
+            if (h <= 0.0f) return;
+            DrawRectangleRec({ x, y - h, std::max(barW, 1.0f), h }, color);
+            y -= h;
+        };
+        float other = f.frameMs - f.simMs - f.renderMs - f.uiMs;
+        segment(f.simMs, SIM_COLOR);
+        segment(f.renderMs, RENDER_COLOR);
+        segment(f.uiMs, UI_COLOR);
+        segment(std::max(other, 0.0f), OTHER_COLOR);
+    }
+
+    float budgetY = area.y + area.height * 0.5f;
+    DrawLineEx({ area.x, budgetY }, { area.x + area.width, budgetY }, 1.0f, Fade(RED, 0.6f));
+    DrawText(TextFormat("%.1f ms", Config::PERF_FRAME_BUDGET_MS), (int)(area.x + 2), (int)budgetY - 11, FONT, Fade(RED, 0.8f));
+}
+
+void PerfOverlay::drawPhaseBars(Rectangle area, const PhysicsEngine& physics) {
+    const PhysicsTimings& t = physics.getTimings();
+    float total = t.total();
+    float maxMs = 0.0f;
+    for (float v : t.ms) maxMs = std::max(maxMs, v);
+    if (maxMs <= 0.0f) maxMs = 1.0f;
+
+    const float labelW = 90.0f;
+    const float valueW = 60.0f;
+    const float barMaxW = area.width - labelW - valueW;
+    float y = area.y;
+    for (int p = 0; p < (int)PhysicsPhase::COUNT; p++) {
+        float ms = t.ms[p];
+        DrawText(PhysicsTimings::name((PhysicsPhase)p), (int)area.x, (int)y, FONT, Config::THEME_TEXT_SECONDARY);
+        DrawRectangleRec({ area.x + labelW, y + 1, barMaxW * (ms / maxMs), (float)FONT - 1 }, SIM_COLOR);
+        DrawText(TextFormat("%.3f ms", ms), (int)(area.x + labelW + barMaxW + 4), (int)y, FONT, Config::THEME_TEXT_PRIMARY);
+        y += LINE - 1;
+    }
+    DrawText(TextFormat("Step total %.3f ms", total), (int)area.x, (int)y, FONT, Config::THEME_HIGHLIGHT);
+}
+
+void PerfOverlay::draw(const std::vector<TransformComponent>& transforms,
+                       const std::vector<AtomComponent>& atoms,
+                       const std::vector<StateComponent>& states,
+                       const PhysicsEngine& physics) {
+    if (!visible) return;
+    if (framesSinceScan-- <= 0) {
+        refreshCounts(transforms, atoms, states);
+        framesSinceScan = Config::PERF_STATS_INTERVAL;
+    }
+
+    // Averages over the whole history window
+    FrameTiming avg;
+    float worst = 0.0f;
+    for (const FrameTiming& f : history) {
+        avg.simMs += f.simMs;
+        avg.renderMs += f.renderMs;
+        avg.uiMs += f.uiMs;
+        avg.frameMs += f.frameMs;
+        worst = std::max(worst, f.frameMs);
+    }
+    float n = (float)history.size();
+    avg.simMs /= n; avg.renderMs /= n; avg.uiMs /= n; avg.frameMs /= n;
+
+    const float graphH = 70.0f;
+    const float phasesH = (float)((int)PhysicsPhase::COUNT + 1) * (LINE - 1);
+    const float panelH = PADDING * 2 + LINE * 2 + graphH + PADDING + phasesH + PADDING + LINE * 7;
+    Rectangle panel = { GetScreenWidth() - PANEL_WIDTH - 10.0f, (float)Config::HUD_HEIGHT + 10.0f, PANEL_WIDTH, panelH };
+    DrawRectangleRec(panel, Fade(Config::THEME_BACKDROP, 0.85f));
+    DrawRectangleLinesEx(panel, 1.0f, Config::THEME_BORDER);
+
+    float x = panel.x + PADDING;
+    float y = panel.y + PADDING;
+    float w = panel.width - PADDING * 2;
+
+    DrawText(TextFormat("PERFORMANCE (F3)   avg %.2f ms   worst %.2f ms", avg.frameMs, worst),
+             (int)x, (int)y, FONT, Config::THEME_ACCENT);
+    y += LINE;
+    DrawText(TextFormat("sim %.2f", avg.simMs), (int)x, (int)y, FONT, SIM_COLOR);
+    DrawText(TextFormat("render %.2f", avg.renderMs), (int)(x + 70), (int)y, FONT, RENDER_COLOR);
+    DrawText(TextFormat("ui %.2f", avg.uiMs), (int)(x + 160), (int)y, FONT, UI_COLOR);
+    DrawText(TextFormat("other %.2f", std::max(avg.frameMs - avg.simMs - avg.renderMs - avg.uiMs, 0.0f)),
+             (int)(x + 225), (int)y, FONT, OTHER_COLOR);
+    y += LINE;
+
+    drawFrameGraph({ x, y, w, graphH });
+    y += graphH + PADDING;
+
+    drawPhaseBars({ x, y, w, phasesH }, physics);
+    y += phasesH + PADDING;
+
+    DrawText(TextFormat("Entities %d (alive %d)   Bonds %d", counts.entities, counts.alive, counts.bonds),
+             (int)x, (int)y, FONT, Config::THEME_TEXT_PRIMARY);
+    y += LINE;
+    DrawText(TextFormat("Rings %d   Molecules %d", counts.rings, counts.molecules),
+             (int)x, (int)y, FONT, Config::THEME_TEXT_PRIMARY);
+    y += LINE;
+
+    const RenderStats& rs = Renderer25D::getStats();
+    DrawText(TextFormat("Visible %d   Draw calls %d   LOD %d   Grid cells in view %d",
+                        rs.visibleEntities, rs.drawCalls, rs.lodLevel, (int)heatCells.size()),
+             (int)x, (int)y, FONT, Config::THEME_TEXT_SECONDARY);
+    y += LINE;
+
+    size_t total = counts.transformBytes + counts.atomBytes + counts.stateBytes + counts.childListBytes;
+    DrawText(TextFormat("Memory %s", formatBytes(total)), (int)x, (int)y, FONT, Config::THEME_HIGHLIGHT);
+    y += LINE;
+    DrawText(TextFormat("  transforms %s", formatBytes(counts.transformBytes)), (int)x, (int)y, FONT, Config::THEME_TEXT_SECONDARY);
+    y += LINE;
+    DrawText(TextFormat("  atoms %s   states %s", formatBytes(counts.atomBytes), formatBytes(counts.stateBytes)),
+             (int)x, (int)y, FONT, Config::THEME_TEXT_SECONDARY);
+    y += LINE;
+    DrawText(TextFormat("  childList heap %s", formatBytes(counts.childListBytes)), (int)x, (int)y, FONT, Config::THEME_TEXT_SECONDARY);
+}
@@ -0,0 +1,74 @@
+#ifndef PERF_OVERLAY_HPP
+#define PERF_OVERLAY_HPP
+
+#include "raylib.h"
+#include "../ecs/components.hpp"
+#include "../physics/SpatialGrid.hpp"
+#include <cstddef>
+#include <vector>
+
+class PhysicsEngine;
+
+// Phase 67: One rendered frame split by where its time went
+struct FrameTiming {
+    float simMs = 0.0f;     // Fixed steps run this frame
+    float renderMs = 0.0f;  // World pass (BeginMode2D .. EndMode2D)
+    float uiMs = 0.0f;      // Screen-space pass
+    float frameMs = 0.0f;   // Whole frame as reported by raylib (includes present/vsync)
+};
+
+/**
+ * PerfOverlay (Phase 67)
+ * F3 overlay for designers: rolling frame-time graph split into
+ * simulation / render / UI, a bar per PhysicsEngine phase, world counts, a
+ * per-component-array memory breakdown and an occupancy heatmap of the
+ * spatial grid under the camera. World scans run every
+ * Config::PERF_STATS_INTERVAL frames and only while the overlay is shown.
+ */
+class PerfOverlay {
+public:
+    PerfOverlay();
+
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+
+    // Call once per rendered frame (also while hidden, so the graph is warm when opened)
+    void recordFrame(const FrameTiming& timing);
+
+    // World space: call inside BeginMode2D
+    void drawHeatmap(const Camera2D& camera, const SpatialGrid& grid);
+
+    // Screen space
+    void draw(const std::vector<TransformComponent>& transforms,
+              const std::vector<AtomComponent>& atoms,
+              const std::vector<StateComponent>& states,
+              const PhysicsEngine& physics);
+
+private:
+    struct WorldCounts {
+        int entities = 0;
+        int alive = 0;
+        int bonds = 0;        // Hierarchy bonds + cycle bonds
+        int rings = 0;
+        int molecules = 0;    // Roots with at least one bond
+        size_t transformBytes = 0;
+        size_t atomBytes = 0;
+        size_t stateBytes = 0;
+        size_t childListBytes = 0;  // Heap behind StateComponent::childList
+    };
+
+    void refreshCounts(const std::vector<TransformComponent>& transforms,
+                       const std::vector<AtomComponent>& atoms,
+                       const std::vector<StateComponent>& states);
+    void drawFrameGraph(Rectangle area);
+    void drawPhaseBars(Rectangle area, const PhysicsEngine& physics);
+
+    bool visible = false;
+    std::vector<FrameTiming> history;  // Ring of PERF_HISTORY_FRAMES
+    int head = 0;                      // Next slot to write
+    int framesSinceScan = 0;
+    WorldCounts counts;
+    std::vector<GridCellCount> heatCells;  // Reused per frame
+};
+
+#endif // PERF_OVERLAY_HPP
@@ -30,7 +30,7 @@ void Quimidex::draw(InputHandler& input) {
     Rectangle rect = { (screenW - width) / 2, (screenH - height) / 2, width, height };
 
     UIWidgets::drawPanel(rect, input, Config::THEME_HIGHLIGHT);
-    UIWidgets::drawHeader(rect, LocalizationManager::getInstance().get("ui.quimidex.title").c_str(), Config::THEME_HIGHLIGHT);
+    UIWidgets::drawHeader(rect, LOC("ui.quimidex.title"), Config::THEME_HIGHLIGHT);
 
     // Close button (X) - vertically centered, with padding from edge
     float closeSize = 14.0f;
@@ -73,8 +73,7 @@ void Quimidex::drawAtomsTab(Rectangle rect, InputHandler& input) {
 }
 
 void Quimidex::drawAtomDetail(Rectangle rect, const Element& element, InputHandler& input) {
-    auto& lm = LocalizationManager::getInstance();
-    DrawText(lm.get("ui.quimidex.atom_detail").c_str(), (int)rect.x, (int)rect.y, UIConfig::FONT_SIZE_HEADER, LIME);
+    DrawText(LOC("ui.quimidex.atom_detail"), (int)rect.x, (int)rect.y, UIConfig::FONT_SIZE_HEADER, LIME);
     UIWidgets::drawSeparator(rect.x, rect.y + 15, rect.width);
 
     float curY = rect.y + 25;
@@ -83,22 +82,22 @@ void Quimidex::drawAtomDetail(Rectangle rect, const Element& element, InputHandl
     UIWidgets::drawElementCard(element, rect.x, curY, 60.0f, input); 
 
     DrawText(element.name.c_str(), (int)rect.x + 70, (int)curY, 18, WHITE);
-    DrawText(TextFormat("[%s] %s %d", element.symbol.c_str(), lm.get("ui.quimidex.atomic_number").c_str(), element.atomicNumber), (int)rect.x + 70, (int)curY + 22, UIConfig::FONT_SIZE_HEADER, GRAY);
+    DrawText(TextFormat("[%s] %s %d", element.symbol.c_str(), LOC("ui.quimidex.atomic_number"), element.atomicNumber), (int)rect.x + 70, (int)curY + 22, UIConfig::FONT_SIZE_HEADER, GRAY);
 
     curY += 75;
     UIWidgets::drawSeparator(rect.x, curY, rect.width);
     curY += 10;
 
-    UIWidgets::drawValueLabel(lm.get("ui.quimidex.electronegativity").c_str(), TextFormat("%.2f", element.electronegativity), rect.x, curY, rect.width);
-    UIWidgets::drawValueLabel(lm.get("ui.quimidex.vdw_radius").c_str(), TextFormat("%d pm", (int)element.vdWRadius), rect.x, curY, rect.width);
-    UIWidgets::drawValueLabel(lm.get("ui.quimidex.atomic_mass").c_str(), TextFormat("%.2f u", element.atomicMass), rect.x, curY, rect.width);
-    UIWidgets::drawValueLabel(lm.get("ui.quimidex.max_bonds").c_str(), TextFormat("%d", element.maxBonds), rect.x, curY, rect.width);
+    UIWidgets::drawValueLabel(LOC("ui.quimidex.electronegativity"), TextFormat("%.2f", element.electronegativity), rect.x, curY, rect.width);
+    UIWidgets::drawValueLabel(LOC("ui.quimidex.vdw_radius"), TextFormat("%d pm", (int)element.vdWRadius), rect.x, curY, rect.width);
+    UIWidgets::drawValueLabel(LOC("ui.quimidex.atomic_mass"), TextFormat("%.2f u", element.atomicMass), rect.x, curY, rect.width);
+    UIWidgets::drawValueLabel(LOC("ui.quimidex.max_bonds"), TextFormat("%d", element.maxBonds), rect.x, curY, rect.width);
 
-    DrawText(lm.get("ui.inspector.description").c_str(), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, RED);
+    DrawText(LOC("ui.inspector.description"), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, RED);
     curY += 15;
     UIWidgets::drawTextWrapped(element.description.c_str(), rect.x, curY, rect.width, UIConfig::FONT_SIZE_LABEL, WHITE);
 
-    DrawText(TextFormat(" %s: %s", lm.get("ui.inspector.origin").c_str(), element.origin.c_str()), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, GOLD);
+    DrawText(TextFormat(" %s: %s", LOC("ui.inspector.origin"), element.origin.c_str()), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, GOLD);
     curY += 15;
 }
 
@@ -120,8 +119,7 @@ void Quimidex::drawMoleculesTab(Rectangle rect, InputHandler& input) {
 }
 
 void Quimidex::drawMoleculeDetail(Rectangle rect, const Molecule& molecule, InputHandler& input) {
-    auto& lm = LocalizationManager::getInstance();
-    DrawText(lm.get("ui.quimidex.structural_analysis").c_str(), (int)rect.x, (int)rect.y, UIConfig::FONT_SIZE_HEADER, SKYBLUE);
+    DrawText(LOC("ui.quimidex.structural_analysis"), (int)rect.x, (int)rect.y, UIConfig::FONT_SIZE_HEADER, SKYBLUE);
     UIWidgets::drawSeparator(rect.x, rect.y + 15, rect.width);
 
     float curY = rect.y + 25;
@@ -131,16 +129,16 @@ void Quimidex::drawMoleculeDetail(Rectangle rect, const Molecule& molecule, Inpu
     DrawText(molecule.formula.c_str(), (int)rect.x + 5, (int)curY + 20, 15, molecule.color);
 
     DrawText(molecule.name.c_str(), (int)rect.x + 70, (int)curY, 18, WHITE);
-    DrawText(TextFormat("%s %s | %s", lm.get("ui.quimidex.formula").c_str(), molecule.formula.c_str(), molecule.category.c_str()), (int)rect.x + 70, (int)curY + 22, UIConfig::FONT_SIZE_HEADER, GRAY);
+    DrawText(TextFormat("%s %s | %s", LOC("ui.quimidex.formula"), molecule.formula.c_str(), molecule.category.c_str()), (int)rect.x + 70, (int)curY + 22, UIConfig::FONT_SIZE_HEADER, GRAY);
 
     curY += 75;
     UIWidgets::drawSeparator(rect.x, curY, rect.width);
     curY += 10;
 
-    DrawText(lm.get("ui.quimidex.history").c_str(), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, GRAY); curY += 15;
+    DrawText(LOC("ui.quimidex.history"), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, GRAY); curY += 15;
     UIWidgets::drawTextWrapped(molecule.description.c_str(), rect.x, curY, rect.width, UIConfig::FONT_SIZE_LABEL, WHITE);
 
-    DrawText(lm.get("ui.quimidex.confluence").c_str(), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, LIME); curY += 15;
+    DrawText(LOC("ui.quimidex.confluence"), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, LIME); curY += 15;
     UIWidgets::drawTextWrapped(molecule.biologicalSignificance.c_str(), rect.x, curY, rect.width, UIConfig::FONT_SIZE_LABEL, WHITE);
 }
 
@@ -161,29 +159,27 @@ void Quimidex::drawProgressionTab(Rectangle rect, InputHandler& input) {
 }
 
 void Quimidex::drawMissionDetail(Rectangle rect, const Mission& mission) {
-    auto& lm = LocalizationManager::getInstance();
     DrawText(TextFormat("== %s ==", mission.title.c_str()), (int)rect.x, (int)rect.y, 14, WHITE);
     
-    std::string statusLabel = lm.get("ui.quimidex.mission_status") + " ";
-    std::string statusValue = "";
+    const char* statusValue = "";
     Color statusColor = WHITE;
     switch(mission.status) {
-        case MissionStatus::LOCKED: statusValue = lm.get("ui.quimidex.status.locked"); statusColor = GRAY; break;
-        case MissionStatus::AVAILABLE: statusValue = lm.get("ui.quimidex.status.available"); statusColor = SKYBLUE; break;
-        case MissionStatus::ACTIVE: statusValue = lm.get("ui.quimidex.status.active"); statusColor = GOLD; break;
-        case MissionStatus::COMPLETED: statusValue = lm.get("ui.quimidex.status.completed"); statusColor = LIME; break;
+        case MissionStatus::LOCKED: statusValue = LOC("ui.quimidex.status.locked"); statusColor = GRAY; break;
+        case MissionStatus::AVAILABLE: statusValue = LOC("ui.quimidex.status.available"); statusColor = SKYBLUE; break;
+        case MissionStatus::ACTIVE: statusValue = LOC("ui.quimidex.status.active"); statusColor = GOLD; break;
+        case MissionStatus::COMPLETED: statusValue = LOC("ui.quimidex.status.completed"); statusColor = LIME; break;
     }
-    DrawText((statusLabel + statusValue).c_str(), (int)rect.x, (int)rect.y + 20, UIConfig::FONT_SIZE_HEADER, statusColor);
+    DrawText(TextFormat("%s %s", LOC("ui.quimidex.mission_status"), statusValue), (int)rect.x, (int)rect.y + 20, UIConfig::FONT_SIZE_HEADER, statusColor);
     
     UIWidgets::drawSeparator(rect.x, rect.y + 40, rect.width);
 
     float curY = rect.y + 50;
     UIWidgets::drawTextWrapped(mission.description.c_str(), rect.x, curY, rect.width, UIConfig::FONT_SIZE_LABEL, WHITE);
 
-    DrawText(lm.get("ui.quimidex.scientific_context").c_str(), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, SKYBLUE); curY += 15;
+    DrawText(LOC("ui.quimidex.scientific_context"), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, SKYBLUE); curY += 15;
     UIWidgets::drawTextWrapped(mission.scientificContext.c_str(), rect.x, curY, rect.width, UIConfig::FONT_SIZE_LABEL, WHITE);
 
     UIWidgets::drawSeparator(rect.x, curY, rect.width); curY += 10;
-    DrawText(lm.get("ui.quimidex.reward").c_str(), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, LIME); curY += 15;
+    DrawText(LOC("ui.quimidex.reward"), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_SMALL, LIME); curY += 15;
     DrawText(mission.reward.c_str(), (int)rect.x, (int)curY, UIConfig::FONT_SIZE_HEADER, WHITE);
 }
@@ -0,0 +1,350 @@
+#include "ChunkStreamer.hpp"
+#include "../ecs/World.hpp"
+#include "../physics/MolecularHierarchy.hpp"
+#include "../core/BinaryIO.hpp"
+#include "../core/Config.hpp"
+#include "raylib.h"
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <algorithm>
+
+namespace {
+    constexpr char CHUNK_MAGIC[4] = {'L', 'S', 'C', 'K'};
+    constexpr uint32_t CHUNK_VERSION = 1;
+
+    // One atom of a stored molecule; links are indices within the molecule record
+    struct PackedAtom {
+        TransformComponent transform;
+        AtomComponent atom;
+        int32_t parent;
+        int32_t parentSlotIndex;
+        int32_t cycleBond;
+        int32_t childCount;
+        int32_t ringSize;
+        int32_t ringIndex;
+        int32_t ringInstanceId;
+        int32_t structureId;
+        uint32_t occupiedSlots;
+        float dockingProgress;
+        float targetX;
+        float targetY;
+        float releaseTimer;
+        uint8_t isInRing;
+        uint8_t isFrozen;
+        uint8_t pad[2];
+    };
+}
+
+int ChunkStreamer::chunkCoord(float v) {
+    return (int)std::floor(v / Config::CHUNK_SIZE);
+}
+
+std::string ChunkStreamer::chunkPath(long long key) const {
+    char name[64];
+    std::snprintf(name, sizeof(name), "/chunk_%d_%d.bin", (int)(key >> 32), (int)(key & 0xFFFFFFFF));
+    return directory + name;
+}
+
+bool ChunkStreamer::isChunkFileName(const std::string& name) {
+    int cx = 0, cy = 0, consumed = 0;
+    return std::sscanf(name.c_str(), "chunk_%d_%d.bin%n", &cx, &cy, &consumed) == 2 && consumed == (int)name.size();
+}
+
+void ChunkStreamer::initialize(const std::string& dir) {
+    directory = dir;
+    storedChunks.clear();
+    stats = ChunkStreamerStats{};
+    tickCounter = 0;
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        TraceLog(LOG_WARNING, "[STREAM] Cannot create %s: %s", directory.c_str(), ec.message().c_str());
+        return;
+    }
+
+    // Only chunk files from an earlier session are removed; anything else in the directory is left alone
+    int removed = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (!entry.is_regular_file(ec) || !isChunkFileName(entry.path().filename().string())) continue;
+        if (std::filesystem::remove(entry.path(), ec)) removed++;
+    }
+    if (removed > 0) TraceLog(LOG_INFO, "[STREAM] Removed %d stale chunk files from %s", removed, directory.c_str());
+}
+
+bool ChunkStreamer::writeChunk(long long key, const BinaryWriter& out) const {
+    std::string path = chunkPath(key);
+    bool appending = storedChunks.find(key) != storedChunks.end();
+    std::error_code ec;
+    uintmax_t oldSize = appending ? std::filesystem::file_size(path, ec) : 0;
+    if (ec) return false;
+    if (out.saveToFile(path, appending)) return true;
+
+    // Roll back a partial write so the chunk never holds a record of a molecule still in the world
+    if (appending) std::filesystem::resize_file(path, oldSize, ec);
+    else std::filesystem::remove(path, ec);
+    return false;
+}
+
+void ChunkStreamer::update(World& world, int playerIndex, int tractedEntityId) {
+    if (++tickCounter < Config::CHUNK_UPDATE_TICKS) return;
+    tickCounter = 0;
+    if (playerIndex < 0 || playerIndex >= (int)world.transforms.size()) return;
+
+    int pcx = chunkCoord(world.transforms[playerIndex].x);
+    int pcy = chunkCoord(world.transforms[playerIndex].y);
+    loadNearChunks(world, pcx, pcy);
+    evictFarMolecules(world, pcx, pcy, playerIndex, tractedEntityId);
+}
+
+void ChunkStreamer::loadAll(World& world) {
+    std::vector<long long> keys;
+    for (const auto& [key, count] : storedChunks) keys.push_back(key);
+    std::sort(keys.begin(), keys.end());  // Spawn order decides entity indices (Phase 55: keep it reproducible)
+    for (long long key : keys) loadChunk(world, key);
+}
+
+bool ChunkStreamer::isPinned(const std::vector<int>& molecule, const std::vector<StateComponent>& states,
+                             int playerMolecule, int tractedMolecule) const {
+    for (int id : molecule) {
+        const StateComponent& s = states[id];
+        int root = (s.moleculeId != -1) ? s.moleculeId : id;
+        if (root == playerMolecule || root == tractedMolecule) return true;
+        if (s.isShielded || s.dockingProgress < 0.99f || s.justBonded) return true;  // Mid-process
+    }
+    return false;
+}
+
+void ChunkStreamer::evictFarMolecules(World& world, int pcx, int pcy, int playerIndex, int tractedEntityId) {
+    std::vector<StateComponent>& states = world.states;
+    const std::vector<TransformComponent>& transforms = world.transforms;
+
+    int playerMolecule = (states[playerIndex].moleculeId != -1) ? states[playerIndex].moleculeId : playerIndex;
+    int tractedMolecule = -2;
+    if (tractedEntityId >= 0 && tractedEntityId < (int)states.size()) {
+        tractedMolecule = (states[tractedEntityId].moleculeId != -1) ? states[tractedEntityId].moleculeId : tractedEntityId;
+    }
+
+    auto isFar = [&](int id) {
+        int dx = std::abs(chunkCoord(transforms[id].x) - pcx);
+        int dy = std::abs(chunkCoord(transforms[id].y) - pcy);
+        return std::max(dx, dy) > Config::CHUNK_KEEP_RADIUS;
+    };
+
+    // Molecules are only despawned once their chunk file is safely on disk
+    struct Eviction {
+        long long key;
+        std::vector<int> members;
+    };
+    std::vector<Eviction> evictions;
+    std::unordered_map<long long, BinaryWriter> pending;
+    std::unordered_map<long long, int> pendingCounts;
+    if (localIndex.size() < states.size()) localIndex.resize(states.size(), -1);
+
+    for (int i = 0; i < (int)states.size(); i++) {
+        if (i == playerIndex || !states[i].isAlive) continue;
+        bool isRoot = states[i].moleculeId == i || (states[i].moleculeId == -1 && states[i].parentEntityId == -1);
+        if (!isRoot || !isFar(i)) continue;
+
+        MolecularHierarchy::collectMembers(i, states, members, visits);
+        bool allFar = std::all_of(members.begin(), members.end(), isFar);
+        if (!allFar || isPinned(members, states, playerMolecule, tractedMolecule)) continue;
+
+        // Stored with the root atom's chunk; links become molecule-local indices
+        long long key = chunkKey(chunkCoord(transforms[i].x), chunkCoord(transforms[i].y));
+        BinaryWriter& out = pending[key];
+        if (out.size() == 0 && storedChunks.find(key) == storedChunks.end()) {
+            out.writeBytes(CHUNK_MAGIC, 4);
+            out.write<uint32_t>(CHUNK_VERSION);
+        }
+
+        for (int k = 0; k < (int)members.size(); k++) localIndex[members[k]] = k;
+        auto local = [&](int id) { return (id >= 0 && id < (int)localIndex.size()) ? localIndex[id] : -1; };
+
+        out.write<uint32_t>((uint32_t)members.size());
+        for (int id : members) {
+            const StateComponent& s = states[id];
+            PackedAtom p{};
+            p.transform = transforms[id];
+            p.atom = world.atoms[id];
+            p.parent = local(s.parentEntityId);
+            p.parentSlotIndex = s.parentSlotIndex;
+            p.cycleBond = local(s.cycleBondId);
+            p.childCount = s.childCount;
+            p.ringSize = s.ringSize;
+            p.ringIndex = s.ringIndex;
+            p.ringInstanceId = s.ringInstanceId;
+            p.structureId = s.structureId;
+            p.occupiedSlots = s.occupiedSlots;
+            p.dockingProgress = s.dockingProgress;
+            p.targetX = s.targetX;
+            p.targetY = s.targetY;
+            p.releaseTimer = s.releaseTimer;
+            p.isInRing = s.isInRing ? 1 : 0;
+            p.isFrozen = s.isFrozen ? 1 : 0;
+            out.write(p);
+        }
+        for (int id : members) {
+            out.write<uint32_t>((uint32_t)states[id].childList.size());
+            for (int child : states[id].childList) out.write<int32_t>(local(child));
+        }
+        for (int id : members) localIndex[id] = -1;
+
+        pendingCounts[key]++;
+        evictions.push_back({ key, members });
+    }
+
+    std::unordered_map<long long, bool> written;
+    for (auto& [key, out] : pending) {
+        written[key] = writeChunk(key, out);
+        if (!written[key]) {
+            TraceLog(LOG_ERROR, "[STREAM] Failed to write %s: molecules stay loaded", chunkPath(key).c_str());
+            continue;
+        }
+        storedChunks[key] += pendingCounts[key];
+    }
+
+    // Despawn in scan order (Phase 55: free-list order decides later entity indices)
+    for (const Eviction& e : evictions) {
+        if (!written[e.key]) continue;
+        stats.moleculesEvicted++;
+        stats.atomsEvicted += (long long)e.members.size();
+        world.despawnGroup(e.members);
+    }
+    stats.chunksOnDisk = (int)storedChunks.size();
+}
+
+void ChunkStreamer::loadNearChunks(World& world, int pcx, int pcy) {
+    std::vector<long long> near;
+    for (const auto& [key, count] : storedChunks) {
+        int cx = (int)(key >> 32);
+        int cy = (int)(key & 0xFFFFFFFF);
+        if (std::max(std::abs(cx - pcx), std::abs(cy - pcy)) <= Config::CHUNK_ACTIVE_RADIUS) near.push_back(key);
+    }
+    std::sort(near.begin(), near.end());
+    for (long long key : near) loadChunk(world, key);
+}
+
+void ChunkStreamer::loadChunk(World& world, long long key) {
+    std::string path = chunkPath(key);
+
+    // Unreadable chunks stay registered (and on disk) and are retried on the next update
+    std::vector<char> bytes;
+    if (!BinaryReader::loadFile(path, bytes)) {
+        TraceLog(LOG_ERROR, "[STREAM] Cannot read chunk file %s; kept for retry", path.c_str());
+        return;
+    }
+    BinaryReader in(bytes);
+    char magic[4];
+    uint32_t version = 0;
+    if (!in.readBytes(magic, 4) || std::memcmp(magic, CHUNK_MAGIC, 4) != 0 || !in.read(version) || version != CHUNK_VERSION) {
+        TraceLog(LOG_ERROR, "[STREAM] %s is not a version %u chunk file; kept for retry", path.c_str(), CHUNK_VERSION);
+        return;
+    }
+
+    // Decode every complete molecule record before spawning anything
+    struct Record {
+        std::vector<PackedAtom> atoms;
+        std::vector<std::vector<int32_t>> children;
+    };
+    std::vector<Record> records;
+    size_t unreadFrom = 0;  // Start of the first record that could not be decoded
+    while (!in.atEnd()) {
+        unreadFrom = in.position();
+        uint32_t count = 0;
+        if (!in.read(count) || count == 0) break;
+        Record r;
+        r.atoms.resize(count);
+        if (!in.readArray(r.atoms.data(), count)) break;
+        r.children.resize(count);
+        for (uint32_t k = 0; k < count && in.ok(); k++) {
+            uint32_t children = 0;
+            if (!in.read(children)) break;
+            for (uint32_t c = 0; c < children; c++) {
+                int32_t child = -1;
+                if (!in.read(child)) break;
+                r.children[k].push_back(child);
+            }
+        }
+        if (!in.ok()) break;
+        records.push_back(std::move(r));
+    }
+    // A truncated file keeps its undecoded tail (rewritten before anything spawns, so a
+    // failed rewrite leaves the chunk as it was and the readable records are not duplicated)
+    bool truncated = !in.ok();
+    if (truncated && records.empty()) {
+        TraceLog(LOG_ERROR, "[STREAM] %s is truncated before its first molecule; kept for retry", path.c_str());
+        return;
+    }
+    if (truncated) {
+        BinaryWriter rest;
+        rest.writeBytes(CHUNK_MAGIC, 4);
+        rest.write<uint32_t>(CHUNK_VERSION);
+        rest.writeBytes(bytes.data() + unreadFrom, bytes.size() - unreadFrom);
+        std::string tmpPath = path + ".tmp";
+        std::error_code ec;
+        if (!rest.saveToFile(tmpPath)) {
+            std::filesystem::remove(tmpPath, ec);
+            TraceLog(LOG_ERROR, "[STREAM] %s is truncated and cannot be rewritten; kept for retry", path.c_str());
+            return;
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmpPath, ec);
+            TraceLog(LOG_ERROR, "[STREAM] %s is truncated and cannot be rewritten; kept for retry", path.c_str());
+            return;
+        }
+        TraceLog(LOG_WARNING, "[STREAM] %s is truncated; loaded %d molecules, kept the unreadable rest on disk",
+                 path.c_str(), (int)records.size());
+    }
+
+    std::vector<int> ids;
+    int loadedAtoms = 0;
+    for (const Record& r : records) {
+        const uint32_t count = (uint32_t)r.atoms.size();
+        ids.resize(count);
+        for (uint32_t k = 0; k < count; k++) ids[k] = world.resolve(world.spawn(r.atoms[k].transform, r.atoms[k].atom.atomicNumber));
+
+        auto global = [&](int32_t local) { return (local >= 0 && local < (int32_t)count) ? ids[local] : -1; };
+        for (uint32_t k = 0; k < count; k++) {
+            const PackedAtom& p = r.atoms[k];
+            StateComponent& s = world.states[ids[k]];
+            world.atoms[ids[k]] = p.atom;
+            s.parentEntityId = global(p.parent);
+            s.parentSlotIndex = p.parentSlotIndex;
+            s.cycleBondId = global(p.cycleBond);
+            s.childCount = p.childCount;
+            s.ringSize = p.ringSize;
+            s.ringIndex = p.ringIndex;
+            s.ringInstanceId = p.ringInstanceId;
+            s.structureId = p.structureId;
+            s.occupiedSlots = p.occupiedSlots;
+            s.dockingProgress = p.dockingProgress;
+            s.targetX = p.targetX;
+            s.targetY = p.targetY;
+            s.releaseTimer = p.releaseTimer;
+            s.isInRing = p.isInRing != 0;
+            s.isFrozen = p.isFrozen != 0;
+            for (int32_t child : r.children[k]) {
+                if (global(child) != -1) s.childList.push_back(global(child));
+            }
+        }
+        // Molecule ids, isClustered and topology versions are re-derived for the new indices
+        MolecularHierarchy::propagateMoleculeId(ids[0], world.states);
+        for (int id : ids) assert(MolecularHierarchy::checkLinks(id, world.states));
+        loadedAtoms += (int)count;
+    }
+
+    // Everything readable is in the world now; only then is the chunk forgotten
+    if (truncated) {
+        storedChunks[key] = std::max(1, storedChunks[key] - (int)records.size());
+    } else {
+        storedChunks.erase(key);
+        std::remove(path.c_str());
+    }
+    stats.chunksOnDisk = (int)storedChunks.size();
+    stats.atomsLoaded += loadedAtoms;
+}
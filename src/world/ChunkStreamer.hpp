@@ -0,0 +1,70 @@
+#ifndef CHUNK_STREAMER_HPP
+#define CHUNK_STREAMER_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+#include "../ecs/components.hpp"
+#include "../core/BinaryIO.hpp"
+#include "../physics/MolecularHierarchy.hpp"
+
+class World;
+
+struct ChunkStreamerStats {
+    int chunksOnDisk = 0;
+    long long moleculesEvicted = 0;
+    long long atomsEvicted = 0;
+    long long atomsLoaded = 0;
+};
+
+/**
+ * ChunkStreamer (Phase 52)
+ * Splits the plane into Config::CHUNK_SIZE squares keyed by grid coordinates.
+ * Molecules whose atoms are all farther than CHUNK_KEEP_RADIUS chunks from the
+ * player are serialised to their root atom's chunk file and despawned; a
+ * chunk's molecules are respawned when the player comes within
+ * CHUNK_ACTIVE_RADIUS. The gap between the two radii is hysteresis.
+ *
+ * Molecules are always stored whole (assigned by root atom), so bonds never
+ * cross a loaded/unloaded boundary. Anything mid-process (docking, shielded,
+ * tractor target, attached to the player) is never evicted.
+ */
+class ChunkStreamer {
+public:
+    // Clears chunk files (chunk_X_Y.bin) left over from a previous session; nothing else is deleted
+    void initialize(const std::string& directory);
+
+    // Call once per fixed step; does work every Config::CHUNK_UPDATE_TICKS calls
+    void update(World& world, int playerIndex, int tractedEntityId);
+
+    // Pages every stored chunk back in (e.g. before saving the whole world)
+    void loadAll(World& world);
+
+    const ChunkStreamerStats& getStats() const { return stats; }
+
+    static long long chunkKey(int cx, int cy) { return ((long long)cx << 32) | (unsigned int)cy; }
+    static int chunkCoord(float v);
+
+private:
+    std::string directory;
+    int tickCounter = 0;
+    std::unordered_map<long long, int> storedChunks;  // key -> molecules on disk
+    ChunkStreamerStats stats;
+
+    // Scratch
+    std::vector<int> members;
+    MolecularHierarchy::VisitMarks visits;
+    std::vector<int> localIndex;
+
+    std::string chunkPath(long long key) const;
+    static bool isChunkFileName(const std::string& name);
+    bool writeChunk(long long key, const BinaryWriter& out) const;
+    bool isPinned(const std::vector<int>& molecule, const std::vector<StateComponent>& states,
+                  int playerMolecule, int tractedMolecule) const;
+    void evictFarMolecules(World& world, int pcx, int pcy, int playerIndex, int tractedEntityId);
+    void loadNearChunks(World& world, int pcx, int pcy);
+    void loadChunk(World& world, long long key);
+};
+
+#endif // CHUNK_STREAMER_HPP